@@ -205,7 +205,10 @@ void JNICALL Java_ai_gams_utility_Region_jni_1addGpsVertex
 {
   pose::Region * current = (pose::Region *) cptr;
   if (current && vertex != 0)
+  {
     current->vertices.push_back (*(pose::Position *)vertex);
+    current->refresh ();
+  }
   else
   {
     // user has tried to use a deleted object. Clean up and throw
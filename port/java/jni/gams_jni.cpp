@@ -277,6 +277,33 @@ jclass gams::utility::java::find_class (JNIEnv * env, const char * name)
   return result;
 }
 
+jmethodID gams::utility::java::find_method (JNIEnv * env, jclass cls,
+  const char * name, const char * signature)
+{
+  jmethodID result (0);
+
+  if (env != 0 && cls != 0)
+  {
+    result = env->GetMethodID (cls, name, signature);
+
+    if (env->ExceptionCheck ())
+    {
+      env->ExceptionClear ();
+      result = 0;
+    }
+
+    if (result == 0)
+    {
+      madara_logger_ptr_log (loggers::global_logger.get (),
+        loggers::LOG_MINOR,
+        "gams::utility::java::find_method: "
+        "Method %s%s was not found. Returning zero.\n", name, signature);
+    }
+  }
+
+  return result;
+}
+
 void gams::utility::java::throw_dead_obj_exception (
   JNIEnv * env, const char * message)
 {
@@ -29,6 +29,19 @@ namespace gams
       **/
       jclass GAMS_EXPORT find_class (JNIEnv * env, const char * name);
 
+      /**
+      * Finds an instance method, clearing the NoSuchMethodError that
+      * GetMethodID raises if the method is missing. Resolve methods once
+      * and keep the IDs; they are valid for as long as the class is loaded.
+      * @param  env        Java environment
+      * @param  cls        class to search
+      * @param  name       name of the method
+      * @param  signature  JNI signature of the method
+      * @return the method ID, or 0 if not found
+      **/
+      jmethodID GAMS_EXPORT find_method (JNIEnv * env, jclass cls,
+        const char * name, const char * signature);
+
       /**
        * Throws an exception when developers use JNI objects after being deleted
        * @param  env   Java environment
@@ -0,0 +1,189 @@
+/*********************************************************************
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following acknowledgments and disclaimers.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or
+ * "Software Engineering Institute" shall not be used to endorse or promote
+ * products derived from this software without prior written permission. For
+ * written permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ * appear in their names without prior written permission of
+ * permission@sei.cmu.edu.
+ *
+ * 5. Redistributions of any form whatsoever must retain the following
+ * acknowledgment:
+ *
+ * This material is based upon work funded and supported by the Department of
+ * Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon University
+ * for the operation of the Software Engineering Institute, a federally funded
+ * research and development center. Any opinions, findings and conclusions or
+ * recommendations expressed in this material are those of the author(s) and
+ * do not necessarily reflect the views of the United States Department of
+ * Defense.
+ * 
+ * NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ * INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ * UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR IMPLIED,
+ * AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF FITNESS FOR
+ * PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS OBTAINED FROM USE OF THE
+ * MATERIAL. CARNEGIE MELLON UNIVERSITY DOES NOT MAKE ANY WARRANTY OF ANY KIND
+ * WITH RESPECT TO FREEDOM FROM PATENT, TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ * This material has been approved for public release and unlimited
+ * distribution.
+ *********************************************************************/
+
+package ai.gams.tests;
+
+import ai.gams.algorithms.AlgorithmStatusEnum;
+import ai.gams.algorithms.BaseAlgorithm;
+import ai.gams.controllers.BaseController;
+import ai.gams.platforms.BasePlatform;
+import ai.gams.platforms.PlatformStatusEnum;
+import ai.gams.utility.Axes;
+import ai.gams.utility.Position;
+import ai.madara.knowledge.KnowledgeBase;
+
+/**
+ * Measures the cost of the controller calling into Java platforms and
+ * algorithms. Each loop iteration calls into the platform and algorithm
+ * methods, which do no work but count their calls, so the time per call
+ * is the JNI overhead. main runs the loop from a Java thread, which is
+ * already attached to the JVM. tests/test_jni_overhead.cpp runs the same
+ * controller from a native thread, which also pays for attaching.
+ * Run against builds before and after a JNI change to compare.
+ */
+public class TestJniOverhead
+{
+  /**
+   * Calls made into the empty platform and algorithm
+   */
+  static public long calls = 0;
+
+  static private KnowledgeBase knowledge;
+  static private BaseController controller;
+
+  static public class EmptyPlatform extends BasePlatform
+  {
+    public int analyze() { ++calls; return PlatformStatusEnum.OK.value(); }
+    public double getAccuracy() { ++calls; return 0.0; }
+    public double getPositionAccuracy() { ++calls; return 0.0; }
+    public Position getPosition() { ++calls; return new Position(0.0, 0.0, 0.0); }
+    public int home() { ++calls; return PlatformStatusEnum.OK.value(); }
+    public int land() { ++calls; return PlatformStatusEnum.OK.value(); }
+    public int move(Position target, double proximity) { ++calls; return PlatformStatusEnum.OK.value(); }
+    public int rotate(Axes target) { ++calls; return PlatformStatusEnum.OK.value(); }
+    public double getMinSensorRange() { ++calls; return 0.0; }
+    public double getMoveSpeed() { ++calls; return 0.0; }
+    public java.lang.String getId() { ++calls; return "java_empty"; }
+    public java.lang.String getName() { ++calls; return "Java Empty"; }
+    public int sense() { ++calls; return PlatformStatusEnum.OK.value(); }
+    public void setMoveSpeed(double speed) { ++calls; }
+    public int takeoff() { ++calls; return PlatformStatusEnum.OK.value(); }
+    public void stopMove() { ++calls; }
+  }
+
+  static public class EmptyAlgorithm extends BaseAlgorithm
+  {
+    public int analyze() { ++calls; return AlgorithmStatusEnum.OK.value(); }
+    public int plan() { ++calls; return AlgorithmStatusEnum.OK.value(); }
+    public int execute() { ++calls; return AlgorithmStatusEnum.OK.value(); }
+  }
+
+  /**
+   * Creates a controller with the empty platform and algorithm. The
+   * controller and its knowledge base are kept until free is called.
+   * @return the controller
+   **/
+  static public BaseController createController() throws Exception
+  {
+    knowledge = new KnowledgeBase();
+    controller = new BaseController(knowledge);
+
+    controller.initVars(0, 1);
+    controller.initPlatform(new EmptyPlatform());
+    controller.initAlgorithm(new EmptyAlgorithm());
+
+    return controller;
+  }
+
+  /**
+   * Frees the controller made by createController
+   **/
+  static public void free() throws Exception
+  {
+    controller.free();
+    knowledge.free();
+  }
+
+  /**
+   * Runs loop iterations of the controller's MAPE loop
+   * @param  controller  the controller to run
+   * @param  loops       the number of iterations
+   * @return the elapsed time in nanoseconds
+   **/
+  static private long runLoops(BaseController controller, int loops)
+    throws Exception
+  {
+    long start = System.nanoTime();
+
+    for (int i = 0; i < loops; ++i)
+    {
+      controller.monitor();
+      controller.analyze();
+      controller.plan();
+      controller.execute();
+    }
+
+    return System.nanoTime() - start;
+  }
+
+  public static void main(String... args) throws Exception
+  {
+    int loops = 100000;
+
+    if (args.length > 0)
+    {
+      try
+      {
+        loops = Integer.parseInt(args[0]);
+      }
+      catch (NumberFormatException e)
+      {
+        System.err.println("Argument 1 (" + args[0] + ") is supposed to be the number of loops.");
+        System.exit(1);
+      }
+    }
+
+    BaseController controller = createController();
+
+    System.out.println("Warming up for " + loops / 10 + " loops...");
+    runLoops(controller, loops / 10);
+
+    System.out.println("Running " + loops + " loops...");
+    calls = 0;
+    long elapsed = runLoops(controller, loops);
+
+    System.out.println("  " + elapsed / 1000000 + " ms total");
+    System.out.println("  " + calls + " calls into Java, " +
+      (double) calls / loops + " per loop");
+
+    if (calls > 0)
+    {
+      System.out.println("  " + (double) elapsed / calls / 1000.0 +
+        " us per call into Java");
+    }
+
+    free();
+  }
+}
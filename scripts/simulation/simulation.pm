@@ -7,7 +7,7 @@ my $term_suffix = $ENV{"GAMS_TERM_SUFFIX"};
 
 sub run {
   # get arguments
-  my ($num, $time, $period, $sim, $area, $madara_debug, $gams_debug, $border, $num_coverages, $launch_controllers) = @_;
+  my ($num, $time, $period, $sim, $area, $madara_debug, $gams_debug, $border, $num_coverages, $launch_controllers, $platform) = @_;
   my $osname = $^O;
   my $vreproot = $ENV{"VREP_ROOT"};
 
@@ -16,6 +16,11 @@ sub run {
 
   $launch_controllers //= 1;
 
+  # in-process simulated platforms (sim-quad, sim-ground) need no simulator.
+  # Each controller simulates only its own agent.
+  $platform //= "";
+  my $external_sim = $platform !~ /^sim[-_]/;
+
   if ($launch_controllers == 1)
   {
     #$gams_root =~ s/\\/\//g;
@@ -34,6 +39,10 @@ sub run {
       $cmd = "$cmd $gams_root/scripts/simulation/$sim/madara_init_$i.mf";
       $cmd = "$cmd --madara-level $madara_debug --gams-level $gams_debug";
       $cmd = "$cmd --logfile gams_log_$i.log";
+      if ($platform)
+      {
+        $cmd = "$cmd -p $platform";
+      }
       $cmd = "$cmd \"";
       if ($term_prefix)
       {
@@ -49,6 +58,10 @@ sub run {
 		    $cmd .= "$gams_root\\scripts\\simulation\\$sim\\madara_init_$i.mf ";
 		    $cmd .= "--madara-level $madara_debug --gams-level $gams_debug ";
 		    $cmd .= "--queue-length 2000000 --logfile gams_log_$i.log";
+        if ($platform)
+        {
+          $cmd .= " -p $platform";
+        }
         print("start \"Device$i\" /REALTIME $cmd\n\n");
         system("start \"Device$i\" /REALTIME $cmd");
       }
@@ -68,6 +81,11 @@ sub run {
     }
   }
  
+  if (!$external_sim)
+  {
+    return;
+  }
+
   # launch simulation controller
   my $cmd = "$gams_root/bin/dynamic_simulation -t -1 --sim-time-poll-rate 2 -n $num --madara-file $gams_root/scripts/simulation/areas/$area.mf";
   if ($border)
@@ -49,10 +49,12 @@
 #include "gams/loggers/GlobalLogger.h"
 
 #include "gams/algorithms/AlgorithmFactoryRepository.h"
+#include "gams/algorithms/CollisionAvoidance.h"
 #include "gams/algorithms/Land.h"
 #include "gams/algorithms/Move.h"
 #include "gams/algorithms/DebugAlgorithm.h"
 #include "gams/algorithms/NullAlgorithm.h"
+#include "gams/algorithms/PathPlan.h"
 #include "gams/algorithms/FormationFlying.h"
 #include "gams/algorithms/FormationCoverage.h"
 #include "gams/algorithms/FormationSync.h"
@@ -77,10 +79,11 @@
 #include "gams/algorithms/area_coverage/PerimeterPatrolCoverage.h"
 #include "gams/algorithms/area_coverage/WaypointsCoverage.h"
 
+#include "gams/algorithms/area_coverage/LocalPheremoneAreaCoverage.h"
+
 #if 0
 #include "gams/algorithms/area_coverage/MinTimeAreaCoverage.h"
 #include "gams/algorithms/area_coverage/PrioritizedMinTimeAreaCoverage.h"
-#include "gams/algorithms/area_coverage/LocalPheremoneAreaCoverage.h"
 #endif
 
 #include <iostream>
@@ -164,6 +167,13 @@ void algorithms::AlgorithmFactoryRepository::initialize_default_mappings (
 
     add (aliases, new GroupBarrierFactory ());
 
+    // the collision avoidance accent
+    aliases.resize (2);
+    aliases[0] = "collision avoidance";
+    aliases[1] = "orca";
+
+    add (aliases, new CollisionAvoidanceFactory ());
+
     // the debug algorithm
     aliases.resize (3);
     aliases[0] = "debug";
@@ -241,6 +251,13 @@ void algorithms::AlgorithmFactoryRepository::initialize_default_mappings (
 
     add (aliases, new NullAlgorithmFactory ());
 
+    // the path planner
+    aliases.resize (2);
+    aliases[0] = "path plan";
+    aliases[1] = "path_plan";
+
+    add (aliases, new PathPlanFactory ());
+
     // the performance profiler
     aliases.resize (1);
     aliases[0] = "performance profiling";
@@ -292,13 +309,13 @@ void algorithms::AlgorithmFactoryRepository::initialize_default_mappings (
 
     add (aliases, new SpellFactory ());
 
-#if 0
     // the local pheromone coverage algorithm
     aliases.resize (1);
     aliases[0] = "local pheremone";
 
     add (aliases, new area_coverage::LocalPheremoneAreaCoverageFactory ());
 
+#if 0
     // the minimum time coverage algorithm
     aliases.resize (2);
     aliases[0] = "min time";
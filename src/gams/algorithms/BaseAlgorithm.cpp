@@ -57,7 +57,8 @@ gams::algorithms::BaseAlgorithm::BaseAlgorithm (
   variables::Self * self,
   variables::Agents * agents)
   : agents_ (agents), executions_ (0), knowledge_ (knowledge),
-    platform_ (platform), self_ (self), sensors_ (sensors)
+    platform_ (platform), self_ (self), sensors_ (sensors), neighbors_ (0),
+    swarm_view_ (0)
 {
   madara_logger_ptr_log (gams::loggers::global_logger.get (),
     gams::loggers::LOG_MAJOR,
@@ -79,6 +80,8 @@ gams::algorithms::BaseAlgorithm::operator= (const BaseAlgorithm & rhs)
     this->sensors_ = rhs.sensors_;
     this->self_ = rhs.self_;
     this->status_ = rhs.status_;
+    this->neighbors_ = rhs.neighbors_;
+    this->swarm_view_ = rhs.swarm_view_;
   }
 }
 
@@ -106,6 +109,20 @@ gams::algorithms::BaseAlgorithm::set_sensors (variables::Sensors * sensors)
   sensors_ = sensors;
 }
 
+void
+gams::algorithms::BaseAlgorithm::set_neighbor_index (
+  variables::NeighborIndex * neighbors)
+{
+  neighbors_ = neighbors;
+}
+
+void
+gams::algorithms::BaseAlgorithm::set_swarm_view (
+  variables::SwarmView * swarm_view)
+{
+  swarm_view_ = swarm_view;
+}
+
 variables::Agents *
 gams::algorithms::BaseAlgorithm::get_agents (void)
 {
@@ -141,3 +158,25 @@ gams::algorithms::BaseAlgorithm::get_algorithm_status (void)
 {
   return &status_;
 }
+
+variables::NeighborIndex *
+gams::algorithms::BaseAlgorithm::get_neighbor_index (void)
+{
+  if (neighbors_)
+  {
+    neighbors_->update ();
+  }
+
+  return neighbors_;
+}
+
+variables::SwarmView *
+gams::algorithms::BaseAlgorithm::get_swarm_view (void)
+{
+  if (swarm_view_)
+  {
+    swarm_view_->update ();
+  }
+
+  return swarm_view_;
+}
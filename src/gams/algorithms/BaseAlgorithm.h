@@ -57,6 +57,8 @@
 #include "gams/variables/Sensor.h"
 #include "gams/platforms/BasePlatform.h"
 #include "gams/variables/AlgorithmStatus.h"
+#include "gams/variables/NeighborIndex.h"
+#include "gams/variables/SwarmView.h"
 #include "gams/variables/Self.h"
 #include "gams/pose/Region.h"
 #include "madara/knowledge/KnowledgeBase.h"
@@ -165,9 +167,23 @@ namespace gams
        * @param  sensors      map of sensor names to sensor information
        **/
       virtual void set_sensors (variables::Sensors * sensors);
+
+      /**
+       * Sets the spatial index over the agents' locations
+       * @param  neighbors    index shared by the controller's algorithms
+       **/
+      virtual void set_neighbor_index (variables::NeighborIndex * neighbors);
+
+      /**
+       * Sets the lazily bound view of the swarm
+       * @param  swarm_view   view shared by the controller's algorithms
+       **/
+      virtual void set_swarm_view (variables::SwarmView * swarm_view);
       
       /**
-       * Gets the list of agents
+       * Gets the list of agents. Controllers only set each agent's prefix;
+       * the containers of agent i are bound on first use through
+       * get_swarm_view ()->get_agent (i).
        **/
       variables::Agents * get_agents (void);
 
@@ -196,8 +212,24 @@ namespace gams
        **/
       variables::AlgorithmStatus * get_algorithm_status (void);
 
+      /**
+       * Gets the spatial index over the agents' locations, rebuilt at most
+       * once per control loop. Agent indices in query results refer to
+       * get_agents ().
+       * @return the neighbor index, or 0 if no controller provided one
+       **/
+      variables::NeighborIndex * get_neighbor_index (void);
+
+      /**
+       * Gets the view of the swarm, with hot fields refreshed at most once
+       * per control loop. Agent indices refer to get_agents ().
+       * @return the swarm view, or 0 if no controller provided one
+       **/
+      variables::SwarmView * get_swarm_view (void);
+
     protected:
-      /// the list of agents potentially participating in the algorithm
+      /// the agents potentially participating in the algorithm. Under a
+      /// controller, only prefixes are set (@see get_agents)
       variables::Agents * agents_;
 
       /// number of executions
@@ -217,6 +249,12 @@ namespace gams
 
       /// provides access to status information for this platform
       variables::AlgorithmStatus status_;
+
+      /// spatial index over agents_, owned by the controller
+      variables::NeighborIndex * neighbors_;
+
+      /// view of the swarm, owned by the controller
+      variables::SwarmView * swarm_view_;
     };
 
     // deprecated typdef. Please use BaseAlgorithm instead.
@@ -0,0 +1,704 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file CollisionAvoidance.cpp
+ *
+ * This file contains the implementation of the CollisionAvoidance accent
+ **/
+
+#include "gams/algorithms/CollisionAvoidance.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "madara/utility/Utility.h"
+
+#include "gams/pose/CartesianFrame.h"
+#include "gams/pose/GPSFrame.h"
+
+typedef madara::knowledge::KnowledgeMap    KnowledgeMap;
+
+namespace
+{
+  /// a directed line; velocities left of it are allowed
+  struct Line
+  {
+    Eigen::Vector2d point;
+    Eigen::Vector2d direction;
+  };
+
+  const double ORCA_EPSILON = 1e-5;
+
+  inline double det (const Eigen::Vector2d & a, const Eigen::Vector2d & b)
+  {
+    return a.x () * b.y () - a.y () * b.x ();
+  }
+
+  /**
+   * Finds the point on line line_no, within radius and left of all earlier
+   * lines, closest to opt_velocity (or furthest along it if direction_opt)
+   **/
+  bool linear_program1 (const std::vector<Line> & lines, size_t line_no,
+    double radius, const Eigen::Vector2d & opt_velocity, bool direction_opt,
+    Eigen::Vector2d & result)
+  {
+    const Line & line = lines[line_no];
+    const double dot = line.point.dot (line.direction);
+    const double discriminant =
+      dot * dot + radius * radius - line.point.squaredNorm ();
+
+    if (discriminant < 0)
+    {
+      // the speed limit circle misses this line entirely
+      return false;
+    }
+
+    const double sqrt_discriminant = std::sqrt (discriminant);
+    double t_left = -dot - sqrt_discriminant;
+    double t_right = -dot + sqrt_discriminant;
+
+    for (size_t i = 0; i < line_no; ++i)
+    {
+      const double denominator = det (line.direction, lines[i].direction);
+      const double numerator =
+        det (lines[i].direction, line.point - lines[i].point);
+
+      if (std::fabs (denominator) <= ORCA_EPSILON)
+      {
+        // parallel lines
+        if (numerator < 0)
+        {
+          return false;
+        }
+        continue;
+      }
+
+      const double t = numerator / denominator;
+      if (denominator >= 0)
+      {
+        t_right = std::min (t_right, t);
+      }
+      else
+      {
+        t_left = std::max (t_left, t);
+      }
+
+      if (t_left > t_right)
+      {
+        return false;
+      }
+    }
+
+    if (direction_opt)
+    {
+      result = line.point + (opt_velocity.dot (line.direction) > 0 ?
+        t_right : t_left) * line.direction;
+    }
+    else
+    {
+      const double t = std::min (t_right, std::max (t_left,
+        line.direction.dot (opt_velocity - line.point)));
+      result = line.point + t * line.direction;
+    }
+
+    return true;
+  }
+
+  /**
+   * Finds the velocity within radius, left of all lines, closest to
+   * opt_velocity. Returns lines.size () on success, or the index of the
+   * first line that could not be satisfied.
+   **/
+  size_t linear_program2 (const std::vector<Line> & lines, double radius,
+    const Eigen::Vector2d & opt_velocity, bool direction_opt,
+    Eigen::Vector2d & result)
+  {
+    if (direction_opt)
+    {
+      result = opt_velocity * radius;
+    }
+    else if (opt_velocity.squaredNorm () > radius * radius)
+    {
+      result = opt_velocity.normalized () * radius;
+    }
+    else
+    {
+      result = opt_velocity;
+    }
+
+    for (size_t i = 0; i < lines.size (); ++i)
+    {
+      if (det (lines[i].direction, lines[i].point - result) > 0)
+      {
+        const Eigen::Vector2d previous = result;
+        if (!linear_program1 (lines, i, radius, opt_velocity,
+          direction_opt, result))
+        {
+          result = previous;
+          return i;
+        }
+      }
+    }
+
+    return lines.size ();
+  }
+
+  /**
+   * When no velocity satisfies every line, finds the one that violates
+   * them by the least distance
+   **/
+  void linear_program3 (const std::vector<Line> & lines, size_t begin_line,
+    double radius, Eigen::Vector2d & result)
+  {
+    double distance = 0;
+
+    for (size_t i = begin_line; i < lines.size (); ++i)
+    {
+      if (det (lines[i].direction, lines[i].point - result) <= distance)
+      {
+        continue;
+      }
+
+      std::vector<Line> projected;
+      projected.reserve (i);
+      for (size_t j = 0; j < i; ++j)
+      {
+        Line line;
+        const double determinant = det (lines[i].direction, lines[j].direction);
+
+        if (std::fabs (determinant) <= ORCA_EPSILON)
+        {
+          if (lines[i].direction.dot (lines[j].direction) > 0)
+          {
+            // same direction, so line j is already covered by line i
+            continue;
+          }
+          line.point = 0.5 * (lines[i].point + lines[j].point);
+        }
+        else
+        {
+          line.point = lines[i].point + (det (lines[j].direction,
+            lines[i].point - lines[j].point) / determinant) *
+            lines[i].direction;
+        }
+
+        line.direction =
+          (lines[j].direction - lines[i].direction).normalized ();
+        projected.push_back (line);
+      }
+
+      const Eigen::Vector2d previous = result;
+      if (linear_program2 (projected, radius,
+        Eigen::Vector2d (-lines[i].direction.y (), lines[i].direction.x ()),
+        true, result) < projected.size ())
+      {
+        // can only fail through rounding, so keep the previous result
+        result = previous;
+      }
+
+      distance = det (lines[i].direction, lines[i].point - result);
+    }
+  }
+}
+
+gams::algorithms::BaseAlgorithm *
+gams::algorithms::CollisionAvoidanceFactory::create (
+  const KnowledgeMap & args,
+  madara::knowledge::KnowledgeBase * knowledge,
+  platforms::BasePlatform * platform,
+  variables::Sensors * sensors,
+  variables::Self * self,
+  variables::Agents * agents)
+{
+  BaseAlgorithm * result (0);
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::algorithms::CollisionAvoidanceFactory:" \
+    " entered create with %u args\n", args.size ());
+
+  if (knowledge && sensors && platform && self && agents)
+  {
+    double radius = 2.0;
+    double range = 20.0;
+    size_t max_neighbors = 10;
+    double time_horizon = 5.0;
+    double max_speed = 5.0;
+
+    for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
+    {
+      if (i->first == "radius")
+      {
+        radius = i->second.to_double ();
+      }
+      else if (i->first == "range")
+      {
+        range = i->second.to_double ();
+      }
+      else if (i->first == "max_neighbors")
+      {
+        max_neighbors = (size_t)std::max (i->second.to_integer (),
+          (madara::knowledge::KnowledgeRecord::Integer)0);
+      }
+      else if (i->first == "time_horizon")
+      {
+        time_horizon = i->second.to_double ();
+      }
+      else if (i->first == "max_speed")
+      {
+        max_speed = i->second.to_double ();
+      }
+      else
+      {
+        madara_logger_ptr_log (gams::loggers::global_logger.get (),
+          gams::loggers::LOG_MAJOR,
+          "gams::algorithms::CollisionAvoidanceFactory:" \
+          " argument unknown: %s -> %s\n",
+          i->first.c_str (), i->second.to_string ().c_str ());
+        continue;
+      }
+
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_DETAILED,
+        "gams::algorithms::CollisionAvoidanceFactory:" \
+        " setting %s to %s\n",
+        i->first.c_str (), i->second.to_string ().c_str ());
+    }
+
+    result = new CollisionAvoidance (radius, range, max_neighbors,
+      time_horizon, max_speed, knowledge, platform, sensors, self, agents);
+  }
+
+  return result;
+}
+
+gams::algorithms::CollisionAvoidance::CollisionAvoidance (
+  double radius, double range, size_t max_neighbors,
+  double time_horizon, double max_speed,
+  madara::knowledge::KnowledgeBase * knowledge,
+  platforms::BasePlatform * platform,
+  variables::Sensors * sensors,
+  variables::Self * self,
+  variables::Agents * agents)
+  : BaseAlgorithm (knowledge, platform, sensors, self, agents),
+  radius_ (radius), range_ (range), max_neighbors_ (max_neighbors),
+  time_horizon_ (std::max (time_horizon, ORCA_EPSILON)),
+  max_speed_ (max_speed), frame_set_ (false),
+  self_index_ (variables::NeighborIndex::NO_AGENT), diverted_ (false)
+{
+  status_.init_vars (*knowledge, "collision_avoidance", self->agent.prefix);
+  status_.init_variable_values ();
+
+  self_track_.valid = false;
+}
+
+gams::algorithms::CollisionAvoidance::~CollisionAvoidance ()
+{
+}
+
+void
+gams::algorithms::CollisionAvoidance::operator= (
+  const CollisionAvoidance & rhs)
+{
+  if (this != &rhs)
+  {
+    this->BaseAlgorithm::operator= (rhs);
+    this->radius_ = rhs.radius_;
+    this->range_ = rhs.range_;
+    this->max_neighbors_ = rhs.max_neighbors_;
+    this->time_horizon_ = rhs.time_horizon_;
+    this->max_speed_ = rhs.max_speed_;
+    this->frame_ = rhs.frame_;
+    this->frame_set_ = rhs.frame_set_;
+    this->self_index_ = rhs.self_index_;
+    this->self_track_ = rhs.self_track_;
+    this->tracks_ = rhs.tracks_;
+    this->goal_ = rhs.goal_;
+    this->command_ = rhs.command_;
+    this->diverted_ = rhs.diverted_;
+  }
+}
+
+int
+gams::algorithms::CollisionAvoidance::analyze (void)
+{
+  return OK;
+}
+
+int
+gams::algorithms::CollisionAvoidance::plan (void)
+{
+  return 0;
+}
+
+int
+gams::algorithms::CollisionAvoidance::execute (void)
+{
+  variables::NeighborIndex * index = get_neighbor_index ();
+  variables::SwarmView * view = get_swarm_view ();
+
+  if (!platform_ || !self_ || (!agents_ && !view) || !index ||
+    !*platform_->get_platform_status ()->movement_available)
+  {
+    return 0;
+  }
+
+  const pose::ReferenceFrame & platform_frame = platform_->get_frame ();
+  const pose::Position current = platform_->get_location ();
+
+  if (!frame_set_)
+  {
+    frame_ = current.frame ().type () == pose::GPS ?
+      pose::ReferenceFrame (pose::Cartesian, current) : current.frame ();
+    frame_set_ = true;
+  }
+
+  // a destination we did not command came from the algorithm
+  pose::Position dest (platform_frame);
+  dest.from_container (self_->agent.dest);
+  if (!diverted_ || !dest.approximately_equal (command_, 0.01))
+  {
+    goal_ = dest;
+    diverted_ = false;
+  }
+
+  if (!*platform_->get_platform_status ()->moving && !diverted_)
+  {
+    return 0;
+  }
+
+  const size_t count = view ? view->size () : agents_->size ();
+
+  if (self_index_ >= count || get_prefix (self_index_) != self_->agent.prefix)
+  {
+    self_index_ = find_self ();
+  }
+
+  const double now = madara::utility::get_time () / 1e9;
+  const Eigen::Vector3d here = to_local (current);
+  const Eigen::Vector2d position (here.x (), here.y ());
+  Eigen::Vector2d velocity;
+  if (!get_velocity (self_->agent, velocity))
+  {
+    velocity = update_track (self_track_, position, now);
+  }
+
+  // head for the goal, slowing to arrive in one loop when close
+  double time_step = 1.0;
+  if (*self_->agent.loop_hz > 0)
+  {
+    time_step = 1.0 / *self_->agent.loop_hz;
+  }
+
+  const Eigen::Vector3d there = to_local (goal_);
+  Eigen::Vector2d preferred (there.x () - here.x (), there.y () - here.y ());
+  const double distance = preferred.norm ();
+  if (distance > ORCA_EPSILON)
+  {
+    preferred *= std::min (max_speed_, distance / time_step) / distance;
+  }
+
+  variables::NeighborIndex::Neighbors nearby;
+  if (self_index_ != variables::NeighborIndex::NO_AGENT)
+  {
+    nearby = index->within (self_index_, range_);
+  }
+  else
+  {
+    nearby = index->within (current, range_);
+  }
+
+  if (nearby.size () > max_neighbors_)
+  {
+    nearby.resize (max_neighbors_);
+  }
+
+  if (tracks_.size () < count)
+  {
+    Track empty;
+    empty.valid = false;
+    tracks_.resize (count, empty);
+  }
+
+  std::vector<Neighbor> neighbors;
+  neighbors.reserve (nearby.size ());
+  for (size_t i = 0; i < nearby.size (); ++i)
+  {
+    const size_t agent = nearby[i].agent;
+    pose::Position location (platform_frame);
+    Neighbor neighbor;
+    bool published;
+
+    if (view)
+    {
+      // the snapshot needs no containers bound for the neighbor
+      const variables::SwarmView::Snapshot & snapshot = view->get_snapshot ();
+      location = pose::Position (platform_frame, snapshot.location_x[agent],
+        snapshot.location_y[agent], snapshot.location_z[agent]);
+      neighbor.velocity = Eigen::Vector2d (snapshot.velocity_x[agent],
+        snapshot.velocity_y[agent]);
+      published = snapshot.has_velocity[agent] != 0;
+    }
+    else
+    {
+      location.from_container ((*agents_)[agent].location);
+      published = get_velocity ((*agents_)[agent], neighbor.velocity);
+    }
+
+    const Eigen::Vector3d local = to_local (location);
+    neighbor.position = Eigen::Vector2d (local.x (), local.y ());
+    if (!published)
+    {
+      neighbor.velocity =
+        update_track (tracks_[agent], neighbor.position, now);
+    }
+    neighbor.radius = radius_;
+    neighbors.push_back (neighbor);
+  }
+
+  const Eigen::Vector2d chosen = compute_velocity (position, velocity,
+    preferred, radius_, max_speed_, time_horizon_, time_step, neighbors);
+
+  if ((chosen - preferred).norm () <= 1e-3 * std::max (max_speed_, 1.0))
+  {
+    // nothing in the way, so let the algorithm's move stand
+    if (diverted_)
+    {
+      platform_->move (goal_, platform_->get_accuracy ());
+      diverted_ = false;
+    }
+    return 0;
+  }
+
+  const Eigen::Vector2d step = position + chosen * time_step;
+  pose::Position waypoint (frame_, step.x (), step.y (), here.z ());
+  command_ = pose::Position (platform_frame, waypoint);
+  command_.z (goal_.z ());
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MINOR,
+    "gams::algorithms::CollisionAvoidance::execute:" \
+    " %d neighbors in range, diverting from %s to %s\n",
+    (int)neighbors.size (), goal_.to_string ().c_str (),
+    command_.to_string ().c_str ());
+
+  platform_->move (command_, platform_->get_accuracy ());
+  diverted_ = true;
+  ++executions_;
+
+  return 0;
+}
+
+Eigen::Vector2d
+gams::algorithms::CollisionAvoidance::compute_velocity (
+  const Eigen::Vector2d & position,
+  const Eigen::Vector2d & velocity,
+  const Eigen::Vector2d & preferred,
+  double radius, double max_speed,
+  double time_horizon, double time_step,
+  const std::vector<Neighbor> & neighbors)
+{
+  const double inv_time_horizon = 1.0 / time_horizon;
+  std::vector<Line> lines;
+  lines.reserve (neighbors.size ());
+
+  for (size_t i = 0; i < neighbors.size (); ++i)
+  {
+    const Neighbor & other = neighbors[i];
+    const Eigen::Vector2d relative_position = other.position - position;
+    const Eigen::Vector2d relative_velocity = velocity - other.velocity;
+    const double dist_sq = relative_position.squaredNorm ();
+    const double combined_radius = radius + other.radius;
+    const double combined_radius_sq = combined_radius * combined_radius;
+
+    Line line;
+    Eigen::Vector2d u;
+
+    if (dist_sq > combined_radius_sq)
+    {
+      // no collision yet; w is from the cutoff circle's center to the
+      // relative velocity
+      const Eigen::Vector2d w =
+        relative_velocity - inv_time_horizon * relative_position;
+      const double w_length_sq = w.squaredNorm ();
+      const double dot1 = w.dot (relative_position);
+
+      if (dot1 < 0 && dot1 * dot1 > combined_radius_sq * w_length_sq)
+      {
+        // project on the cutoff circle
+        const double w_length = std::sqrt (w_length_sq);
+        const Eigen::Vector2d unit_w = w / w_length;
+        line.direction = Eigen::Vector2d (unit_w.y (), -unit_w.x ());
+        u = (combined_radius * inv_time_horizon - w_length) * unit_w;
+      }
+      else
+      {
+        // project on the nearer leg of the velocity obstacle cone
+        const double leg = std::sqrt (dist_sq - combined_radius_sq);
+        const double px = relative_position.x ();
+        const double py = relative_position.y ();
+
+        if (det (relative_position, w) > 0)
+        {
+          line.direction = Eigen::Vector2d (
+            px * leg - py * combined_radius,
+            px * combined_radius + py * leg) / dist_sq;
+        }
+        else
+        {
+          line.direction = -Eigen::Vector2d (
+            px * leg + py * combined_radius,
+            -px * combined_radius + py * leg) / dist_sq;
+        }
+
+        u = relative_velocity.dot (line.direction) * line.direction -
+          relative_velocity;
+      }
+    }
+    else
+    {
+      // already overlapping, so separate within one time step
+      const double inv_time_step = 1.0 / std::max (time_step, ORCA_EPSILON);
+      const Eigen::Vector2d w =
+        relative_velocity - inv_time_step * relative_position;
+      const double w_length = w.norm ();
+
+      if (w_length <= ORCA_EPSILON)
+      {
+        continue;
+      }
+
+      const Eigen::Vector2d unit_w = w / w_length;
+      line.direction = Eigen::Vector2d (unit_w.y (), -unit_w.x ());
+      u = (combined_radius * inv_time_step - w_length) * unit_w;
+    }
+
+    // each agent takes half of the avoidance
+    line.point = velocity + 0.5 * u;
+    lines.push_back (line);
+  }
+
+  Eigen::Vector2d result;
+  const size_t failed =
+    linear_program2 (lines, max_speed, preferred, false, result);
+
+  if (failed < lines.size ())
+  {
+    linear_program3 (lines, failed, max_speed, result);
+  }
+
+  return result;
+}
+
+const Eigen::Vector2d &
+gams::algorithms::CollisionAvoidance::update_track (Track & track,
+  const Eigen::Vector2d & position, double time)
+{
+  if (!track.valid)
+  {
+    track.velocity = Eigen::Vector2d::Zero ();
+    track.valid = true;
+  }
+  else if (time - track.time > 1e-3)
+  {
+    track.velocity = (position - track.position) / (time - track.time);
+  }
+  else
+  {
+    // too soon to tell a new velocity from noise
+    return track.velocity;
+  }
+
+  track.position = position;
+  track.time = time;
+  return track.velocity;
+}
+
+bool
+gams::algorithms::CollisionAvoidance::get_velocity (
+  const variables::Agent & agent, Eigen::Vector2d & velocity)
+{
+  if (agent.velocity.size () < 2)
+  {
+    return false;
+  }
+
+  velocity = Eigen::Vector2d (agent.velocity[0], agent.velocity[1]);
+  return true;
+}
+
+Eigen::Vector3d
+gams::algorithms::CollisionAvoidance::to_local (
+  const pose::Position & position) const
+{
+  pose::Position local = position.transform_to (frame_);
+  return Eigen::Vector3d (local.x (), local.y (), local.z ());
+}
+
+const std::string &
+gams::algorithms::CollisionAvoidance::get_prefix (size_t agent) const
+{
+  return swarm_view_ ?
+    swarm_view_->get_prefix (agent) : (*agents_)[agent].prefix;
+}
+
+size_t
+gams::algorithms::CollisionAvoidance::find_self (void) const
+{
+  const size_t count = swarm_view_ ? swarm_view_->size () : agents_->size ();
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (get_prefix (i) == self_->agent.prefix)
+    {
+      return i;
+    }
+  }
+
+  return variables::NeighborIndex::NO_AGENT;
+}
@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file CollisionAvoidance.h
+ *
+ * This file contains the definition of the CollisionAvoidance accent, which
+ * steers moves around nearby agents with reciprocal velocity obstacles
+ **/
+
+#ifndef   _GAMS_ALGORITHMS_COLLISION_AVOIDANCE_H_
+#define   _GAMS_ALGORITHMS_COLLISION_AVOIDANCE_H_
+
+#include <vector>
+
+#include "Eigen/Core"
+
+#include "gams/variables/Sensor.h"
+#include "gams/platforms/BasePlatform.h"
+#include "gams/variables/AlgorithmStatus.h"
+#include "gams/variables/Self.h"
+#include "gams/algorithms/BaseAlgorithm.h"
+#include "gams/algorithms/AlgorithmFactory.h"
+
+namespace gams
+{
+  namespace algorithms
+  {
+    /**
+    * An accent that adjusts the current move so this agent does not
+    * collide with nearby agents. Each loop it takes the agents within
+    * range from the controller's neighbor index, builds one ORCA
+    * (optimal reciprocal collision avoidance) half-plane per neighbor,
+    * and picks the allowed velocity closest to the one toward the
+    * algorithm's destination. The work per agent depends on the number
+    * of neighbors considered, not on the size of the swarm. Agents that
+    * publish a velocity are avoided using it; the velocities of others are
+    * estimated from their last two locations. Neighbors are read from the
+    * controller's swarm view if one is set, so no agent containers are
+    * bound. Avoidance is in the horizontal plane; altitude is left to the
+    * algorithm.
+    **/
+    class GAMS_EXPORT CollisionAvoidance : public BaseAlgorithm
+    {
+    public:
+      /**
+       * A nearby agent, as seen by compute_velocity
+       **/
+      struct Neighbor
+      {
+        /// horizontal position, in meters
+        Eigen::Vector2d position;
+
+        /// horizontal velocity, in meters per second
+        Eigen::Vector2d velocity;
+
+        /// radius, in meters
+        double radius;
+      };
+
+      /**
+       * Constructor
+       * @param  radius         radius of each agent, in meters
+       * @param  range          distance within which agents are avoided
+       * @param  max_neighbors  most neighbors considered per loop
+       * @param  time_horizon   seconds ahead that collisions are avoided
+       * @param  max_speed      fastest this agent may move, in m/s
+       * @param  knowledge      the context containing variables and values
+       * @param  platform       the underlying platform the algorithm will use
+       * @param  sensors        map of sensor names to sensor information
+       * @param  self           self-referencing variables
+       * @param  agents         list of agents in the swarm
+       **/
+      CollisionAvoidance (
+        double radius, double range, size_t max_neighbors,
+        double time_horizon, double max_speed,
+        madara::knowledge::KnowledgeBase * knowledge = 0,
+        platforms::BasePlatform * platform = 0,
+        variables::Sensors * sensors = 0,
+        variables::Self * self = 0,
+        variables::Agents * agents = 0);
+
+      /**
+       * Destructor
+       **/
+      ~CollisionAvoidance ();
+
+      /**
+       * Assignment operator
+       * @param  rhs   values to copy
+       **/
+      void operator= (const CollisionAvoidance & rhs);
+
+      /**
+       * Analyzes environment, platform, or other information
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int analyze (void);
+
+      /**
+       * Adjusts the platform's move, if a neighbor is in the way
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int execute (void);
+
+      /**
+       * Plans the next execution of the algorithm
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int plan (void);
+
+      /**
+       * Computes a collision-free velocity with ORCA. Each neighbor is
+       * assumed to take half of the responsibility for avoiding a
+       * collision, as it would if it also ran this accent.
+       * @param  position      this agent's position, in meters
+       * @param  velocity      this agent's current velocity, in m/s
+       * @param  preferred     the velocity this agent wants, in m/s
+       * @param  radius        this agent's radius, in meters
+       * @param  max_speed     fastest this agent may move, in m/s
+       * @param  time_horizon  seconds ahead that collisions are avoided
+       * @param  time_step     seconds until the velocity is next updated
+       * @param  neighbors     agents to avoid
+       * @return the allowed velocity closest to preferred
+       **/
+      static Eigen::Vector2d compute_velocity (
+        const Eigen::Vector2d & position,
+        const Eigen::Vector2d & velocity,
+        const Eigen::Vector2d & preferred,
+        double radius, double max_speed,
+        double time_horizon, double time_step,
+        const std::vector<Neighbor> & neighbors);
+
+    protected:
+      /**
+       * Position and velocity estimate of an agent, from its last location
+       **/
+      struct Track
+      {
+        /// last position seen, in meters in frame_
+        Eigen::Vector2d position;
+
+        /// velocity estimate, in meters per second
+        Eigen::Vector2d velocity;
+
+        /// when position was seen, in seconds
+        double time;
+
+        /// true if position has been seen
+        bool valid;
+      };
+
+      /**
+       * Updates a track with a new position and returns its velocity
+       **/
+      static const Eigen::Vector2d & update_track (Track & track,
+        const Eigen::Vector2d & position, double time);
+
+      /**
+       * Gets the velocity an agent publishes, which is in the axes of the
+       * platform frame (east and north for GPS), in meters per second
+       * @param  agent     the agent
+       * @param  velocity  set to the agent's horizontal velocity
+       * @return true if the agent publishes a velocity
+       **/
+      static bool get_velocity (const variables::Agent & agent,
+        Eigen::Vector2d & velocity);
+
+      /**
+       * Converts a position to meters in frame_
+       **/
+      Eigen::Vector3d to_local (const pose::Position & position) const;
+
+      /**
+       * Gets the prefix of an agent, from the swarm view if one is set
+       **/
+      const std::string & get_prefix (size_t agent) const;
+
+      /**
+       * Finds this agent's index in the swarm view, or in agents_ if no
+       * view is set
+       **/
+      size_t find_self (void) const;
+
+      /// radius of each agent, in meters
+      double radius_;
+
+      /// distance within which agents are avoided, in meters
+      double range_;
+
+      /// most neighbors considered per loop
+      size_t max_neighbors_;
+
+      /// seconds ahead that collisions are avoided
+      double time_horizon_;
+
+      /// fastest this agent may move, in meters per second
+      double max_speed_;
+
+      /// fixed Cartesian frame that positions are tracked in
+      pose::ReferenceFrame frame_;
+
+      /// true once frame_ has been anchored
+      bool frame_set_;
+
+      /// index of this agent in the swarm view or agents_
+      size_t self_index_;
+
+      /// velocity estimate for this agent
+      Track self_track_;
+
+      /// velocity estimates for other agents, by agent index
+      std::vector<Track> tracks_;
+
+      /// destination set by the algorithm
+      pose::Position goal_;
+
+      /// last destination set by this accent
+      pose::Position command_;
+
+      /// true if the platform is moving to command_ instead of goal_
+      bool diverted_;
+    };
+
+    /**
+     * A factory class for creating CollisionAvoidance accents
+     **/
+    class GAMS_EXPORT CollisionAvoidanceFactory : public AlgorithmFactory
+    {
+    public:
+
+      /**
+       * Creates a CollisionAvoidance accent.
+       * @param   args      args come in pairs. The first arg is the
+       *                    name of an arg. The second arg is the value
+       *                    of the arg.<br>
+       *                    radius = radius of each agent in meters (2)<br>
+       *                    range = avoid agents within this many
+       *                    meters (20)<br>
+       *                    max_neighbors = most neighbors considered (10)<br>
+       *                    time_horizon = seconds ahead collisions are
+       *                    avoided (5)<br>
+       *                    max_speed = fastest move in meters per
+       *                    second (5)
+       * @param   knowledge the knowledge base to use
+       * @param   platform  the platform. This will be set by the
+       *                    controller in init_vars.
+       * @param   sensors   the sensor info. This will be set by the
+       *                    controller in init_vars.
+       * @param   self      self-referencing variables. This will be
+       *                    set by the controller in init_vars
+       * @param   agents    the list of agents, which is dictated by
+       *                    init_vars when a number of processes is set. This
+       *                    will be set by the controller in init_vars
+       **/
+      virtual BaseAlgorithm * create (
+        const madara::knowledge::KnowledgeMap & args,
+        madara::knowledge::KnowledgeBase * knowledge,
+        platforms::BasePlatform * platform,
+        variables::Sensors * sensors,
+        variables::Self * self,
+        variables::Agents * agents);
+    };
+  }
+}
+
+#endif // _GAMS_ALGORITHMS_COLLISION_AVOIDANCE_H_
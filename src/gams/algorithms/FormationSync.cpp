@@ -91,6 +91,7 @@ variables::Agents * /*agents*/)
     pose::Position end (platform->get_frame());
 
     int formation_type = FormationSync::LINE;
+    int assignment = FormationSync::ASSIGN_BY_INDEX;
     double buffer = 5.0;
     std::string group = "";
     std::string barrier = "barrier.formation_sync";
@@ -102,6 +103,42 @@ variables::Agents * /*agents*/)
 
       switch (i->first[0])
       {
+      case 'a':
+        if (i->first == "assignment")
+        {
+          std::string assignment_str = i->second.to_string ();
+
+          madara::utility::upper (assignment_str);
+
+          if (assignment_str == "TOTAL")
+          {
+            assignment = FormationSync::ASSIGN_BY_TOTAL;
+          }
+          else if (assignment_str == "MAKESPAN")
+          {
+            assignment = FormationSync::ASSIGN_BY_MAKESPAN;
+          }
+          else
+          {
+            if (assignment_str != "INDEX")
+            {
+              madara_logger_ptr_log (gams::loggers::global_logger.get (),
+                gams::loggers::LOG_WARNING,
+                "gams::algorithms::FormationSyncFactory:" \
+                " unknown assignment %s. Assigning by index\n",
+                i->second.to_string ().c_str ());
+            }
+
+            assignment = FormationSync::ASSIGN_BY_INDEX;
+          }
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::FormationSyncFactory:" \
+            " setting assignment to %d\n", assignment);
+          break;
+        }
+        goto unknown;
       case 'b':
         if (i->first == "barrier")
         {
@@ -267,7 +304,7 @@ variables::Agents * /*agents*/)
     }
 
     result = new FormationSync (start, end, group, buffer,
-      formation_type, barrier,
+      formation_type, barrier, assignment,
       knowledge, platform, sensors, self);
   }
 
@@ -281,6 +318,7 @@ gams::algorithms::FormationSync::FormationSync (
   double buffer,
   int formation,
   const std::string & barrier_name,
+  int assignment,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform,
   variables::Sensors * sensors,
@@ -289,7 +327,8 @@ gams::algorithms::FormationSync::FormationSync (
   end_ (end),
   group_factory_ (knowledge),
   group_ (0),
-  buffer_ (buffer), formation_ (formation)
+  buffer_ (buffer), formation_ (formation), assignment_ (assignment),
+  assignment_key_ (barrier_name + ".assignment")
 {
   status_.init_vars (*knowledge, "formation_sync", self->agent.prefix);
   status_.init_variable_values ();
@@ -330,12 +369,16 @@ gams::algorithms::FormationSync::FormationSync (
     " start=%s, end=%s, buffer=%.2f, formation=%d\n",
     start.to_string ().c_str (), end.to_string ().c_str (), buffer, formation);
 
+  // members agree on their index before positions are assigned, so the
+  // barrier is by index
+  const int member = position_;
+
   generate_plan (formation);
 
-  if (position_ >= 0)
+  if (member >= 0)
   {
     barrier_.set_name (barrier_name, *knowledge,
-      position_, (int)group_members_.size ());
+      member, (int)group_members_.size ());
     barrier_.set (0);
     //barrier_.next ();
   }
@@ -359,8 +402,8 @@ gams::algorithms::FormationSync::generate_plan (int formation)
     "gams::algorithms::FormationSync::constructor:" \
     " Generating plan\n");
 
-  position_ = groups::find_member_index (
-    self_->agent.prefix, group_members_);
+  position_ = group_ ?
+    group_->get_member_index (self_->agent.prefix) : -1;
 
   madara_logger_ptr_log (gams::loggers::global_logger.get (),
     gams::loggers::LOG_MINOR,
@@ -409,252 +452,35 @@ gams::algorithms::FormationSync::generate_plan (int formation)
       " %.3f m in %d longitude moves\n",
       latitude_move, x_moves, longitude_move, y_moves);
 
-    // a cartesian movement offset
-    utility::Position movement;
-
-    // the initial position for this specific agent
-    pose::Position init (platform_->get_frame ());
-    pose::Position position_end (platform_->get_frame ());
-
-    if (formation == TRIANGLE)
-    {
-      madara_logger_ptr_log (gams::loggers::global_logger.get (),
-        gams::loggers::LOG_MINOR,
-        "gams::algorithms::FormationSync::constructor:" \
-        " Formation type is TRIANGLE\n");
+    static const char * formation_names[] = {
+      "PYRAMID", "TRIANGLE", "RECTANGLE", "CIRCLE", "LINE", "WING"};
 
-      /**
-      * the offset in the line has an open space between each process
-      * [0] [ ] [1] [ ] [2] [ ] n / 2 agents = row
-      * [ ] [3] [ ] [4] row - 1 agents
-      * [5] row - 2 agents
-      * initial position will be ref + position * buffer
-      **/
-
-      // first row
-      if (position_ <= (int)group_members_.size () / 2)
-      {
-        movement.x = position_ * latitude_move * 2;
-        movement.y = 0;
-      }
-      else
-      {
-        bool position_found = false;
-        int row_length = (int)group_members_.size () / 4;
-        int last_position = (int)group_members_.size () / 2;
-        for (int row = 1; !position_found; ++row, last_position += row_length, row_length /= 2)
-        {
-          if (row_length < 1)
-            row_length = 1;
-
-          if (position_ <= last_position + row_length)
-          {
-            int column = position_ - last_position - 1;
-            position_found = true;
-
-            // stagger the rows for a seamless buffer space for neighbor rows
-            if (row % 2 == 0)
-            {
-              movement.x = column * latitude_move * 2;
-            }
-            else
-            {
-              movement.x = latitude_move + column * latitude_move * 2;
-            }
-            movement.y = row * longitude_move;
-          }
-        }
-      }
-    }
-    else if (formation == PYRAMID)
-    {
-      madara_logger_ptr_log (gams::loggers::global_logger.get (),
-        gams::loggers::LOG_MINOR,
-        "gams::algorithms::FormationSync::constructor:" \
-        " Formation type is PYRAMID\n");
-
-      // the initial position where the first two moves will be for this agent
-      movement.x = position_ * latitude_move * 2;
-      movement.y = 0;
-    }
-    else if (formation == RECTANGLE)
-    {
-      madara_logger_ptr_log (gams::loggers::global_logger.get (),
-        gams::loggers::LOG_MINOR,
-        "gams::algorithms::FormationSync::constructor:" \
-        " Formation type is RECTANGLE\n");
-
-      /**
-      * the offset in the line has an open space between each process
-      * [0] [ ] [1] [ ]
-      * [ ] [2] [ ] [3]
-      * [4] [ ] [5] [ ]
-      * initial position will be ref + position * buffer
-      **/
-
-      double num_rows = std::sqrt ((double)group_members_.size ());
-      int column (0), row (0);
-
-      column = position_ % (int)num_rows;
-      row = position_ / (int)num_rows;
-
-      // the initial position where the first two moves will be for this agent
-      if (row % 2 == 0)
-      {
-        movement.x = column * latitude_move * 2;
-      }
-      else
-      {
-        movement.x = latitude_move + column * latitude_move * 2;
-      }
-      movement.y = row * longitude_move;
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MINOR,
+      "gams::algorithms::FormationSync::constructor:" \
+      " Formation type is %s\n",
+      formation >= PYRAMID && formation <= WING ?
+        formation_names[formation] : "LINE");
 
-    }
-    else if (formation == CIRCLE)
+    if (assignment_ != ASSIGN_BY_INDEX &&
+      !assign_position (start_frame, formation, latitude_move, longitude_move))
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MINOR,
         "gams::algorithms::FormationSync::constructor:" \
-        " Formation type is CIRCLE\n");
+        " %s is waiting for %s\n",
+        self_->agent.prefix.c_str (), assignment_key_.c_str ());
 
-      // the initial position where the first two moves will be for this agent
-      movement.x = position_ * latitude_move * 2;
-      movement.y = 0;
+      return;
     }
-    else if (formation == WING)
-    {
-      madara_logger_ptr_log (gams::loggers::global_logger.get (),
-        gams::loggers::LOG_MINOR,
-        "gams::algorithms::FormationSync::constructor:" \
-        " Formation type is WING\n");
-
-      /**
-      [ 0][  ][  ] if size % 2 == 1
-      [  ][ 1][  ]   cols = size / 2 + 1
-      [  ][  ][ 2]   col = position % cols
-      [  ][ 3][  ]   row = position
-      [ 4][  ][  ]
-
-      else // even, 2 and 4 are outliers
-
-      [ 0][  ][  ] if position != size - 1
-      [  ][ 1][  ]   cols = size / 2
-      [ 5][  ][ 2]   row = position
-      [  ][ 3][  ]   col = position % cols
-      [ 4][  ][  ] else
-      if (size == 4)
-      row = col = 2
-      else
-      row = size / 2
-      if size != 2
-      col = 0
-      else
-      col = 1
-      **/
-
-
-      int col, row;
-
-      // if size is odd
-      if (group_members_.size () % 2 == 1)
-      {
-        /**
-         * size = 5, cols = 3
-         * [0][ ][ ] pos = 0, row = 0, col = 0
-         * [ ][1][ ] pos = 1, row = 1, col = 1
-         * [ ][ ][2] pos = 2, row = 2, col = 2
-         * [ ][3][ ] pos = 3, row = 3, col = 3 - 3 % 3 - 2 = 1
-         * [4][ ][ ] pos = 4, row = 4, col = 3 - 4 % 3 - 2 = 3 - 1 - 2 = 0
-         **/
-        int cols = (int)group_members_.size () / 2 + 1;
-        if (position_ >= cols)
-        {
-          col = cols - position_ % cols - 2;
-        }
-        else
-        {
-          col = position_ % cols;
-        }
-        row = position_;
-      }
-      // if size is even
-      else
-      {
-        // handle everything before last position first
-        if (position_ != (int)group_members_.size () - 1)
-        {
-          /**
-          * size = 6, cols = 3
-          * [0][ ][ ] pos = 0, row = 0, col = 0
-          * [ ][1][ ] pos = 1, row = 1, col = 1
-          * [ ][ ][2] pos = 2, row = 2, col = 2
-          * [ ][3][ ] pos = 3, row = 3, col = 3 - 3 % 3 - 2 = 1
-          * [4][ ][ ] pos = 4, row = 4, col = 3 - 4 % 3 - 2 = 3 - 1 - 2 = 0
-          **/
-          int cols = (int)group_members_.size () / 2;
-          row = position_;
 
-          if (position_ >= cols)
-          {
-            col = cols - position_ % cols - 2;
-          }
-          else
-          {
-            col = position_ % cols;
-          }
-        }
-        // handle the last position. 2 and 4 are outliers
-        else
-        {
-          // In size == 4, we create a wedge rather than wing
-          if (group_members_.size () == 4)
-          {
-            row = col = 2;
-          }
-          else
-          {
-            /**
-            * size = 6, cols = 3
-            * [0][ ][ ]
-            * [ ][1][ ]
-            * [5][ ][2] pos = 5, row = 2, col = 2
-            * [ ][3][ ]
-            * [4][ ][ ]
-            **/
-
-            // otherwise, we set the row to the middle of the formation
-            row = (int)group_members_.size () / 2 - 1;
-
-            // most formations will just use a drone at the far back and center
-            if (group_members_.size () != 2)
-            {
-              col = 0;
-            }
-            // size == 2 will just increment the col 
-            else
-            {
-              col = 1;
-            }
-          }
-        }
-      }
-
-      // the initial position where the first two moves will be for this agent
-      movement.x = col * latitude_move * 2;
-      movement.y = row * longitude_move * 2;
-    }
-    // default is LINE
-    else
-    {
-      madara_logger_ptr_log (gams::loggers::global_logger.get (),
-        gams::loggers::LOG_MINOR,
-        "gams::algorithms::FormationSync::constructor:" \
-        " Formation type is LINE\n");
+    // a cartesian movement offset
+    utility::Position movement (
+      get_offset (formation, position_, latitude_move, longitude_move));
 
-      // the initial position where the first two moves will be for this agent
-      movement.x = position_ * latitude_move * 2;
-      movement.y = 0;
-    }
+    // the initial position for this specific agent
+    pose::Position init (platform_->get_frame ());
+    pose::Position position_end (platform_->get_frame ());
 
     // the initial position for this specific agent
     pose::Position move_start = movement.to_pos (start_frame);
@@ -729,6 +555,320 @@ gams::algorithms::FormationSync::generate_plan (int formation)
   }
 }
 
+gams::utility::Position
+gams::algorithms::FormationSync::get_offset (int formation, int position,
+  double latitude_move, double longitude_move) const
+{
+  // a cartesian movement offset
+  utility::Position movement;
+
+  if (formation == TRIANGLE)
+  {
+    /**
+    * the offset in the line has an open space between each process
+    * [0] [ ] [1] [ ] [2] [ ] n / 2 agents = row
+    * [ ] [3] [ ] [4] row - 1 agents
+    * [5] row - 2 agents
+    * initial position will be ref + position * buffer
+    **/
+
+    // first row
+    if (position <= (int)group_members_.size () / 2)
+    {
+      movement.x = position * latitude_move * 2;
+      movement.y = 0;
+    }
+    else
+    {
+      bool position_found = false;
+      int row_length = (int)group_members_.size () / 4;
+      int last_position = (int)group_members_.size () / 2;
+      for (int row = 1; !position_found; ++row, last_position += row_length, row_length /= 2)
+      {
+        if (row_length < 1)
+          row_length = 1;
+
+        if (position <= last_position + row_length)
+        {
+          int column = position - last_position - 1;
+          position_found = true;
+
+          // stagger the rows for a seamless buffer space for neighbor rows
+          if (row % 2 == 0)
+          {
+            movement.x = column * latitude_move * 2;
+          }
+          else
+          {
+            movement.x = latitude_move + column * latitude_move * 2;
+          }
+          movement.y = row * longitude_move;
+        }
+      }
+    }
+  }
+  else if (formation == PYRAMID)
+  {
+    // the initial position where the first two moves will be for this agent
+    movement.x = position * latitude_move * 2;
+    movement.y = 0;
+  }
+  else if (formation == RECTANGLE)
+  {
+    /**
+    * the offset in the line has an open space between each process
+    * [0] [ ] [1] [ ]
+    * [ ] [2] [ ] [3]
+    * [4] [ ] [5] [ ]
+    * initial position will be ref + position * buffer
+    **/
+
+    double num_rows = std::sqrt ((double)group_members_.size ());
+    int column (0), row (0);
+
+    column = position % (int)num_rows;
+    row = position / (int)num_rows;
+
+    // the initial position where the first two moves will be for this agent
+    if (row % 2 == 0)
+    {
+      movement.x = column * latitude_move * 2;
+    }
+    else
+    {
+      movement.x = latitude_move + column * latitude_move * 2;
+    }
+    movement.y = row * longitude_move;
+
+  }
+  else if (formation == CIRCLE)
+  {
+    // the initial position where the first two moves will be for this agent
+    movement.x = position * latitude_move * 2;
+    movement.y = 0;
+  }
+  else if (formation == WING)
+  {
+    /**
+    [ 0][  ][  ] if size % 2 == 1
+    [  ][ 1][  ]   cols = size / 2 + 1
+    [  ][  ][ 2]   col = position % cols
+    [  ][ 3][  ]   row = position
+    [ 4][  ][  ]
+
+    else // even, 2 and 4 are outliers
+
+    [ 0][  ][  ] if position != size - 1
+    [  ][ 1][  ]   cols = size / 2
+    [ 5][  ][ 2]   row = position
+    [  ][ 3][  ]   col = position % cols
+    [ 4][  ][  ] else
+    if (size == 4)
+    row = col = 2
+    else
+    row = size / 2
+    if size != 2
+    col = 0
+    else
+    col = 1
+    **/
+
+
+    int col, row;
+
+    // if size is odd
+    if (group_members_.size () % 2 == 1)
+    {
+      /**
+       * size = 5, cols = 3
+       * [0][ ][ ] pos = 0, row = 0, col = 0
+       * [ ][1][ ] pos = 1, row = 1, col = 1
+       * [ ][ ][2] pos = 2, row = 2, col = 2
+       * [ ][3][ ] pos = 3, row = 3, col = 3 - 3 % 3 - 2 = 1
+       * [4][ ][ ] pos = 4, row = 4, col = 3 - 4 % 3 - 2 = 3 - 1 - 2 = 0
+       **/
+      int cols = (int)group_members_.size () / 2 + 1;
+      if (position >= cols)
+      {
+        col = cols - position % cols - 2;
+      }
+      else
+      {
+        col = position % cols;
+      }
+      row = position;
+    }
+    // if size is even
+    else
+    {
+      // handle everything before last position first
+      if (position != (int)group_members_.size () - 1)
+      {
+        /**
+        * size = 6, cols = 3
+        * [0][ ][ ] pos = 0, row = 0, col = 0
+        * [ ][1][ ] pos = 1, row = 1, col = 1
+        * [ ][ ][2] pos = 2, row = 2, col = 2
+        * [ ][3][ ] pos = 3, row = 3, col = 3 - 3 % 3 - 2 = 1
+        * [4][ ][ ] pos = 4, row = 4, col = 3 - 4 % 3 - 2 = 3 - 1 - 2 = 0
+        **/
+        int cols = (int)group_members_.size () / 2;
+        row = position;
+
+        if (position >= cols)
+        {
+          col = cols - position % cols - 2;
+        }
+        else
+        {
+          col = position % cols;
+        }
+      }
+      // handle the last position. 2 and 4 are outliers
+      else
+      {
+        // In size == 4, we create a wedge rather than wing
+        if (group_members_.size () == 4)
+        {
+          row = col = 2;
+        }
+        else
+        {
+          /**
+          * size = 6, cols = 3
+          * [0][ ][ ]
+          * [ ][1][ ]
+          * [5][ ][2] pos = 5, row = 2, col = 2
+          * [ ][3][ ]
+          * [4][ ][ ]
+          **/
+
+          // otherwise, we set the row to the middle of the formation
+          row = (int)group_members_.size () / 2 - 1;
+
+          // most formations will just use a drone at the far back and center
+          if (group_members_.size () != 2)
+          {
+            col = 0;
+          }
+          // size == 2 will just increment the col 
+          else
+          {
+            col = 1;
+          }
+        }
+      }
+    }
+
+    // the initial position where the first two moves will be for this agent
+    movement.x = col * latitude_move * 2;
+    movement.y = row * longitude_move * 2;
+  }
+  // default is LINE
+  else
+  {
+    // the initial position where the first two moves will be for this agent
+    movement.x = position * latitude_move * 2;
+    movement.y = 0;
+  }
+
+  return movement;
+}
+
+bool
+gams::algorithms::FormationSync::assign_position (
+  const pose::ReferenceFrame & start_frame, int formation,
+  double latitude_move, double longitude_move)
+{
+  const size_t count = group_members_.size ();
+
+  std::vector <Integer> assigned;
+  if (knowledge_->exists (assignment_key_))
+  {
+    assigned = knowledge_->get (assignment_key_).to_integers ();
+  }
+
+  // the first member assigns positions for everyone, so all members agree
+  // even if they see different locations
+  if (position_ == 0 && assigned.size () != count)
+  {
+    assigned.resize (count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      assigned[i] = (Integer)i;
+    }
+
+    std::vector <pose::Position> locations;
+    std::vector <pose::Position> slots;
+
+    locations.reserve (count);
+    slots.reserve (count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      std::vector <double> coords (
+        knowledge_->get (group_members_[i] + ".location").to_doubles ());
+
+      if (coords.size () < 2)
+      {
+        madara_logger_ptr_log (gams::loggers::global_logger.get (),
+          gams::loggers::LOG_MAJOR,
+          "gams::algorithms::FormationSync::assign_position:" \
+          " %s has no location. Assigning positions by member index\n",
+          group_members_[i].c_str ());
+
+        locations.clear ();
+        break;
+      }
+
+      locations.push_back (pose::Position (platform_->get_frame (),
+        coords[0], coords[1], coords.size () > 2 ? coords[2] : 0.0));
+
+      // starting slot of the i-th position, in the platform's frame
+      pose::Position slot = get_offset (formation, (int)i,
+        latitude_move, longitude_move).to_pos (start_frame);
+      slots.push_back (slot.transform_to (platform_->get_frame ()));
+    }
+
+    if (locations.size () == count)
+    {
+      utility::SlotAssignment assignment (
+        assignment_ == ASSIGN_BY_MAKESPAN ?
+        utility::SlotAssignment::MAKESPAN : utility::SlotAssignment::TOTAL);
+
+      const std::vector <int> & solved = assignment.solve (locations, slots);
+      for (size_t i = 0; i < count; ++i)
+      {
+        assigned[i] = solved[i];
+      }
+
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MINOR,
+        "gams::algorithms::FormationSync::assign_position:" \
+        " group travels %.3f m in total, at most %.3f m per agent\n",
+        assignment.get_total (), assignment.get_makespan ());
+    }
+
+    knowledge_->set (assignment_key_, assigned);
+  }
+
+  if (assigned.size () != count || position_ < 0 ||
+    position_ >= (int)count)
+  {
+    return false;
+  }
+
+  position_ = (int)assigned[position_];
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MINOR,
+    "gams::algorithms::FormationSync::assign_position:" \
+    " %s is assigned position %d\n",
+    self_->agent.prefix.c_str (), position_);
+
+  return true;
+}
+
 gams::pose::Position
 gams::algorithms::FormationSync::generate_position (pose::Position reference,
 double angle, double distance)
@@ -762,6 +902,8 @@ gams::algorithms::FormationSync::operator= (const FormationSync & rhs)
     }
     group_members_ = rhs.group_members_;
     buffer_ = rhs.buffer_;
+    assignment_ = rhs.assignment_;
+    assignment_key_ = rhs.assignment_key_;
     barrier_ = rhs.barrier_;
   }
 }
@@ -783,6 +925,26 @@ gams::algorithms::FormationSync::analyze (void)
 
       barrier_.modify ();
 
+      if (assignment_ != ASSIGN_BY_INDEX)
+      {
+        // members plan once the first member has assigned positions
+        if (plan_.empty ())
+        {
+          generate_plan (formation_);
+        }
+
+        // and it resends the assignment until the formation starts moving,
+        // for members that join late
+        if (round == 0 && !group_members_.empty () &&
+          group_members_[0] == self_->agent.prefix)
+        {
+          knowledge_->mark_modified (knowledge_->get_ref (assignment_key_));
+        }
+      }
+
+      // catch up on rounds that did not come through BarrierEvents
+      barrier_.update ();
+
       if (round < (int)plan_.size ())
       {
         madara_logger_ptr_log (gams::loggers::global_logger.get (),
@@ -834,7 +996,8 @@ gams::algorithms::FormationSync::analyze (void)
             madara_logger_ptr_log (gams::loggers::global_logger.get (),
               gams::loggers::LOG_MINOR,
               "gams::algorithms::FormationSync::analyze:" \
-              " %d: waiting barrier complete, ready to move.\n", position_);
+              " %d: waiting barrier complete after %.3f ms," \
+              " ready to move.\n", position_, barrier_.get_latency () * 1000);
 
             barrier_.next ();
           }
@@ -901,7 +1064,15 @@ gams::algorithms::FormationSync::execute (void)
       // state is moving if 0 and waiting for barrier if 1
       int state = (int)barrier_.get_round () % 2;
 
-      if (move < (int)plan_.size ())
+      if (plan_.empty ())
+      {
+        madara_logger_ptr_log (gams::loggers::global_logger.get (),
+          gams::loggers::LOG_MINOR,
+          "gams::algorithms::FormationSync::execute:" \
+          " %s is waiting for %s. Not moving.\n",
+          self_->agent.prefix.c_str (), assignment_key_.c_str ());
+      }
+      else if (move < (int)plan_.size ())
       {
         if (move < move_pivot_)
         {
@@ -63,9 +63,11 @@
 #include "gams/variables/Self.h"
 #include "gams/algorithms/BaseAlgorithm.h"
 #include "gams/algorithms/AlgorithmFactory.h"
+#include "gams/utility/EventBarrier.h"
 #include "madara/knowledge/containers/Integer.h"
-#include "madara/knowledge/containers/Barrier.h"
 #include "gams/groups/GroupFactoryRepository.h"
+#include "gams/utility/Position.h"
+#include "gams/utility/SlotAssignment.h"
 
 namespace gams
 {
@@ -92,6 +94,19 @@ namespace gams
         WING
       };
 
+      /**
+       * Ways of assigning group members to formation positions
+       **/
+      enum AssignmentTypes
+      {
+        /// position is the member's index in the group
+        ASSIGN_BY_INDEX,
+        /// minimize the total distance to the starting positions
+        ASSIGN_BY_TOTAL,
+        /// minimize the longest distance to a starting position
+        ASSIGN_BY_MAKESPAN
+      };
+
       /**
        * Constructor
        * @param  start        the starting center of the formation
@@ -101,6 +116,8 @@ namespace gams
        *                      meters
        * @param  formation    type of formation (@see FormationTypes)
        * @param  barrier_name the barrier name to synchronize on
+       * @param  assignment   how members are assigned to positions
+       *                      (@see AssignmentTypes)
        * @param  knowledge    the context containing variables and values
        * @param  platform     the underlying platform the algorithm will use
        * @param  sensors      map of sensor names to sensor information
@@ -113,6 +130,7 @@ namespace gams
         double buffer,
         int formation,
         const std::string & barrier_name,
+        int assignment,
         madara::knowledge::KnowledgeBase * knowledge = 0,
         platforms::BasePlatform * platform = 0,
         variables::Sensors * sensors = 0,
@@ -149,11 +167,37 @@ namespace gams
       
     protected:
       /**
-       * Generates the full plan
+       * Generates the full plan. The plan stays empty until positions
+       * have been assigned, @see assign_position.
        * @param formation  the type of formation. @see FormationTypes
        **/
       void generate_plan (int formation);
 
+      /**
+       * Computes the offset of a position from the formation center
+       * @param formation      the type of formation. @see FormationTypes
+       * @param position       the position in the formation
+       * @param latitude_move  signed length of a latitude move in meters
+       * @param longitude_move signed length of a longitude move in meters
+       * @return  the offset in meters
+       **/
+      utility::Position get_offset (int formation, int position,
+        double latitude_move, double longitude_move) const;
+
+      /**
+       * Reassigns position_ so members travel the least to their starting
+       * positions. The group's first member solves the assignment and
+       * publishes it for the rest, so all members agree. It assigns by
+       * member index if any member has no location.
+       * @param start_frame    frame centered on the formation start
+       * @param formation      the type of formation. @see FormationTypes
+       * @param latitude_move  signed length of a latitude move in meters
+       * @param longitude_move signed length of a longitude move in meters
+       * @return true if assigned, false if the assignment has not arrived
+       **/
+      bool assign_position (const pose::ReferenceFrame & start_frame,
+        int formation, double latitude_move, double longitude_move);
+
       /**
        * Generates a position at an angle and distance
        * @param reference  the reference position
@@ -191,11 +235,17 @@ namespace gams
       /// position in member assignment
       int position_;
 
+      /// how members are assigned to positions
+      int assignment_;
+
+      /// where the first member publishes each member's position
+      std::string assignment_key_;
+
       /// the move total before a pivot. Used for debugging
       int move_pivot_;
 
       /// movement barrier
-      madara::knowledge::containers::Barrier barrier_;
+      utility::EventBarrier barrier_;
     };
     
     /**
@@ -216,7 +266,11 @@ namespace gams
        *                    buffer = buffer of the formation in meters<br>
        *                    formation = enum
        *                    @see FormationSync::FormationTypes<br>
-       *                    barrier = unused variable to serve as barrier
+       *                    barrier = unused variable to serve as barrier<br>
+       *                    assignment = index (default), total, or makespan.
+       *                    The first member publishes the assignment in
+       *                    {barrier}.assignment
+       *                    @see FormationSync::AssignmentTypes
        * @param   knowledge the knowledge base to use
        * @param   platform  the platform. This will be set by the
        *                    controller in init_vars.
@@ -283,13 +283,18 @@ gams::algorithms::GroupBarrier::analyze (void)
 
     barrier_.modify ();
 
+    // catch up on rounds that did not come through BarrierEvents
+    barrier_.update ();
+
     if (barrier_.is_done ())
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MINOR,
         "gams::algorithms::GroupBarrier::analyze:" \
-        " %d: Round %d: Proceeding to next barrier round\n",
-        position_, round);
+        " %d: Round %d: Proceeding to next barrier round" \
+        " (latency %.3f ms, mean %.3f ms)\n",
+        position_, round, barrier_.get_latency () * 1000,
+        barrier_.get_mean_latency () * 1000);
 
       if (enforcer_.has_reached_next ())
       {
@@ -64,8 +64,8 @@
 #include "gams/algorithms/BaseAlgorithm.h"
 #include "gams/utility/GPSPosition.h"
 #include "gams/algorithms/AlgorithmFactory.h"
+#include "gams/utility/EventBarrier.h"
 #include "madara/knowledge/containers/Integer.h"
-#include "madara/knowledge/containers/Barrier.h"
 #include "madara/utility/EpochEnforcer.h"
 
 namespace gams
@@ -144,7 +144,7 @@ namespace gams
       int position_;
 
       /// movement barrier
-      madara::knowledge::containers::Barrier barrier_;
+      utility::EventBarrier barrier_;
 
       /// enforcer of barrier times
       madara::utility::EpochEnforcer<std::chrono::steady_clock> enforcer_;
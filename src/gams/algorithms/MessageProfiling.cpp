@@ -46,10 +46,12 @@
 
 #include "gams/algorithms/MessageProfiling.h"
 
+#include <chrono>
 #include <iostream>
 #include <sstream>
 
 #include "gams/utility/ArgumentParser.h"
+#include "madara/utility/Utility.h"
 
 using std::stringstream;
 using std::string;
@@ -129,7 +131,8 @@ gams::algorithms::MessageProfiling::MessageProfiling (
     knowledge_->get (".id").to_string ();
   data_.set_name (key + ".data", *local_knowledge_);
   data_ = string (size - 1, 'a'); // set value, will never change
-  //count_.set_name (key + ".count", *knowledge);
+  count_.set_name (key + ".count", *local_knowledge_);
+  sent_.set_name (key + ".sent", *local_knowledge_);
 }
 
 gams::algorithms::MessageProfiling::~MessageProfiling ()
@@ -137,29 +140,7 @@ gams::algorithms::MessageProfiling::~MessageProfiling ()
   delete local_knowledge_;
   local_knowledge_ = 0;
 
-//  for (map<string, MessageFilter::MessageData>::const_reference map_item : 
-//    filter_.msg_map)
-  for (map<string, size_t>::const_reference map_item : filter_.msg_map)
-  {
-//    size_t first = map_item.second.first;
-//    size_t last = map_item.second.last;
-//    size_t expected = last - first + 1;
-//    size_t found = 0;
-//    for (size_t i = first; i <= last; ++i)
-//      if (map_item.second.present[i])
-//        ++found;
-//
-//    double percent_missing = (expected - found) / double(expected);
-
-    const string prefix = key_prefix_ + "." + map_item.first + ".";
-    //knowledge_->set(prefix + "first", 
-    //  madara::knowledge::KnowledgeRecord::Integer (map_item.second.first));
-    //knowledge_->set(prefix + "last", 
-    //  madara::knowledge::KnowledgeRecord::Integer (map_item.second.last));
-    //knowledge_->set(prefix + "missing", percent_missing);
-    knowledge_->set(prefix + "count", 
-      madara::knowledge::KnowledgeRecord::Integer (map_item.second));
-  }
+  filter_.to_knowledge (*knowledge_, key_prefix_);
 }
 
 void
@@ -186,6 +167,8 @@ gams::algorithms::MessageProfiling::operator= (
 int
 gams::algorithms::MessageProfiling::analyze (void)
 {
+  filter_.to_knowledge (*knowledge_, key_prefix_);
+
   return OK;
 }
 
@@ -195,7 +178,9 @@ gams::algorithms::MessageProfiling::execute (void)
   ++executions_;
 
   data_.modify ();
-  //count_ = executions_;
+  count_ = executions_;
+  sent_ = std::chrono::duration_cast<std::chrono::nanoseconds> (
+    std::chrono::system_clock::now ().time_since_epoch ()).count ();
   local_knowledge_->send_modifieds ();
 
   return 0;
@@ -208,82 +193,196 @@ gams::algorithms::MessageProfiling::plan (void)
   return 0;
 }
 
+gams::algorithms::MessageProfiling::MessageFilter::MessageData::MessageData ()
+  : first (-1), last (-1), received (0), duplicates (0), late (0),
+    latency_total (0), latency_max (0)
+{
+  present.fill (0);
+  latencies.fill (0);
+}
+
 gams::algorithms::MessageProfiling::MessageFilter::~MessageFilter ()
 {
 }
 
 void
 gams::algorithms::MessageProfiling::MessageFilter::filter (
-  madara::knowledge::KnowledgeMap& /*records*/, 
+  madara::knowledge::KnowledgeMap& records, 
   const madara::transport::TransportContext& transport_context, 
   madara::knowledge::Variables& /*var*/)
 {
   const string origin = transport_context.get_originator ();
-  if (msg_map.find (origin) == msg_map.end ())
-    msg_map[origin] = 0;
-  size_t& data = msg_map[origin];
-  ++data;
-
-//  // get data struct
-//  const string origin = transport_context.get_originator ();
-//  MessageData& data = msg_map[origin];
-//
-//  // loop through each update
-//  for (madara::knowledge::KnowledgeMap::const_iterator iter = records.begin();
-//	      iter != records.end(); ++iter)
-//  {
-//    madara::knowledge::KnowledgeMap::const_reference update = *iter;
-//
-//    // we only care about specific messages
-//    if (update.second.is_integer_type () && 
-//        update.first.find (key_prefix_) == 0 && 
-//        update.first.find ("count") != std::string::npos)
-//    {
-//      // get msg number
-//      size_t msg_num = update.second.to_integer ();
-//
-//      // is this the first?
-//      if (data.first == -1)
-//      {
-//        data.first = msg_num;
-//        data.last = msg_num;
-//      }
-//      // is this a previously missing message?
-//      else if (msg_num < data.last)
-//      {
-//        // is this earlier than first?
-//        if (msg_num < data.first)
-//          data.first = msg_num;
-//      }
-//      else // this could only be a new message past last
-//      {
-//        data.last = msg_num;
-//      }
-//
-//      if (data.present.size() <= msg_num)
-//        data.present.reserve (msg_num * 2);
-//      data.present [msg_num] = true;
-//    }
-//  }
+
+  // find the counter and send time of the profiling message, if present
+  int64_t id = -1;
+  int64_t sent = -1;
+  for (madara::knowledge::KnowledgeMap::const_iterator iter = records.begin ();
+       iter != records.end (); ++iter)
+  {
+    if (iter->first.compare (0, key_prefix_.size (), key_prefix_) != 0)
+      continue;
+
+    if (madara::utility::ends_with (iter->first, ".count"))
+      id = iter->second.to_integer ();
+    else if (madara::utility::ends_with (iter->first, ".sent"))
+      sent = iter->second.to_integer ();
+  }
+
+  if (id < 0)
+    return;
+
+  int64_t latency = -1;
+  if (sent > 0)
+  {
+    // only meaningful if sender and receiver clocks are synchronized
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds> (
+      std::chrono::system_clock::now ().time_since_epoch ()).count ();
+    latency = now > sent ? (now - sent) / 1000 : 0;
+  }
+
+  add (origin, id, latency);
+}
+
+void
+gams::algorithms::MessageProfiling::MessageFilter::add (
+  const std::string & origin, int64_t id, int64_t latency)
+{
+  std::lock_guard<std::mutex> guard (msg_mutex);
+  MessageData & data = msg_map[origin];
+
+  const int64_t window = (int64_t)WINDOW;
+  const size_t bit = (size_t)(id % window);
+  uint64_t & word = data.present[bit / 64];
+  const uint64_t mask = (uint64_t)1 << (bit % 64);
+
+  if (data.first < 0)
+  {
+    data.first = id;
+    data.last = id;
+  }
+  else if (id > data.last)
+  {
+    // ids skipped over by the jump stay clear, i.e. missing
+    if (id - data.last >= window)
+      data.present.fill (0);
+    else
+    {
+      for (int64_t i = data.last + 1; i < id; ++i)
+      {
+        const size_t skipped = (size_t)(i % window);
+        data.present[skipped / 64] &= ~((uint64_t)1 << (skipped % 64));
+      }
+      word &= ~mask;
+    }
+    data.last = id;
+  }
+  else if (id <= data.last - window)
+  {
+    // out of the window, so we can't tell if it is a duplicate
+    ++data.late;
+    if (id < data.first)
+      data.first = id;
+    return;
+  }
+  else if (word & mask)
+  {
+    ++data.duplicates;
+    return;
+  }
+  else if (id < data.first)
+  {
+    data.first = id;
+  }
+
+  word |= mask;
+  ++data.received;
+
+  if (latency >= 0)
+  {
+    size_t bucket = 0;
+    for (int64_t i = latency; i > 0 && bucket + 1 < BUCKETS; i >>= 1)
+      ++bucket;
+
+    ++data.latencies[bucket];
+    data.latency_total += (double)latency;
+    if (latency > data.latency_max)
+      data.latency_max = latency;
+  }
 }
 
 string
 gams::algorithms::MessageProfiling::MessageFilter::missing_messages_string ()
   const
 {
-//  stringstream ret_val;
-//  for (map<string, MessageData>::const_iterator iter = msg_map.begin();
-//	      iter != msg_map.end(); ++iter)
-//  {
-//    map<string, MessageData>::const_reference ref = *iter;
-//    ret_val << ref.first << ": ";
-//    for (size_t i = ref.second.first + 1; i < ref.second.last; ++i)
-//    {
-//      if(!ref.second.present[i])
-//        ret_val << i << ",";
-//    }
-//    ret_val << endl;
-//  }
-//  return ret_val.str();
-  return "";
+  std::lock_guard<std::mutex> guard (msg_mutex);
+  stringstream ret_val;
+  for (map<string, MessageData>::const_iterator iter = msg_map.begin ();
+       iter != msg_map.end (); ++iter)
+  {
+    const MessageData & data = iter->second;
+    ret_val << iter->first << ": ";
+
+    // only the window is remembered, so older gaps are not listed
+    int64_t start = data.last - (int64_t)WINDOW + 1;
+    if (start < data.first)
+      start = data.first;
+
+    for (int64_t i = start; i < data.last; ++i)
+    {
+      const size_t bit = (size_t)(i % (int64_t)WINDOW);
+      if (!(data.present[bit / 64] & ((uint64_t)1 << (bit % 64))))
+        ret_val << i << ",";
+    }
+    ret_val << endl;
+  }
+  return ret_val.str ();
+}
+
+void
+gams::algorithms::MessageProfiling::MessageFilter::to_knowledge (
+  madara::knowledge::KnowledgeBase & knowledge,
+  const std::string & prefix) const
+{
+  typedef madara::knowledge::KnowledgeRecord::Integer Integer;
+
+  // statistics are for this agent only, so don't send them
+  madara::knowledge::EvalSettings keep_local (true, true);
+
+  std::lock_guard<std::mutex> guard (msg_mutex);
+  for (map<string, MessageData>::const_iterator iter = msg_map.begin ();
+       iter != msg_map.end (); ++iter)
+  {
+    const MessageData & data = iter->second;
+    const string key = prefix + "." + iter->first + ".";
+
+    // a late arrival is taken to fill a gap, though it may also be a
+    // duplicate of an id that left the window
+    const int64_t expected = data.last - data.first + 1;
+    const int64_t arrived = (int64_t)(data.received + data.late);
+    const int64_t lost = expected > arrived ? expected - arrived : 0;
+
+    // count is every arrival, like the message counts of older versions
+    knowledge.set (key + "count", Integer (
+      data.received + data.duplicates + data.late), keep_local);
+    knowledge.set (key + "first", Integer (data.first), keep_local);
+    knowledge.set (key + "last", Integer (data.last), keep_local);
+    knowledge.set (key + "received", Integer (data.received), keep_local);
+    knowledge.set (key + "lost", Integer (lost), keep_local);
+    knowledge.set (key + "duplicates", Integer (data.duplicates), keep_local);
+    knowledge.set (key + "late", Integer (data.late), keep_local);
+
+    uint64_t measured = 0;
+    std::vector<Integer> histogram (BUCKETS);
+    for (size_t i = 0; i < BUCKETS; ++i)
+    {
+      histogram[i] = Integer (data.latencies[i]);
+      measured += data.latencies[i];
+    }
+
+    knowledge.set (key + "latency.histogram", histogram, keep_local);
+    knowledge.set (key + "latency.max", Integer (data.latency_max),
+      keep_local);
+    knowledge.set (key + "latency.mean",
+      measured ? data.latency_total / measured : 0.0, keep_local);
+  }
 }
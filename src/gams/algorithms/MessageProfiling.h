@@ -57,7 +57,10 @@
 
 #include "gams/algorithms/BaseAlgorithm.h"
 
+#include <array>
+#include <cstdint>
 #include <map>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -131,32 +134,21 @@ namespace gams
        **/
       virtual int plan (void);
 
-    private:
-      /**
-       * Prefix for message keys
-       */
-      const static std::string key_prefix_;
-
-      /// provides access to the knowledge base
-      madara::knowledge::KnowledgeBase * local_knowledge_;
-
-      /**
-       * Container for storing data to be sent to other controllers
-       */
-      madara::knowledge::containers::String data_;
-
-      /**
-       * Container for counter
-       */
-      //madara::knowledge::containers::Integer count_;
-
       /**
        * Filter for tracking which messages have come in and which have been 
-       * dropped
+       * dropped. Memory and cost per message are constant, no matter how
+       * long profiling runs.
        */
       class MessageFilter : public madara::filters::AggregateFilter
       {
       public:
+        /// number of recent message ids each originator's window tracks
+        static const size_t WINDOW = 1024;
+
+        /// number of latency buckets. Bucket i counts latencies in
+        /// [2^(i-1), 2^i) microseconds, and the last bucket all above.
+        static const size_t BUCKETS = 32;
+
         /**
          * virtual destructor
          */
@@ -166,25 +158,98 @@ namespace gams
           const madara::transport::TransportContext& transport_context,
           madara::knowledge::Variables& var);
 
+        /**
+         * Records the arrival of a message
+         * @param  origin     the originator of the message
+         * @param  id         the message id, counting up from the sender
+         * @param  latency    the latency in microseconds, or -1 if unknown
+         **/
+        void add (const std::string & origin, int64_t id, int64_t latency);
+
+        /**
+         * Lists the ids missing from each originator's window
+         * @return one line per originator
+         **/
         std::string missing_messages_string () const;
 
+        /**
+         * Saves the statistics of each originator to a knowledge base.
+         * Lost messages are the ids from first to last that were neither
+         * received nor late, so a late duplicate can hide a loss.
+         * @param  knowledge  the knowledge base to save to
+         * @param  prefix     prefix of the variables
+         **/
+        void to_knowledge (madara::knowledge::KnowledgeBase & knowledge,
+          const std::string & prefix) const;
+
         /**
          * MessageData struct
          */
         struct MessageData
         {
-          size_t first;
-          size_t last;
-          std::vector<bool> present;
+          MessageData ();
+
+          /// the first message id received
+          int64_t first;
+
+          /// the highest message id received
+          int64_t last;
+
+          /// ring bitmap of the ids in (last - WINDOW, last]
+          std::array<uint64_t, WINDOW / 64> present;
+
+          /// distinct messages received
+          uint64_t received;
+
+          /// messages received more than once
+          uint64_t duplicates;
+
+          /// messages received after falling out of the window
+          uint64_t late;
+
+          /// count of messages per latency bucket
+          std::array<uint64_t, BUCKETS> latencies;
+
+          /// sum of latencies in microseconds
+          double latency_total;
+
+          /// largest latency in microseconds
+          int64_t latency_max;
         };
 
         /**
          * Keep a MessageData struct for each peer
          */
-        //std::map<std::string, MessageData> msg_map;
-        std::map<std::string, size_t> msg_map;
+        std::map<std::string, MessageData> msg_map;
+
+        /// guards msg_map, which the transport thread updates
+        mutable std::mutex msg_mutex;
       };
 
+    private:
+      /**
+       * Prefix for message keys
+       */
+      const static std::string key_prefix_;
+
+      /// provides access to the knowledge base
+      madara::knowledge::KnowledgeBase * local_knowledge_;
+
+      /**
+       * Container for storing data to be sent to other controllers
+       */
+      madara::knowledge::containers::String data_;
+
+      /**
+       * Container for counter
+       */
+      madara::knowledge::containers::Integer count_;
+
+      /**
+       * Container for the send time, in nanoseconds since the epoch
+       */
+      madara::knowledge::containers::Integer sent_;
+
       /**
        * Message Filter object
        */
@@ -0,0 +1,550 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file PathPlan.cpp
+ *
+ * This file contains the definition of an algorithm that plans a path
+ * around obstacle regions
+ **/
+
+#include "gams/algorithms/PathPlan.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "madara/utility/Utility.h"
+
+#include "gams/loggers/GlobalLogger.h"
+#include "gams/pose/SearchArea.h"
+
+typedef madara::knowledge::KnowledgeRecord::Integer  Integer;
+typedef madara::knowledge::KnowledgeMap   KnowledgeMap;
+
+gams::algorithms::BaseAlgorithm *
+gams::algorithms::PathPlanFactory::create (
+  const madara::knowledge::KnowledgeMap & args,
+  madara::knowledge::KnowledgeBase * knowledge,
+  platforms::BasePlatform * platform,
+  variables::Sensors * sensors,
+  variables::Self * self,
+  variables::Agents * agents)
+{
+  BaseAlgorithm * result (0);
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::algorithms::PathPlanFactory:" \
+    " entered create with %u args\n", args.size ());
+
+  if (knowledge && sensors && platform && self)
+  {
+    pose::Position destination (platform->get_frame ());
+    bool destination_set (false);
+    std::string search_area;
+    std::vector <std::string> obstacles;
+    double cell_size (1.0);
+
+    for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
+    {
+      if (i->first.size () <= 0)
+        continue;
+
+      switch (i->first[0])
+      {
+      case 'c':
+        if (i->first == "cell_size")
+        {
+          cell_size = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PathPlanFactory:" \
+            " setting cell_size to %f\n", cell_size);
+          break;
+        }
+        goto unknown;
+      case 'd':
+        if (i->first == "destination")
+        {
+          std::vector <double> coords (i->second.to_doubles ());
+
+          if (coords.size () >= 2)
+          {
+            destination = pose::Position (platform->get_frame (),
+              coords[0], coords[1], coords.size () > 2 ? coords[2] : 0.0);
+            destination_set = true;
+          }
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PathPlanFactory:" \
+            " setting destination to %s\n",
+            destination.to_string ().c_str ());
+          break;
+        }
+        goto unknown;
+      case 'o':
+        if (i->first == "obstacles.size")
+        {
+          obstacles.resize ((size_t)std::max (
+            i->second.to_integer (), (Integer)obstacles.size ()));
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PathPlanFactory:" \
+            " setting obstacles.size to %d\n", (int)obstacles.size ());
+          break;
+        }
+        else if (madara::utility::begins_with (i->first, "obstacles."))
+        {
+          madara::knowledge::KnowledgeRecord k_index (
+            madara::utility::strip_prefix (i->first, "obstacles."));
+          Integer index = k_index.to_integer ();
+
+          if (index >= 0)
+          {
+            if ((size_t)index >= obstacles.size ())
+              obstacles.resize ((size_t)index + 1);
+
+            obstacles[(size_t)index] = i->second.to_string ();
+
+            madara_logger_ptr_log (gams::loggers::global_logger.get (),
+              gams::loggers::LOG_DETAILED,
+              "gams::algorithms::PathPlanFactory:" \
+              " setting obstacle %d to %s\n",
+              (int)index, obstacles[(size_t)index].c_str ());
+            break;
+          }
+        }
+        goto unknown;
+      case 's':
+        if (i->first == "search_area")
+        {
+          search_area = i->second.to_string ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PathPlanFactory:" \
+            " setting search_area to %s\n", search_area.c_str ());
+          break;
+        }
+        goto unknown;
+      unknown:
+      default:
+        madara_logger_ptr_log (gams::loggers::global_logger.get (),
+          gams::loggers::LOG_MAJOR,
+          "gams::algorithms::PathPlanFactory:" \
+          " argument unknown: %s -> %s\n",
+          i->first.c_str (), i->second.to_string ().c_str ());
+        break;
+      }
+    }
+
+    // obstacles that were counted but never named are ignored
+    obstacles.erase (std::remove (obstacles.begin (), obstacles.end (), ""),
+      obstacles.end ());
+
+    if (!destination_set)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+        "gams::algorithms::PathPlanFactory::create:" \
+        " ERROR: destination must be set. Returning null.\n");
+    }
+    else if (cell_size <= 0)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+        "gams::algorithms::PathPlanFactory::create:" \
+        " ERROR: cell_size must be positive. Returning null.\n");
+    }
+    else
+    {
+      result = new PathPlan (destination, search_area, obstacles, cell_size,
+        knowledge, platform, sensors, self, agents);
+    }
+  }
+
+  return result;
+}
+
+gams::algorithms::PathPlan::PathPlan (
+  const pose::Position & destination,
+  const std::string & search_area,
+  const std::vector <std::string> & obstacles,
+  double cell_size,
+  madara::knowledge::KnowledgeBase * knowledge,
+  platforms::BasePlatform * platform, variables::Sensors * sensors,
+  variables::Self * self, variables::Agents * agents) :
+  BaseAlgorithm (knowledge, platform, sensors, self, agents),
+  destination_ (destination), obstacle_names_ (obstacles),
+  obstacles_ (obstacles.size ()), obstacle_cells_ (obstacles.size ()),
+  frame_ (destination), min_x_ (0), min_y_ (0), cell_size_ (cell_size),
+  replan_ (true), reachable_ (false), next_ (destination),
+  final_leg_ (true)
+{
+  status_.init_vars (*knowledge, "path_plan", self->agent.prefix);
+  status_.init_variable_values ();
+
+  // the corners the grid must contain
+  std::vector <pose::Position> bounds;
+  bool padded (true);
+
+  if (search_area != "")
+  {
+    pose::SearchArea area;
+    area.from_container (*knowledge, search_area);
+    bounds = area.get_convex_hull ().vertices;
+    padded = false;
+  }
+
+  if (bounds.size () == 0)
+  {
+    bounds.push_back (destination_);
+    bounds.push_back (platform->get_location ());
+
+    for (size_t i = 0; i < obstacle_names_.size (); ++i)
+    {
+      pose::Region region;
+      region.from_container (*knowledge, obstacle_names_[i]);
+      bounds.insert (bounds.end (),
+        region.vertices.begin (), region.vertices.end ());
+    }
+  }
+
+  double max_x (0), max_y (0);
+  for (size_t i = 0; i < bounds.size (); ++i)
+  {
+    pose::Position local = bounds[i].transform_to (frame_);
+
+    if (i == 0 || local.x () < min_x_)
+      min_x_ = local.x ();
+    if (i == 0 || local.x () > max_x)
+      max_x = local.x ();
+    if (i == 0 || local.y () < min_y_)
+      min_y_ = local.y ();
+    if (i == 0 || local.y () > max_y)
+      max_y = local.y ();
+  }
+
+  // without a search area, leave room to go around obstacles on the edge
+  if (padded)
+  {
+    double margin = 0.1 * std::max (max_x - min_x_, max_y - min_y_) +
+      2 * cell_size_;
+
+    min_x_ -= margin;
+    min_y_ -= margin;
+    max_x += margin;
+    max_y += margin;
+  }
+
+  size_t cols = (size_t)std::ceil ((max_x - min_x_) / cell_size_) + 1;
+  size_t rows = (size_t)std::ceil ((max_y - min_y_) / cell_size_) + 1;
+
+  planner_.resize (cols, rows);
+  coverage_.assign (cols * rows, 0);
+
+  utility::GridPlanner::Cell goal = to_cell (destination_);
+  planner_.set_goal (goal.col, goal.row);
+
+  start_ = to_cell (platform->get_location ());
+
+  update_obstacles ();
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::algorithms::PathPlan::constructor:" \
+    " planning over a %d x %d grid of %.3f m cells to [%s]\n",
+    (int)cols, (int)rows, cell_size_, destination_.to_string ().c_str ());
+}
+
+gams::algorithms::PathPlan::~PathPlan ()
+{
+}
+
+void
+gams::algorithms::PathPlan::operator= (const PathPlan & rhs)
+{
+  if (this != &rhs)
+  {
+    this->destination_ = rhs.destination_;
+    this->obstacle_names_ = rhs.obstacle_names_;
+    this->obstacles_ = rhs.obstacles_;
+    this->obstacle_cells_ = rhs.obstacle_cells_;
+    this->coverage_ = rhs.coverage_;
+    this->frame_ = rhs.frame_;
+    this->min_x_ = rhs.min_x_;
+    this->min_y_ = rhs.min_y_;
+    this->cell_size_ = rhs.cell_size_;
+    this->planner_ = rhs.planner_;
+    this->start_ = rhs.start_;
+    this->replan_ = rhs.replan_;
+    this->reachable_ = rhs.reachable_;
+    this->next_ = rhs.next_;
+    this->final_leg_ = rhs.final_leg_;
+
+    this->BaseAlgorithm::operator= (rhs);
+  }
+}
+
+gams::utility::GridPlanner::Cell
+gams::algorithms::PathPlan::to_cell (const pose::Position & position) const
+{
+  pose::Position local = position.transform_to (frame_);
+
+  double col = std::floor ((local.x () - min_x_) / cell_size_);
+  double row = std::floor ((local.y () - min_y_) / cell_size_);
+
+  utility::GridPlanner::Cell cell;
+  cell.col = (size_t)std::min (std::max (col, 0.0),
+    (double)planner_.cols () - 1);
+  cell.row = (size_t)std::min (std::max (row, 0.0),
+    (double)planner_.rows () - 1);
+
+  return cell;
+}
+
+gams::pose::Position
+gams::algorithms::PathPlan::to_position (
+  const utility::GridPlanner::Cell & cell) const
+{
+  pose::Position local (frame_,
+    min_x_ + (cell.col + 0.5) * cell_size_,
+    min_y_ + (cell.row + 0.5) * cell_size_);
+
+  return local.transform_to (platform_->get_frame ());
+}
+
+bool
+gams::algorithms::PathPlan::update_obstacles (void)
+{
+  bool changed (false);
+  size_t cols = planner_.cols ();
+
+  for (size_t i = 0; i < obstacle_names_.size (); ++i)
+  {
+    pose::Region region;
+    region.from_container (*knowledge_, obstacle_names_[i]);
+
+    if (region == obstacles_[i])
+      continue;
+
+    std::vector <utility::GridPlanner::Point> polygon;
+    polygon.reserve (region.vertices.size ());
+
+    for (size_t j = 0; j < region.vertices.size (); ++j)
+    {
+      pose::Position local = region.vertices[j].transform_to (frame_);
+
+      utility::GridPlanner::Point point = {{
+        (local.x () - min_x_) / cell_size_,
+        (local.y () - min_y_) / cell_size_}};
+      polygon.push_back (point);
+    }
+
+    utility::GridPlanner::Cells cells = planner_.rasterize (polygon);
+
+    /**
+     * count the new cells before releasing the old ones, so cells the
+     * obstacle still covers are never freed and reblocked
+     **/
+    for (size_t j = 0; j < cells.size (); ++j)
+    {
+      if (coverage_[cells[j].row * cols + cells[j].col]++ == 0)
+      {
+        planner_.set_blocked (cells[j].col, cells[j].row, true);
+        changed = true;
+      }
+    }
+
+    const utility::GridPlanner::Cells & old = obstacle_cells_[i];
+    for (size_t j = 0; j < old.size (); ++j)
+    {
+      if (--coverage_[old[j].row * cols + old[j].col] == 0)
+      {
+        planner_.set_blocked (old[j].col, old[j].row, false);
+        changed = true;
+      }
+    }
+
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MINOR,
+      "gams::algorithms::PathPlan::update_obstacles:" \
+      " obstacle %s now covers %d cells (was %d)\n",
+      obstacle_names_[i].c_str (), (int)cells.size (), (int)old.size ());
+
+    obstacles_[i] = region;
+    obstacle_cells_[i].swap (cells);
+  }
+
+  return changed;
+}
+
+int
+gams::algorithms::PathPlan::analyze (void)
+{
+  int result (OK);
+
+  if (platform_ && *platform_->get_platform_status ()->movement_available)
+  {
+    if (status_.finished.is_false ())
+    {
+      if (update_obstacles ())
+      {
+        replan_ = true;
+      }
+
+      utility::GridPlanner::Cell start = to_cell (platform_->get_location ());
+
+      if (start.col != start_.col || start.row != start_.row)
+      {
+        start_ = start;
+        replan_ = true;
+      }
+    }
+    else
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MINOR,
+        "gams::algorithms::PathPlan::analyze:" \
+        " Algorithm has finished previously. Rebroadcasting status.finished.\n");
+
+      result |= FINISHED;
+
+      status_.finished.modify ();
+    }
+  }
+  else
+  {
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MAJOR,
+      "gams::algorithms::PathPlan::analyze:" \
+      " platform has not set movement_available to 1.\n");
+  }
+
+  return result;
+}
+
+int
+gams::algorithms::PathPlan::plan (void)
+{
+  int result (OK);
+
+  if (replan_ && status_.finished.is_false ())
+  {
+    replan_ = false;
+    reachable_ = planner_.plan (start_.col, start_.row);
+
+    if (reachable_)
+    {
+      utility::GridPlanner::Cells waypoints = planner_.get_waypoints ();
+
+      // the first waypoint is the start. Head straight for the
+      // destination once nothing is in the way.
+      final_leg_ = waypoints.size () <= 2;
+      next_ = final_leg_ ? destination_ : to_position (waypoints[1]);
+
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MAJOR,
+        "gams::algorithms::PathPlan::plan:" \
+        " path of %.3f m with %d turns after %d expansions." \
+        " Next location is [%s]\n",
+        planner_.get_cost () * cell_size_,
+        waypoints.size () > 2 ? (int)waypoints.size () - 2 : 0,
+        (int)planner_.get_expanded (), next_.to_string ().c_str ());
+    }
+    else
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+        "gams::algorithms::PathPlan::plan:" \
+        " no path from cell [%d, %d] to the destination. Holding.\n",
+        (int)start_.col, (int)start_.row);
+    }
+  }
+
+  return result;
+}
+
+int
+gams::algorithms::PathPlan::execute (void)
+{
+  int result (OK);
+
+  if (status_.finished.is_true ())
+  {
+    result |= FINISHED;
+  }
+  else if (platform_ && *platform_->get_platform_status ()->movement_available
+    && reachable_)
+  {
+    int move_result = platform_->move (next_, platform_->get_accuracy ());
+
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MAJOR,
+      "gams::algorithms::PathPlan::execute:" \
+      " platform->move to [%s] returned %d.\n",
+      next_.to_string ().c_str (), move_result);
+
+    if (move_result == platforms::PLATFORM_ARRIVED && final_leg_)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MAJOR,
+        "gams::algorithms::PathPlan::execute:" \
+        " arrived at the destination. Finished.\n");
+
+      result |= FINISHED;
+      status_.finished = 1;
+    }
+  }
+
+  return result;
+}
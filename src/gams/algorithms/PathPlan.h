@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file PathPlan.h
+ *
+ * This file contains the definition of an algorithm that plans a path
+ * around obstacle regions
+ **/
+
+#ifndef   _GAMS_ALGORITHMS_PATH_PLAN_H_
+#define   _GAMS_ALGORITHMS_PATH_PLAN_H_
+
+#include "gams/algorithms/BaseAlgorithm.h"
+
+#include <string>
+#include <vector>
+
+#include "gams/variables/Sensor.h"
+#include "gams/platforms/BasePlatform.h"
+#include "gams/variables/AlgorithmStatus.h"
+#include "gams/variables/Self.h"
+#include "gams/pose/Position.h"
+#include "gams/pose/Region.h"
+#include "gams/utility/GridPlanner.h"
+#include "gams/algorithms/AlgorithmFactory.h"
+
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace algorithms
+  {
+    /**
+    * An algorithm for moving to a location around obstacle regions. The
+    * area is discretized into an occupancy grid, and the path is repaired,
+    * rather than recomputed, when the agent moves or obstacles change.
+    **/
+    class GAMS_EXPORT PathPlan : public BaseAlgorithm
+    {
+    public:
+      /**
+       * Constructor
+       * @param  destination  the location to move to
+       * @param  search_area  the search area that bounds the grid. If
+       *                      empty, the grid bounds the agent, the
+       *                      destination and the obstacles.
+       * @param  obstacles    names of the regions that must be avoided
+       * @param  cell_size    width of a grid cell in meters
+       * @param  knowledge    the context containing variables and values
+       * @param  platform     the underlying platform the algorithm will use
+       * @param  sensors      map of sensor names to sensor information
+       * @param  self         self-referencing variables
+       * @param  agents      variables referencing agents
+       **/
+      PathPlan (
+        const pose::Position & destination,
+        const std::string & search_area,
+        const std::vector <std::string> & obstacles,
+        double cell_size,
+        madara::knowledge::KnowledgeBase * knowledge = 0,
+        platforms::BasePlatform * platform = 0,
+        variables::Sensors * sensors = 0,
+        variables::Self * self = 0,
+        variables::Agents * agents = 0);
+
+      /**
+       * Destructor
+       **/
+      ~PathPlan ();
+
+      /**
+       * Assignment operator
+       * @param  rhs   values to copy
+       **/
+      void operator= (const PathPlan & rhs);
+
+      /**
+       * Analyzes environment, platform, or other information
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int analyze (void);
+
+      /**
+       * Plans the next execution of the algorithm
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int execute (void);
+
+      /**
+       * Plans the next execution of the algorithm
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int plan (void);
+
+    protected:
+
+      /**
+       * Finds the grid cell that contains a position. Positions off the
+       * grid use the nearest cell on its edge.
+       * @param  position  the position to convert
+       * @return the cell
+       **/
+      utility::GridPlanner::Cell to_cell (
+        const pose::Position & position) const;
+
+      /**
+       * Converts the center of a grid cell to the platform frame
+       * @param  cell      the cell to convert
+       * @return the position of the cell's center
+       **/
+      pose::Position to_position (
+        const utility::GridPlanner::Cell & cell) const;
+
+      /**
+       * Rereads the obstacle regions and blocks or frees the cells that
+       * changed since the last read
+       * @return true if any cell changed
+       **/
+      bool update_obstacles (void);
+
+      /// the location to move to
+      pose::Position destination_;
+
+      /// names of the obstacle regions
+      std::vector <std::string> obstacle_names_;
+
+      /// the obstacle regions as of the last read
+      std::vector <pose::Region> obstacles_;
+
+      /// the cells covered by each obstacle region
+      std::vector <utility::GridPlanner::Cells> obstacle_cells_;
+
+      /// the number of obstacles covering each cell
+      std::vector <unsigned int> coverage_;
+
+      /// cartesian frame with its origin at the destination
+      pose::ReferenceFrame frame_;
+
+      /// the lower left corner of the grid in frame_
+      double min_x_, min_y_;
+
+      /// width of a grid cell in meters
+      double cell_size_;
+
+      /// the incremental planner over the grid
+      utility::GridPlanner planner_;
+
+      /// the start cell of the last plan
+      utility::GridPlanner::Cell start_;
+
+      /// if true, the grid changed or the agent moved since the last plan
+      bool replan_;
+
+      /// if true, the last plan reached the destination
+      bool reachable_;
+
+      /// the next location to move to
+      pose::Position next_;
+
+      /// if true, next_ is the destination
+      bool final_leg_;
+    };
+
+    /**
+     * A factory class for creating PathPlan algorithms
+     **/
+    class GAMS_EXPORT PathPlanFactory : public AlgorithmFactory
+    {
+    public:
+
+      /**
+       * Creates a PathPlan Algorithm.
+       * @param   args      destination = location to move to
+       *                    search_area = optional area bounding the grid
+       *                    obstacles.size = number of obstacle regions
+       *                    obstacles.{n} = name of an obstacle region
+       *                    cell_size = grid resolution in meters (1.0)
+       * @param   knowledge the knowledge base to use
+       * @param   platform  the platform. This will be set by the
+       *                    controller in init_vars.
+       * @param   sensors   the sensor info. This will be set by the
+       *                    controller in init_vars.
+       * @param   self      self-referencing variables. This will be
+       *                    set by the controller in init_vars
+       * @param   agents   the list of agents, which is dictated by
+       *                    init_vars when a number of processes is set. This
+       *                    will be set by the controller in init_vars
+       **/
+      virtual BaseAlgorithm * create (
+        const madara::knowledge::KnowledgeMap & args,
+        madara::knowledge::KnowledgeBase * knowledge,
+        platforms::BasePlatform * platform,
+        variables::Sensors * sensors,
+        variables::Self * self,
+        variables::Agents * agents);
+    };
+  }
+}
+
+#endif // _GAMS_ALGORITHMS_PATH_PLAN_H_
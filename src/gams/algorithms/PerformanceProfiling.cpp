@@ -46,9 +46,74 @@
 
 #include "gams/algorithms/PerformanceProfiling.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "gams/loggers/GlobalLogger.h"
+#include "gams/pose/GPSFrame.h"
+
+typedef madara::knowledge::KnowledgeRecord::Integer  Integer;
+typedef madara::knowledge::KnowledgeMap   KnowledgeMap;
+
+namespace
+{
+  /// prefix of the report variables
+  const std::string PREFIX (".performance_profiling.");
+
+  /// vertices of the contains benchmark polygon
+  const size_t VERTICES = 32;
+
+  /// gps positions used by the transform and contains benchmarks
+  const size_t POINTS = 256;
+
+  typedef gams::algorithms::PerformanceProfiling::Timing Timing;
+
+  /**
+   * Calls op with an increasing index, in batches, until duration passes,
+   * and adds the samples to timing. At least one batch is run.
+   **/
+  template <typename Operation>
+  void measure (Operation op, size_t batch, double duration, Timing & timing)
+  {
+    typedef std::chrono::steady_clock Clock;
+
+    const Clock::time_point begin = Clock::now ();
+    const Clock::time_point end = begin +
+      std::chrono::duration_cast<Clock::duration> (
+        std::chrono::duration<double> (duration));
+
+    if (batch == 0)
+      batch = 1;
+
+    Clock::time_point now;
+    do
+    {
+      const Clock::time_point start = Clock::now ();
+      for (size_t i = 0; i < batch; ++i)
+        op ((size_t)timing.iterations + i);
+      now = Clock::now ();
+
+      const double elapsed =
+        std::chrono::duration<double, std::nano> (now - start).count ();
+      const double per_op = elapsed / batch;
+
+      if (timing.iterations == 0 || per_op < timing.min_ns)
+        timing.min_ns = per_op;
+      if (per_op > timing.max_ns)
+        timing.max_ns = per_op;
+
+      timing.total_ns += elapsed;
+      timing.iterations += (Integer)batch;
+    } while (now < end);
+
+    timing.seconds += std::chrono::duration<double> (now - begin).count ();
+  }
+}
+
 gams::algorithms::BaseAlgorithm *
 gams::algorithms::PerformanceProfilingFactory::create (
-  const madara::knowledge::KnowledgeMap & /*args*/,
+  const madara::knowledge::KnowledgeMap & args,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform,
   variables::Sensors * sensors,
@@ -59,7 +124,78 @@ gams::algorithms::PerformanceProfilingFactory::create (
 
   if (knowledge && sensors && self)
   {
-    result = new PerformanceProfiling (knowledge, platform, sensors, self);
+    double duration (1.0);
+    size_t batch (100);
+    bool profile_platform (true);
+    double slice (0.05);
+
+    for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
+    {
+      if (i->first.size () <= 0)
+        continue;
+
+      switch (i->first[0])
+      {
+      case 'b':
+        if (i->first == "batch")
+        {
+          batch = (size_t)std::max (i->second.to_integer (), Integer (1));
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PerformanceProfilingFactory:" \
+            " setting batch to %d\n", (int)batch);
+          break;
+        }
+        goto unknown;
+      case 'd':
+        if (i->first == "duration")
+        {
+          duration = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PerformanceProfilingFactory:" \
+            " setting duration to %f\n", duration);
+          break;
+        }
+        goto unknown;
+      case 'p':
+        if (i->first == "platform")
+        {
+          profile_platform = i->second.is_true ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PerformanceProfilingFactory:" \
+            " setting platform to %d\n", (int)profile_platform);
+          break;
+        }
+        goto unknown;
+      case 's':
+        if (i->first == "slice")
+        {
+          slice = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PerformanceProfilingFactory:" \
+            " setting slice to %f\n", slice);
+          break;
+        }
+        goto unknown;
+      unknown:
+      default:
+        madara_logger_ptr_log (gams::loggers::global_logger.get (),
+          gams::loggers::LOG_MAJOR,
+          "gams::algorithms::PerformanceProfilingFactory:" \
+          " arg %s with value %s is not known\n",
+          i->first.c_str (), i->second.to_string ().c_str ());
+      }
+    }
+
+    result = new PerformanceProfiling (knowledge, platform, sensors, self,
+      duration, batch, profile_platform, slice);
   }
 
   return result;
@@ -69,11 +205,45 @@ gams::algorithms::PerformanceProfiling::PerformanceProfiling (
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::Base * platform,
   variables::Sensors * sensors,
-  variables::Self * self)
-  : BaseAlgorithm (knowledge, platform, sensors, self)
+  variables::Self * self,
+  double duration,
+  size_t batch,
+  bool profile_platform,
+  double slice)
+  : BaseAlgorithm (knowledge, platform, sensors, self),
+    duration_ (duration), batch_ (batch), slice_ (slice),
+    profile_platform_ (profile_platform), current_ (0), sink_ (0)
 {
   status_.init_vars (*knowledge, "performance_profiling", self->agent.prefix);
   status_.init_variable_values ();
+
+  counter_.set_name (PREFIX + "scratch.counter", *knowledge);
+  samples_.set_name (PREFIX + "scratch.samples", *knowledge);
+  samples_.resize (POINTS);
+
+  // the geometry is around a fixed point, so results compare across hosts
+  frame_ = pose::ReferenceFrame (
+    pose::Position (pose::gps_frame (), -79.9436, 40.4433));
+
+  std::vector <pose::Position> vertices;
+  for (size_t i = 0; i < VERTICES; ++i)
+  {
+    const double angle = 2 * M_PI * i / VERTICES;
+    const double radius = i % 2 ? 100.0 : 60.0;
+    vertices.push_back (pose::Position (frame_,
+      radius * std::cos (angle), radius * std::sin (angle)).transform_to (
+        pose::gps_frame ()));
+  }
+  region_ = pose::Region (vertices);
+
+  for (size_t i = 0; i < POINTS; ++i)
+  {
+    const double angle = 0.618 * 2 * M_PI * i;
+    const double radius = 120.0 * i / POINTS;
+    points_.push_back (pose::Position (frame_,
+      radius * std::cos (angle), radius * std::sin (angle)).transform_to (
+        pose::gps_frame ()));
+  }
 }
 
 gams::algorithms::PerformanceProfiling::~PerformanceProfiling ()
@@ -92,7 +262,150 @@ gams::algorithms::PerformanceProfiling::operator= (
     this->sensors_ = rhs.sensors_;
     this->self_ = rhs.self_;
     this->status_ = rhs.status_;
+    this->duration_ = rhs.duration_;
+    this->batch_ = rhs.batch_;
+    this->slice_ = rhs.slice_;
+    this->timing_ = rhs.timing_;
+    this->profile_platform_ = rhs.profile_platform_;
+    this->current_ = rhs.current_;
+    this->frame_ = rhs.frame_;
+    this->region_ = rhs.region_;
+    this->points_ = rhs.points_;
+    this->sink_ = rhs.sink_;
+  }
+}
+
+std::string
+gams::algorithms::PerformanceProfiling::get_name (Benchmarks benchmark)
+{
+  switch (benchmark)
+  {
+  case KB_SET: return "kb_set";
+  case KB_GET: return "kb_get";
+  case CONTAINER_INTEGER: return "container_integer";
+  case CONTAINER_VECTOR: return "container_vector";
+  case FRAME_TRANSFORM: return "frame_transform";
+  case REGION_CONTAINS: return "region_contains";
+  case PLATFORM_SENSE: return "platform_sense";
+  case PLATFORM_MOVE: return "platform_move";
+  default: return "unknown";
+  }
+}
+
+gams::algorithms::PerformanceProfiling::Timing::Timing ()
+  : iterations (0), total_ns (0), min_ns (0), max_ns (0), seconds (0)
+{
+}
+
+bool
+gams::algorithms::PerformanceProfiling::run (Benchmarks benchmark)
+{
+  const std::string scratch = PREFIX + "scratch.value";
+  double & sink = sink_;
+  bool runnable = true;
+
+  // run no longer than the time left, or the slice
+  const double slice = std::min (slice_, duration_ - timing_.seconds);
+
+  switch (benchmark)
+  {
+  case KB_SET:
+    measure ([&] (size_t i) {
+      knowledge_->set (scratch, Integer (i));
+    }, batch_, slice, timing_);
+    break;
+  case KB_GET:
+    measure ([&] (size_t) {
+      sink += knowledge_->get (scratch).to_double ();
+    }, batch_, slice, timing_);
+    break;
+  case CONTAINER_INTEGER:
+    measure ([&] (size_t) {
+      sink += ++counter_;
+    }, batch_, slice, timing_);
+    break;
+  case CONTAINER_VECTOR:
+    measure ([&] (size_t i) {
+      samples_.set (i % POINTS, (double)i);
+      sink += samples_[(i + 1) % POINTS];
+    }, batch_, slice, timing_);
+    break;
+  case FRAME_TRANSFORM:
+    measure ([&] (size_t i) {
+      sink += points_[i % POINTS].transform_to (frame_).x ();
+    }, batch_, slice, timing_);
+    break;
+  case REGION_CONTAINS:
+    measure ([&] (size_t i) {
+      sink += region_.contains (points_[i % POINTS]) ? 1 : 0;
+    }, batch_, slice, timing_);
+    break;
+  case PLATFORM_SENSE:
+    // one call per sample, since platform calls may block on hardware
+    if (platform_ && profile_platform_)
+    {
+      measure ([&] (size_t) {
+        sink += platform_->sense ();
+      }, 1, slice, timing_);
+    }
+    else
+      runnable = false;
+    break;
+  case PLATFORM_MOVE:
+    if (platform_ && profile_platform_)
+    {
+      const pose::Position hold = platform_->get_location ();
+      const double accuracy = platform_->get_accuracy ();
+      measure ([&] (size_t) {
+        sink += platform_->move (hold, accuracy);
+      }, 1, slice, timing_);
+    }
+    else
+      runnable = false;
+    break;
+  default:
+    runnable = false;
+    break;
   }
+
+  if (runnable && timing_.seconds < duration_)
+    return false;
+
+  report (benchmark);
+  timing_ = Timing ();
+
+  return true;
+}
+
+void
+gams::algorithms::PerformanceProfiling::report (Benchmarks benchmark)
+{
+  const std::string name = get_name (benchmark);
+  const std::string key = PREFIX + name + ".";
+  const double mean = timing_.iterations > 0 ?
+    timing_.total_ns / timing_.iterations : 0.0;
+  const double ops_per_second = mean > 0 ? 1.0e9 / mean : 0.0;
+
+  knowledge_->set (key + "iterations", timing_.iterations);
+  knowledge_->set (key + "mean_ns", mean);
+  knowledge_->set (key + "min_ns", timing_.min_ns);
+  knowledge_->set (key + "max_ns", timing_.max_ns);
+  knowledge_->set (key + "ops_per_second", ops_per_second);
+
+  // the summary is global, so peers and monitors can compare hosts
+  const std::string global_key =
+    self_->agent.prefix + PREFIX + name + ".";
+
+  knowledge_->set (global_key + "iterations", timing_.iterations);
+  knowledge_->set (global_key + "mean_ns", mean);
+  knowledge_->set (global_key + "ops_per_second", ops_per_second);
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::algorithms::PerformanceProfiling::report:" \
+    " %s: %d iterations, %f ns mean, %f ns min, %f ns max\n",
+    name.c_str (), (int)timing_.iterations, mean,
+    timing_.min_ns, timing_.max_ns);
 }
 
 int
@@ -104,9 +417,29 @@ gams::algorithms::PerformanceProfiling::analyze (void)
 int
 gams::algorithms::PerformanceProfiling::execute (void)
 {
+  int result (OK);
+
   ++executions_;
 
-  return OK;
+  // one slice per execute, so the controller loop stays responsive
+  if (current_ < NUM_BENCHMARKS && run ((Benchmarks)current_))
+  {
+    ++current_;
+
+    knowledge_->set (PREFIX + "completed", Integer (current_));
+    knowledge_->set (self_->agent.prefix + PREFIX + "completed",
+      Integer (current_));
+  }
+
+  if (current_ >= NUM_BENCHMARKS)
+  {
+    knowledge_->set (PREFIX + "sink", sink_);
+
+    status_.finished = 1;
+    result |= FINISHED;
+  }
+
+  return result;
 }
 
 int
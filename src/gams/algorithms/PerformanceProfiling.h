@@ -55,8 +55,16 @@
 #ifndef _GAMS_ALGORITHMS_PERFORMANCE_PROFILING_H_
 #define _GAMS_ALGORITHMS_PERFORMANCE_PROFILING_H_
 
+#include <string>
+#include <vector>
+
 #include "gams/algorithms/BaseAlgorithm.h"
 #include "gams/algorithms/AlgorithmFactory.h"
+#include "gams/pose/ReferenceFrame.h"
+#include "gams/pose/Region.h"
+
+#include "madara/knowledge/containers/Integer.h"
+#include "madara/knowledge/containers/NativeDoubleVector.h"
 
 #include "gams/GamsExport.h"
 
@@ -65,7 +73,15 @@ namespace gams
   namespace algorithms
   {
     /**
-    * An algorithm for testing computational speed
+    * An algorithm for testing computational speed on the target hardware.
+    * Each execute runs the current micro-benchmark for a bounded slice of
+    * time, so the controller loop keeps its rate. Once a benchmark has run
+    * for its full duration, its result is saved in local variables under
+    * .performance_profiling.{benchmark} and its summary is published under
+    * {agent}.performance_profiling.{benchmark}.
+    * The benchmarks are kb_set, kb_get, container_integer,
+    * container_vector, frame_transform, region_contains, platform_sense
+    * and platform_move. The algorithm finishes after the last one.
     **/
     class GAMS_EXPORT PerformanceProfiling : public BaseAlgorithm
     {
@@ -76,12 +92,22 @@ namespace gams
        * @param  platform     the underlying platform the algorithm will use
        * @param  sensors      map of sensor names to sensor information
        * @param  self         self-referencing variables
+       * @param  duration     seconds to run each benchmark
+       * @param  batch        operations timed together in one sample
+       * @param  profile_platform  if true, time platform sense and move.
+       *                      The move benchmark commands the platform to
+       *                      hold its current location.
+       * @param  slice        seconds to benchmark per execute
        **/
       PerformanceProfiling (
         madara::knowledge::KnowledgeBase * knowledge = 0,
         platforms::Base * platform = 0,
         variables::Sensors * sensors = 0,
-        variables::Self * self = 0);
+        variables::Self * self = 0,
+        double duration = 1.0,
+        size_t batch = 100,
+        bool profile_platform = true,
+        double slice = 0.05);
 
       /**
        * Destructor
@@ -111,6 +137,105 @@ namespace gams
        * @return bitmask status of the platform. @see Status.
        **/
       virtual int plan (void);
+
+      /**
+       * The benchmarks, in the order they are run
+       **/
+      enum Benchmarks
+      {
+        KB_SET,
+        KB_GET,
+        CONTAINER_INTEGER,
+        CONTAINER_VECTOR,
+        FRAME_TRANSFORM,
+        REGION_CONTAINS,
+        PLATFORM_SENSE,
+        PLATFORM_MOVE,
+        NUM_BENCHMARKS
+      };
+
+      /**
+       * Gets the name of a benchmark, as used in the report
+       * @param  benchmark  the benchmark
+       * @return the name of the benchmark
+       **/
+      static std::string get_name (Benchmarks benchmark);
+
+      /**
+       * Timing of a benchmark. Each sample is the mean cost of one
+       * operation over a batch, so min and max are of batches, not single
+       * operations.
+       **/
+      struct Timing
+      {
+        Timing ();
+
+        /// operations timed so far
+        madara::knowledge::KnowledgeRecord::Integer iterations;
+
+        /// total time of the operations in nanoseconds
+        double total_ns;
+
+        /// fastest sample in nanoseconds per operation
+        double min_ns;
+
+        /// slowest sample in nanoseconds per operation
+        double max_ns;
+
+        /// wall-clock seconds spent running the benchmark
+        double seconds;
+      };
+
+    private:
+      /**
+       * Runs a slice of a benchmark. When the benchmark has run for its
+       * full duration, saves its result to the knowledge base.
+       * @param  benchmark  the benchmark to run
+       * @return true if the benchmark is complete
+       **/
+      bool run (Benchmarks benchmark);
+
+      /**
+       * Saves the result of a benchmark to the knowledge base
+       * @param  benchmark  the completed benchmark
+       **/
+      void report (Benchmarks benchmark);
+
+      /// seconds to run each benchmark
+      double duration_;
+
+      /// operations timed together in one sample
+      size_t batch_;
+
+      /// seconds to benchmark per execute
+      double slice_;
+
+      /// timing of the current benchmark so far
+      Timing timing_;
+
+      /// if true, time platform sense and move
+      bool profile_platform_;
+
+      /// the next benchmark to run
+      size_t current_;
+
+      /// counter for the container benchmark
+      madara::knowledge::containers::Integer counter_;
+
+      /// values for the container benchmark
+      madara::knowledge::containers::NativeDoubleVector samples_;
+
+      /// local frame for the transform benchmark
+      pose::ReferenceFrame frame_;
+
+      /// polygon for the contains benchmark
+      pose::Region region_;
+
+      /// gps positions used by the transform and contains benchmarks
+      std::vector <pose::Position> points_;
+
+      /// results are accumulated here, so the compiler keeps the work
+      double sink_;
     };
 
     /**
@@ -122,7 +247,11 @@ namespace gams
 
       /**
        * Creates a PerformanceProfiling Algorithm.
-       * @param   args      ignored
+       * @param   args      the args passed with the 'algorithm' command
+       *                    duration = seconds per benchmark (1.0)
+       *                    batch = operations per timed sample (100)
+       *                    platform = 0 to skip the platform benchmarks (1)
+       *                    slice = seconds to benchmark per loop (0.05)
        * @param   knowledge the knowledge base to use
        * @param   platform  the platform. This will be set by the
        *                    controller in init_vars.
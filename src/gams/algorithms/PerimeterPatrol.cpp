@@ -46,6 +46,8 @@
 #include "gams/loggers/GlobalLogger.h"
 #include "PerimeterPatrol.h"
 
+#include <chrono>
+#include <cmath>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -81,6 +83,7 @@ gams::algorithms::PerimeterPatrolFactory::create (
     std::string search_area;
     double max_time = -1;
     bool counter = false;
+    double speed = 0;
 
     for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
     {
@@ -136,6 +139,16 @@ gams::algorithms::PerimeterPatrolFactory::create (
             " setting search_area to %s\n", search_area.c_str ());
           break;
         }
+        else if (i->first == "speed")
+        {
+          speed = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PerimeterPatrolFactory:" \
+            " setting speed to %f\n", speed);
+          break;
+        }
         goto unknown;
       case 't':
         if (i->first == "time")
@@ -171,7 +184,7 @@ gams::algorithms::PerimeterPatrolFactory::create (
     else
     {
       result = new PerimeterPatrol (
-        search_area, max_time, counter,
+        search_area, max_time, counter, speed,
         knowledge, platform, sensors, self, agents);
     }
   }
@@ -183,12 +196,14 @@ gams::algorithms::PerimeterPatrol::PerimeterPatrol (
   const std::string & area,
   double max_time,
   bool counter,
+  double speed,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform, variables::Sensors * sensors,
   variables::Self * self, variables::Agents * agents) :
   BaseAlgorithm (knowledge, platform, sensors, self, agents),
   area_ (area), max_time_ (max_time), counter_ (counter), move_index_ (0),
-  initialized_ (false), enforcer_ (max_time, max_time)
+  speed_ (speed), self_index_ (0), initialized_ (false),
+  enforcer_ (max_time, max_time)
 {
   status_.init_vars (*knowledge, "patrol", self->agent.prefix);
   status_.init_variable_values ();
@@ -208,6 +223,10 @@ gams::algorithms::PerimeterPatrol::operator= (const PerimeterPatrol & rhs)
     this->max_time_ = rhs.max_time_;
     this->locations_ = rhs.locations_;
     this->move_index_ = rhs.move_index_;
+    this->perimeter_ = rhs.perimeter_;
+    this->speed_ = rhs.speed_;
+    this->self_index_ = rhs.self_index_;
+    this->slot_ = rhs.slot_;
     this->enforcer_ = rhs.enforcer_;
 
     this->BaseAlgorithm::operator=(rhs);
@@ -228,6 +247,16 @@ gams::algorithms::PerimeterPatrol::analyze (void)
 
     status_.finished = 1;
   }
+  else if (initialized_ && status_.finished.is_false () && speed_ > 0)
+  {
+    slot_ = perimeter_.position_at (get_slot_distance ());
+
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MAJOR,
+      "PerimeterPatrol::analyze:" \
+      " following slot %d at [%s].\n",
+      (int)self_index_, slot_.to_string ().c_str ());
+  }
   else if (initialized_ && status_.finished.is_false ())
   {
     madara_logger_ptr_log (gams::loggers::global_logger.get (),
@@ -303,7 +332,17 @@ gams::algorithms::PerimeterPatrol::execute (void)
 
   bool is_finished = status_.finished == 1;
 
-  if (initialized_ && !is_finished)
+  if (initialized_ && !is_finished && speed_ > 0)
+  {
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MAJOR,
+      "PerimeterPatrol::execute:" \
+      " calling platform->move(\"%s\")\n",
+      slot_.to_string ().c_str ());
+
+    platform_->move (slot_);
+  }
+  else if (initialized_ && !is_finished)
   {
     madara_logger_ptr_log (gams::loggers::global_logger.get (),
       gams::loggers::LOG_MAJOR,
@@ -364,6 +403,8 @@ gams::algorithms::PerimeterPatrol::generate_locations (void)
         " hull point: %s\n",
         v.to_string().c_str());
     }
+
+    perimeter_.set_vertices (locations_);
   }
 
   if (platform_ && *platform_->get_platform_status ()->movement_available)
@@ -383,7 +424,7 @@ gams::algorithms::PerimeterPatrol::generate_locations (void)
       double cur_dist = agent_location.distance_to (locations_[i]);
       if (min_dist > cur_dist)
       {
-        cur_dist = min_dist;
+        min_dist = cur_dist;
         move_index_ = i;
       }
     }
@@ -403,3 +444,37 @@ gams::algorithms::PerimeterPatrol::generate_locations (void)
     initialized_ = true;
   }
 }
+
+double
+gams::algorithms::PerimeterPatrol::get_slot_distance (void)
+{
+  size_t count = agents_ ? agents_->size () : 0;
+
+  // the agent list can change with the group, so check our cached index
+  if (self_index_ >= count ||
+    (*agents_)[self_index_].prefix != self_->agent.prefix)
+  {
+    self_index_ = 0;
+    while (self_index_ < count &&
+      (*agents_)[self_index_].prefix != self_->agent.prefix)
+      ++self_index_;
+  }
+
+  // patrol alone if we are not in the agent list
+  if (self_index_ >= count)
+  {
+    self_index_ = 0;
+    count = 1;
+  }
+
+  // every agent derives the slots from the wall clock, so they agree as
+  // long as the clocks are synchronized
+  const double now = std::chrono::duration<double> (
+    std::chrono::system_clock::now ().time_since_epoch ()).count ();
+  const double length = perimeter_.get_length ();
+  const double travelled = length > 0 ? std::fmod (now * speed_, length) : 0;
+
+  const double offset = length * self_index_ / count;
+
+  return perimeter_.wrap (counter_ ? offset - travelled : offset + travelled);
+}
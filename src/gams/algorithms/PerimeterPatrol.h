@@ -66,6 +66,7 @@
 #include "gams/variables/Self.h"
 #include "madara/utility/EpochEnforcer.h"
 #include "gams/utility/Position.h"
+#include "gams/utility/Perimeter.h"
 #include "gams/algorithms/AlgorithmFactory.h"
 
 namespace gams
@@ -73,7 +74,15 @@ namespace gams
   namespace algorithms
   {
     /**
-    * An algorithm for patrolling a region
+    * An algorithm for patrolling a region. By default, the agent visits the
+    * vertices of the region in turn. If a speed is given, the agents of the
+    * algorithm instead space themselves evenly around the perimeter, each
+    * following a slot that travels the perimeter at that speed. The slots
+    * are recomputed whenever the number of agents changes.
+    *
+    * Each agent places its slot from its own system clock, so the agents'
+    * clocks must be synchronized, e.g., with NTP. A clock that is off by
+    * t seconds puts its agent speed * t meters from its slot.
     **/
     class GAMS_EXPORT PerimeterPatrol : public BaseAlgorithm
     {
@@ -83,6 +92,8 @@ namespace gams
        * @param  area         the region or search area to patrol
        * @param  max_time     the max time to run in secs (-1 for indefinite)
        * @param  counter      indicates if patrol should be counter clockwise
+       * @param  speed        speed of evenly spaced slots in m/s. If 0 or
+       *                      less, the agent visits the vertices instead.
        * @param  knowledge    the context containing variables and values
        * @param  platform     the underlying platform the algorithm will use
        * @param  sensors      map of sensor names to sensor information
@@ -93,6 +104,7 @@ namespace gams
         const std::string & area,
         double max_time,
         bool counter,
+        double speed,
         madara::knowledge::KnowledgeBase * knowledge = 0,
         platforms::BasePlatform * platform = 0,
         variables::Sensors * sensors = 0,
@@ -135,6 +147,12 @@ namespace gams
        **/
       void generate_locations (void);
 
+      /**
+       * Gets the distance along the perimeter of this agent's slot
+       * @return the distance from the first vertex in meters
+       **/
+      double get_slot_distance (void);
+
       /// the region/area to patrol
       std::string area_;
 
@@ -150,6 +168,18 @@ namespace gams
       /// current location to move to
       size_t move_index_;
 
+      /// the patrolled perimeter, parameterized by distance
+      utility::Perimeter perimeter_;
+
+      /// speed of evenly spaced slots in m/s, or 0 to visit vertices
+      double speed_;
+
+      /// index of this agent in agents_, which decides its slot
+      size_t self_index_;
+
+      /// the position of this agent's slot
+      pose::Position slot_;
+
       /// indicates whether or not generate_locations has been succeeded
       bool initialized_;
 
@@ -166,9 +196,10 @@ namespace gams
 
       /**
        * Creates a PerimeterPatrol Algorithm.
-       * @param   args      args[0] = type of movement
-       *                    args[1] = number of move executions
-       *                    args[2] = time to move in seconds
+       * @param   args      area = the region or search area to patrol
+       *                    counter = patrol counter clockwise
+       *                    max_time = time to patrol in seconds
+       *                    speed = speed of evenly spaced slots in m/s
        * @param   knowledge the knowledge base to use
        * @param   platform  the platform. This will be set by the
        *                    controller in init_vars.
@@ -92,6 +92,7 @@ variables::Agents * /*agents*/)
     std::string assets = "group.assets";
     std::string enemies = "group.enemies";
     std::string formation = "line";
+    std::string assignment = "index";
     double buffer = 2;
     double distance = 0.5;
 
@@ -113,6 +114,30 @@ variables::Agents * /*agents*/)
             " set assets group to %s\n", assets.c_str ());
           break;
         }
+        else if (i->first == "assignment")
+        {
+          assignment = i->second.to_string ();
+          madara::utility::lower (assignment);
+
+          if (assignment != "index" && assignment != "total" &&
+              assignment != "makespan")
+          {
+            madara_logger_ptr_log (gams::loggers::global_logger.get (),
+              gams::loggers::LOG_WARNING,
+              "gams::algorithms::ZoneCoverageFactory:" \
+              " unknown assignment %s. Assigning by index\n",
+              assignment.c_str ());
+
+            assignment = "index";
+            break;
+          }
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::ZoneCoverageFactory:" \
+            " set assignment to %s\n", assignment.c_str ());
+          break;
+        }
         goto unknown;
       case 'b':
         if (i->first == "buffer")
@@ -187,7 +212,7 @@ variables::Agents * /*agents*/)
 
     result = new ZoneCoverage (
       protectors, assets, enemies, formation, buffer, distance,
-      knowledge, platform, sensors, self);
+      assignment, knowledge, platform, sensors, self);
   }
 
   return result;
@@ -199,14 +224,19 @@ gams::algorithms::ZoneCoverage::ZoneCoverage (
   const std::string &enemies,
   const std::string &formation,
   double buffer, double distance,
+  const std::string &assignment,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform,
   variables::Sensors * sensors,
   variables::Self * self) :
   BaseAlgorithm (knowledge, platform, sensors, self),
   group_factory_ (knowledge),
+  protectors_version_ (0),
   formation_ (formation), buffer_ (buffer), distance_ (distance),
   index_ (-1),
+  assignment_ (assignment),
+  assigner_ (assignment == "makespan" ?
+    utility::SlotAssignment::MAKESPAN : utility::SlotAssignment::TOTAL),
   form_func_ (get_form_func (formation)),
   next_loc_ (INVAL_COORD, INVAL_COORD, INVAL_COORD)
 {
@@ -266,6 +296,7 @@ gams::algorithms::ZoneCoverage::ZoneCoverage (
         // we can sync the group and call get_members again if we want to support
         // changing group member lists (even with fixed list groups)
         protectors_->get_members (protectors_members_);
+        protectors_version_ = protectors_->get_version ();
       }
       else
       {
@@ -321,6 +352,12 @@ gams::algorithms::ZoneCoverage::ZoneCoverage (
       " protectors list size: %i\n",
       protectors_members_.size ());
 
+    // protector locations are only needed to assign positions by distance
+    if (assignment_ != "index")
+    {
+      update_arrays (protectors_members_, protector_loc_cont_);
+    }
+
     // check if assets is a single agent or a group
     if (!gams::variables::Agent::is_agent (*knowledge, assets))
     {
@@ -483,6 +520,8 @@ gams::algorithms::ZoneCoverage::operator= (const ZoneCoverage & rhs)
     this->formation_ = rhs.formation_;
     this->buffer_ = rhs.buffer_;
     this->form_func_ = rhs.form_func_;
+    this->assignment_ = rhs.assignment_;
+    this->assigner_ = rhs.assigner_;
   }
 }
 
@@ -528,6 +567,67 @@ gams::algorithms::ZoneCoverage::update_locs (
   }
 }
 
+void
+gams::algorithms::ZoneCoverage::update_members (void)
+{
+  if (protectors_)
+  {
+    protectors_->sync ();
+
+    // only rebuild when members joined or left
+    if (protectors_->get_version () != protectors_version_)
+    {
+      const gams::groups::AgentVector & members =
+        protectors_->get_member_list ();
+
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MAJOR,
+        "gams::algorithms::ZoneCoverage::update_members:" \
+        " protectors changed from %d to %d members\n",
+        (int)protectors_members_.size (), (int)members.size ());
+
+      protectors_members_ = members;
+      protectors_version_ = protectors_->get_version ();
+      update_arrays (protectors_members_, protector_loc_cont_);
+
+      index_ = protectors_->get_member_index (self_->agent.prefix);
+    }
+  }
+}
+
+int
+gams::algorithms::ZoneCoverage::assign_position (void)
+{
+  std::vector<Position> slots;
+  slots.reserve (protector_locs_.size ());
+
+  for (size_t i = 0; i < protector_locs_.size (); ++i)
+  {
+    slots.push_back ( ( (this)->* (form_func_)) ((int)i));
+
+    if (!protector_locs_[i].is_set () || !slots[i].is_set ())
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MINOR,
+        "gams::algorithms::ZoneCoverage::assign_position:" \
+        " location of protector or position %d is not set." \
+        " Using member index %d.\n", (int)i, index_);
+
+      return index_;
+    }
+  }
+
+  // reuses the last solve's prices, so a steady group re-solves quickly
+  int position = assigner_.solve (protector_locs_, slots)[index_];
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::algorithms::ZoneCoverage::assign_position:" \
+    " member %d is assigned position %d\n", index_, position);
+
+  return position;
+}
+
 int
 gams::algorithms::ZoneCoverage::analyze (void)
 {
@@ -538,6 +638,13 @@ gams::algorithms::ZoneCoverage::analyze (void)
 
   update_locs (asset_loc_cont_, asset_locs_);
   update_locs (enemy_loc_cont_, enemy_locs_);
+
+  if (assignment_ != "index")
+  {
+    update_members ();
+    update_locs (protector_loc_cont_, protector_locs_);
+  }
+
   return OK;
 }
 
@@ -581,7 +688,14 @@ gams::algorithms::ZoneCoverage::plan (void)
     " entering plan method\n");
 
   if (index_ >= 0)
-    next_loc_ = ( (this)->* (form_func_)) ();
+  {
+    int position = index_;
+
+    if (assignment_ != "index")
+      position = assign_position ();
+
+    next_loc_ = ( (this)->* (form_func_)) (position);
+  }
 
   if (asset_locs_.size () > 0 && enemy_locs_.size () > 0)
   {
@@ -597,7 +711,7 @@ gams::algorithms::ZoneCoverage::plan (void)
 }
 
 Position
-gams::algorithms::ZoneCoverage::line_formation () const
+gams::algorithms::ZoneCoverage::line_formation (int index) const
 {
   Position ret (platform_->get_frame ());
 
@@ -626,7 +740,7 @@ gams::algorithms::ZoneCoverage::line_formation () const
         middle.to_string ().c_str ());
 
 
-      if (index_ == 0)
+      if (index == 0)
       {
 
         madara_logger_ptr_log (gams::loggers::global_logger.get (),
@@ -645,7 +759,7 @@ gams::algorithms::ZoneCoverage::line_formation () const
         Position middle_cart (frame, middle);
         Position enemy_loc_cart (frame, enemy_loc);
 
-        int offset = (index_ % 2 == 0) ? (index_ / 2) : (- (index_ + 1) / 2);
+        int offset = (index % 2 == 0) ? (index / 2) : (- (index + 1) / 2);
         double a = atan2 (enemy_loc_cart.x (),
                          enemy_loc_cart.y ());
         double pa = a + M_PI / 2;
@@ -691,7 +805,7 @@ gams::algorithms::ZoneCoverage::line_formation () const
 }
 
 Position
-gams::algorithms::ZoneCoverage::arc_formation () const
+gams::algorithms::ZoneCoverage::arc_formation (int index) const
 {
   Position ret (platform_->get_frame ());
 
@@ -706,7 +820,7 @@ gams::algorithms::ZoneCoverage::arc_formation () const
               (asset_loc.x () * distance_) + (enemy_loc.x () * (1 - distance_)),
               (asset_loc.y () * distance_) + (enemy_loc.y () * (1 - distance_)),
               (asset_loc.z () * distance_) + (enemy_loc.z () * (1 - distance_)));
-      if (index_ == 0)
+      if (index == 0)
         ret = middle;
       else
       {
@@ -719,7 +833,7 @@ gams::algorithms::ZoneCoverage::arc_formation () const
         double distance = asset_loc.distance_to (middle);
         double circ = distance * M_PI * 2;
 
-        int offset = (index_ % 2 == 0) ? (index_ / 2) : (- (index_ + 1) / 2);
+        int offset = (index % 2 == 0) ? (index / 2) : (- (index + 1) / 2);
         double arc_len = offset * buffer_;
 
         double a = atan2 (enemy_cart_loc.x (), enemy_cart_loc.y ());
@@ -804,7 +918,7 @@ namespace onion
 }
 
 Position
-gams::algorithms::ZoneCoverage::onion_formation () const
+gams::algorithms::ZoneCoverage::onion_formation (int index) const
 {
   Position ret (platform_->get_frame ());
 
@@ -819,11 +933,11 @@ gams::algorithms::ZoneCoverage::onion_formation () const
               (asset_loc.x () * distance_) + (enemy_loc.x () * (1 - distance_)),
               (asset_loc.y () * distance_) + (enemy_loc.y () * (1 - distance_)),
               (asset_loc.z () * distance_) + (enemy_loc.z () * (1 - distance_)));
-      if (index_ == 0)
+      if (index == 0)
         ret = middle;
       else
       {
-        onion::placement p = onion::get_placement (index_);
+        onion::placement p = onion::get_placement (index);
 
         ReferenceFrame frame (asset_loc);
 
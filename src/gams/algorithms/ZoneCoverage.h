@@ -67,6 +67,7 @@
 #include "madara/knowledge/containers/Integer.h"
 #include "madara/knowledge/containers/Barrier.h"
 #include "gams/groups/GroupFactoryRepository.h"
+#include "gams/utility/SlotAssignment.h"
 
 namespace gams
 {
@@ -95,6 +96,9 @@ namespace gams
        * @param  frame        frame of reference (cartesian, GPS)
        * @param  buffer       buffer between agents
        * @param  distance     distance from the asset
+       * @param  assignment   how protectors are assigned positions: "index"
+       *                      (member index), "total" (least total distance)
+       *                      or "makespan" (least longest distance)
        * @param  knowledge    the context containing variables and values
        * @param  platform     the underlying platform the algorithm will use
        * @param  sensors      map of sensor names to sensor information
@@ -106,6 +110,7 @@ namespace gams
         const std::string &enemies,
         const std::string &formation,
         double buffer, double distance,
+        const std::string &assignment = "index",
         madara::knowledge::KnowledgeBase * knowledge = 0,
         platforms::BasePlatform * platform = 0,
         variables::Sensors * sensors = 0,
@@ -154,6 +159,9 @@ namespace gams
       gams::groups::AgentVector assets_members_;
       gams::groups::AgentVector enemies_members_;
 
+      /// membership version of protectors_members_
+      uint64_t protectors_version_;
+
       std::string formation_;
 
       double buffer_;
@@ -162,13 +170,19 @@ namespace gams
 
       int index_;
 
-      typedef pose::Position (ZoneCoverage::*formation_func) () const;
+      /// how protectors are assigned positions ("index", "total", "makespan")
+      std::string assignment_;
+
+      /// assigns protectors to positions, if not assigning by index
+      utility::SlotAssignment assigner_;
+
+      typedef pose::Position (ZoneCoverage::*formation_func) (int) const;
 
       formation_func form_func_;
 
-      pose::Position line_formation () const;
-      pose::Position arc_formation () const;
-      pose::Position onion_formation () const;
+      pose::Position line_formation (int index) const;
+      pose::Position arc_formation (int index) const;
+      pose::Position onion_formation (int index) const;
 
       static formation_func get_form_func (const std::string &form_name);
 
@@ -176,12 +190,26 @@ namespace gams
 
       MadaraArrayVec asset_loc_cont_;
       MadaraArrayVec enemy_loc_cont_;
+      MadaraArrayVec protector_loc_cont_;
 
       std::vector<pose::Position> asset_locs_;
       std::vector<pose::Position> enemy_locs_;
+      std::vector<pose::Position> protector_locs_;
       pose::Position next_loc_;
 
     private:
+      /**
+       * Rereads the protectors group, in case members joined or left
+       **/
+      void update_members (void);
+
+      /**
+       * Assigns protectors to the formation's positions by distance
+       * @return the position of this agent, or index_ if a protector
+       *         or position has no location yet
+       **/
+      int assign_position (void);
+
       void update_arrays (const gams::groups::AgentVector &names,
                          MadaraArrayVec &arrays) const;
       void update_locs (const MadaraArrayVec &arrays,
@@ -57,6 +57,8 @@
  */
 
 #include "gams/algorithms/area_coverage/BaseAreaCoverage.h"
+#include "gams/pose/SearchArea.h"
+#include "gams/utility/AreaPartition.h"
 
 gams::algorithms::area_coverage::BaseAreaCoverage::BaseAreaCoverage (
   madara::knowledge::KnowledgeBase * knowledge,
@@ -64,8 +66,10 @@ gams::algorithms::area_coverage::BaseAreaCoverage::BaseAreaCoverage (
   variables::Sensors * sensors,
   variables::Self * self,
   variables::Agents * agents,
-  double e_time) :
+  double e_time,
+  bool partition) :
   BaseAlgorithm (knowledge, platform, sensors, self, agents), 
+  initialized_ (false), partition_ (partition), cell_index_ (0), cell_count_ (0),
   max_time_ (e_time), enforcer_ (e_time, e_time)
 {
   madara_logger_ptr_log (gams::loggers::global_logger.get (),
@@ -85,6 +89,9 @@ gams::algorithms::area_coverage::BaseAreaCoverage::operator= (
   if (this != &rhs)
   {
     this->next_position_ = rhs.next_position_;
+    this->partition_ = rhs.partition_;
+    this->cell_index_ = rhs.cell_index_;
+    this->cell_count_ = rhs.cell_count_;
     this->max_time_ = rhs.max_time_;
     this->enforcer_ = rhs.enforcer_;
 
@@ -163,6 +170,19 @@ gams::algorithms::area_coverage::BaseAreaCoverage::execute (void)
 int
 gams::algorithms::area_coverage::BaseAreaCoverage::plan (void)
 {
+  // a change in the agents changes our cell, so start over in the new one
+  if (partition_ && initialized_ && update_cell ())
+  {
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MAJOR,
+      "gams::algorithms::area_coverage::BaseAreaCoverage::plan:" \
+      " agents changed. Moving to cell %d of %d\n",
+      (int)cell_index_, (int)cell_count_);
+
+    initialized_ = false;
+    generate_new_position ();
+  }
+
   if (platform_ && *platform_->get_platform_status ()->movement_available)
   {
     pose::Position loc = platform_->get_location ();
@@ -206,3 +226,43 @@ gams::algorithms::area_coverage::BaseAreaCoverage::check_if_finished (
   }
   return ret_val;
 }
+
+bool
+gams::algorithms::area_coverage::BaseAreaCoverage::update_cell (void)
+{
+  size_t count = agents_ ? agents_->size () : 0;
+  size_t index = 0;
+
+  while (index < count && (*agents_)[index].prefix != self_->agent.prefix)
+    ++index;
+
+  // cover everything alone if we are not in the agent list
+  if (index >= count)
+  {
+    index = 0;
+    count = 1;
+  }
+
+  const bool changed = index != cell_index_ || count != cell_count_;
+  cell_index_ = index;
+  cell_count_ = count;
+
+  return changed;
+}
+
+gams::pose::Region
+gams::algorithms::area_coverage::BaseAreaCoverage::get_cell (
+  const std::string & area_id)
+{
+  if (partition_)
+  {
+    update_cell ();
+
+    return utility::AreaPartition::get_agent_cell (
+      *knowledge_, area_id, cell_index_, cell_count_);
+  }
+
+  pose::SearchArea search;
+  search.from_container (*knowledge_, area_id);
+  return search.get_convex_hull ();
+}
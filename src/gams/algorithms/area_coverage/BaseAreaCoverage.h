@@ -57,6 +57,7 @@
 #include "gams/algorithms/BaseAlgorithm.h"
 
 #include "gams/utility/GPSPosition.h"
+#include "gams/pose/Region.h"
 
 #include "madara/utility/Utility.h"
 #include "madara/utility/EpochEnforcer.h"
@@ -81,6 +82,8 @@ namespace gams
          * @param  self         self-referencing variables of this agent
          * @param  agents      list of agents in the swarm
          * @param  e_time    execution time
+         * @param  partition  if true, cover only this agent's cell of the
+         *                    area, split between the agents
          **/
         BaseAreaCoverage (
           madara::knowledge::KnowledgeBase * knowledge = 0,
@@ -88,7 +91,8 @@ namespace gams
           variables::Sensors * sensors = 0,
           variables::Self * self = 0,
           variables::Agents * agents = 0,
-          double e_time = -1.0);
+          double e_time = -1.0,
+          bool partition = false);
   
         /**
          * Destructor
@@ -136,12 +140,36 @@ namespace gams
          */
         int check_if_finished (int ret_val) const;
 
+        /**
+         * Updates this agent's index among the agents and their number
+         * @return true if either changed
+         **/
+        bool update_cell (void);
+
+        /**
+         * Gets the region this agent covers. If partitioning, this is the
+         * agent's cell of the area, shared through the knowledge base.
+         * Otherwise, it is the convex hull of the area.
+         * @param  area_id  name of the region or search area
+         * @return the region to cover
+         **/
+        pose::Region get_cell (const std::string & area_id);
+
         /// next position
         utility::GPSPosition next_position_;
 
         /// indicates whether the algorithm is initialized
         bool initialized_;
 
+        /// if true, cover only this agent's cell of the area
+        bool partition_;
+
+        /// index of this agent's cell
+        size_t cell_index_;
+
+        /// number of cells, i.e., agents covering the area
+        size_t cell_count_;
+
         /// for keeping track of the time set for maximum coverage time
         double max_time_;
 
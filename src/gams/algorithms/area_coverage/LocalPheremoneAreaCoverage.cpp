@@ -48,34 +48,24 @@
  * @file LocalPheremoneAreaCoverage.cpp
  * @author Anton Dukeman <anton.dukeman@gmail.com>
  *
- * Agents mark a sensor with their time when they enter a discretized cell of a 
- * region. At each time step, they select the neighboring cell with the lowest 
- * pheremone reading as their next destination.
- *
- * NOTE: the Area Coverage algorithms currently use the deprecated
- * utility::Position classes, and should not be used as examples.
- *
- * Disabled pending repair of the variables::Sensor class
+ * Agents mark a dense grid of pheremone over the search area with the cells
+ * they are in. The pheremone evaporates and diffuses every cycle. When an
+ * agent reaches its destination, it selects the neighboring cell with the
+ * lowest pheremone concentration as its next destination.
  **/
 
-#if 0
-
 #include "gams/loggers/GlobalLogger.h"
 #include "gams/algorithms/area_coverage/LocalPheremoneAreaCoverage.h"
+#include "gams/pose/GPSFrame.h"
 
 #include "madara/utility/Utility.h"
 
-#include "gams/utility/ArgumentParser.h"
-
-#include <iostream>
-using std::cerr;
-using std::endl;
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <vector>
 using std::vector;
 
-namespace engine = madara::knowledge;
-namespace containers = engine::containers;
-
 typedef madara::knowledge::KnowledgeRecord::Integer  Integer;
 typedef madara::knowledge::KnowledgeMap    KnowledgeMap;
 
@@ -99,6 +89,9 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create (
   {
     std::string search_area;
     double time = 360;
+    double cell_size = 5.0;
+    double evaporation = 0.01;
+    double diffusion = 0.1;
 
     for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
     {
@@ -114,11 +107,47 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create (
 
           madara_logger_ptr_log (gams::loggers::global_logger.get (),
             gams::loggers::LOG_DETAILED,
-            "gams::algorithms::FormationSyncFactory:" \
+            "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
             " setting search_area to %s\n", search_area.c_str ());
           break;
         }
         goto unknown;
+      case 'c':
+        if (i->first == "cell_size")
+        {
+          cell_size = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
+            " setting cell_size to %f\n", cell_size);
+          break;
+        }
+        goto unknown;
+      case 'd':
+        if (i->first == "diffusion")
+        {
+          diffusion = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
+            " setting diffusion to %f\n", diffusion);
+          break;
+        }
+        goto unknown;
+      case 'e':
+        if (i->first == "evaporation")
+        {
+          evaporation = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
+            " setting evaporation to %f\n", evaporation);
+          break;
+        }
+        goto unknown;
       case 's':
         if (i->first == "search_area")
         {
@@ -126,7 +155,7 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create (
 
           madara_logger_ptr_log (gams::loggers::global_logger.get (),
             gams::loggers::LOG_DETAILED,
-            "gams::algorithms::FormationSyncFactory:" \
+            "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
             " setting search_area to %s\n", search_area.c_str ());
           break;
         }
@@ -138,7 +167,7 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create (
 
           madara_logger_ptr_log (gams::loggers::global_logger.get (),
             gams::loggers::LOG_DETAILED,
-            "gams::algorithms::FormationSyncFactory:" \
+            "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
             " setting time to %f\n", time);
           break;
         }
@@ -147,7 +176,7 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create (
       default:
         madara_logger_ptr_log (gams::loggers::global_logger.get (),
           gams::loggers::LOG_MAJOR,
-          "gams::algorithms::FormationSyncFactory:" \
+          "gams::algorithms::LocalPheremoneAreaCoverageFactory:" \
           " argument unknown: %s -> %s\n",
           i->first.c_str (), i->second.to_string ().c_str ());
         break;
@@ -162,10 +191,17 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create (
         "gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create:" \
         " No search area specified. Returning null.\n");
     }
+    else if (cell_size <= 0)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+        "gams::algorithms::area_coverage::LocalPheremoneAreaCoverageFactory::create:" \
+        " cell_size must be positive. Returning null.\n");
+    }
     else
     {
       result = new area_coverage::LocalPheremoneAreaCoverage (
-        search_area, time,
+        search_area, time, cell_size, evaporation, diffusion,
         knowledge, platform, sensors, self, agents);
     }
   }
@@ -177,31 +213,59 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::
 LocalPheremoneAreaCoverage (
   const std::string& search_id,
   double e_time,
+  double cell_size,
+  double evaporation,
+  double diffusion,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform, variables::Sensors * sensors,
   variables::Self * self, variables::Agents * agents) :
   BaseAreaCoverage (knowledge, platform, sensors, self, agents, e_time),
-  pheremone_ (search_id + ".pheremone", knowledge)
+  cell_size_ (cell_size)
 {
-  self->agent.prefix;
   // init status vars
   status_.init_vars (*knowledge, "lpac", self->agent.prefix);
-  status_.init_vars (*knowledge, "lpac", self->agent.prefix);
   status_.init_variable_values ();
 
   // get search area
   search_area_.from_container (*knowledge, search_id);
 
-  // fill out pheremone sensor
+  // lay the grid over the bounding box of the search area
+  pose::Region hull = search_area_.get_convex_hull ();
+  frame_ = pose::ReferenceFrame (pose::Position (
+    pose::gps_frame (), hull.min_lon_, hull.min_lat_));
+  pose::Position corner = pose::Position (
+    pose::gps_frame (), hull.max_lon_, hull.max_lat_).transform_to (frame_);
+
+  size_t cols = (size_t)std::max (0.0, std::ceil (corner.x () / cell_size_));
+  size_t rows = (size_t)std::max (0.0, std::ceil (corner.y () / cell_size_));
+
+  pheremone_.resize (cols, rows);
+  pheremone_.set_evaporation (evaporation);
+  pheremone_.set_diffusion (diffusion);
+
   /**
-   * See MinTimeAreaCoverage.cpp for why this needs to be updated later
-   */
-  utility::GPSPosition origin;
-  madara::knowledge::containers::NativeDoubleArray origin_container;
-  origin_container.set_name ("sensor.coverage.origin", *knowledge, 3);
-  origin.from_container (origin_container);
-  pheremone_.set_origin (origin);
-  pheremone_.set_range (5.0);
+   * only cells centered in the search area hold pheremone. This is the
+   * only place the search area is tested, so selecting a next cell never
+   * has to convert to GPS or search the regions.
+   **/
+  size_t inside (0);
+  for (size_t row = 0; row < rows; ++row)
+  {
+    for (size_t col = 0; col < cols; ++col)
+    {
+      bool valid = search_area_.contains (to_position (col, row));
+      pheremone_.set_valid (col, row, valid);
+
+      if (valid)
+        ++inside;
+    }
+  }
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::constructor:" \
+    " %d of %d x %d cells of %.3f m are in the search area\n",
+    (int)inside, (int)cols, (int)rows, cell_size_);
   
   // generate first position to move
   generate_new_position ();
@@ -214,11 +278,93 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::operator= (
   if (this != &rhs)
   {
     this->search_area_ = rhs.search_area_;
+    this->frame_ = rhs.frame_;
+    this->cell_size_ = rhs.cell_size_;
     this->pheremone_ = rhs.pheremone_;
     this->BaseAreaCoverage::operator= (rhs);
   }
 }
 
+bool
+gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::to_cell (
+  const pose::Position & position, size_t & col, size_t & row) const
+{
+  pose::Position local = position.transform_to (frame_);
+
+  double x = std::floor (local.x () / cell_size_);
+  double y = std::floor (local.y () / cell_size_);
+
+  if (x < 0 || y < 0 ||
+    x >= (double)pheremone_.cols () || y >= (double)pheremone_.rows ())
+  {
+    return false;
+  }
+
+  col = (size_t)x;
+  row = (size_t)y;
+
+  return true;
+}
+
+gams::pose::Position
+gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::to_position (
+  size_t col, size_t row) const
+{
+  pose::Position local (frame_,
+    (col + 0.5) * cell_size_, (row + 0.5) * cell_size_);
+
+  return local.transform_to (pose::gps_frame ());
+}
+
+int
+gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::analyze (void)
+{
+  size_t col, row;
+
+  variables::SwarmView * view = get_swarm_view ();
+
+  // every agent marks the cell it is in
+  if (view && view->size () > 0)
+  {
+    const variables::SwarmView::Snapshot & snapshot = view->get_snapshot ();
+
+    for (size_t i = 0; i < view->size (); ++i)
+    {
+      if (!snapshot.has_location[i])
+        continue;
+
+      pose::Position location (pose::gps_frame (), snapshot.location_x[i],
+        snapshot.location_y[i], snapshot.location_z[i]);
+
+      if (to_cell (location, col, row))
+        pheremone_.deposit (col, row, 1.0);
+    }
+  }
+  else if (agents_ && agents_->size () > 0)
+  {
+    for (size_t i = 0; i < agents_->size (); ++i)
+    {
+      pose::Position location (pose::gps_frame ());
+      location.from_container ((*agents_)[i].location);
+
+      if (to_cell (location, col, row))
+        pheremone_.deposit (col, row, 1.0);
+    }
+  }
+  else if (self_)
+  {
+    pose::Position location (pose::gps_frame ());
+    location.from_container (self_->agent.location);
+
+    if (to_cell (location, col, row))
+      pheremone_.deposit (col, row, 1.0);
+  }
+
+  pheremone_.step ();
+
+  return BaseAreaCoverage::analyze ();
+}
+
 void
 gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::
   generate_new_position (void)
@@ -226,80 +372,90 @@ gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::
   if (platform_ && *platform_->get_platform_status ()->movement_available)
   {
     // get current location
-    utility::GPSPosition cur_gps;
-    cur_gps.from_container (self_->agent.location);
-
-    // create possible next positions
-    const int num_possible = 12;
-    utility::Position possible[num_possible];
-    utility::Position cur = pheremone_.get_index_from_gps (cur_gps);
-    vector<unsigned int> selection;
-    for (unsigned int i = 0; i < num_possible; ++i)
+    pose::Position current (pose::gps_frame ());
+    current.from_container (self_->agent.location);
+
+    // the 8 adjacent cells, and the cells 2 away along each axis
+    static const int offsets[][2] = {
+      {1, 1}, {1, 0}, {1, -1}, {0, -1}, {-1, -1}, {-1, 0}, {-1, 1}, {0, 1},
+      {2, 0}, {0, 2}, {-2, 0}, {0, -2}};
+    const size_t num_possible = sizeof (offsets) / sizeof (offsets[0]);
+
+    // visit them in random order, so ties are broken randomly
+    vector<size_t> selection (num_possible);
+    for (size_t i = 0; i < num_possible; ++i)
+      selection[i] = i;
+    for (size_t i = num_possible - 1; i > 0; --i)
+      std::swap (selection[i],
+        selection[(size_t)madara::utility::rand_int (0, (int)i)]);
+
+    size_t col, row;
+    bool found (false);
+    size_t best_col (0), best_row (0);
+
+    if (to_cell (current, col, row))
     {
-      possible[i] = cur;
-      selection.push_back (i);
+      // find lowest pheremone concentration of possible cells in the area
+      double concentration = DBL_MAX;
+      for (size_t i = 0; i < num_possible; ++i)
+      {
+        const int * offset = offsets[selection[i]];
+        size_t next_col = col + offset[0];
+        size_t next_row = row + offset[1];
+
+        if (pheremone_.is_valid (next_col, next_row) &&
+          pheremone_.get (next_col, next_row) < concentration)
+        {
+          concentration = pheremone_.get (next_col, next_row);
+          best_col = next_col;
+          best_row = next_row;
+          found = true;
+        }
+      }
     }
-    ++possible[0].x; ++possible[0].y;
-    ++possible[1].x;
-    ++possible[2].x; --possible[2].y;
-    --possible[3].y;
-    --possible[4].x; --possible[4].y;
-    --possible[5].x;
-    --possible[6].x; ++possible[6].y;
-    ++possible[7].y;
 
     /**
-     * We consider the possibility that the agent drifts outside the actual area
-     * of operation. A more robust way to do this would be to find the closest
-     * cell in the area and go to that, however, this is simpler and has not
-     * failed in simulation. Real-world experiments are likely to differ and may
-     * require the more robust solution.
-     */
-    possible[8].x += 2;
-    possible[9].y += 2;
-    possible[10].x -= 2;
-    possible[11].y -= 2;
-
-    // find lowest pheremone concentration of possible coords in search_area
-    utility::GPSPosition lowest = cur_gps;
-    utility::Position s;
-    double concentration = DBL_MAX;
-    std::random_shuffle (selection.begin (), selection.end ());
-    for (unsigned int i = 0; i < num_possible; ++i)
+     * if the agent drifted out of the area, head back to the closest cell
+     * that is in it
+     **/
+    if (!found)
     {
-      const int index = selection[i]; // get randomized index
+      pose::Position local = current.transform_to (frame_);
+      double closest = DBL_MAX;
 
-      // update executions value if necessary
-      const double my_concentration = pheremone_.get_value (possible[index]);
-      if (my_concentration > executions_)
-        executions_ = my_concentration;
-
-      // check if new min found and update if necessary
-      if (concentration > my_concentration)
+      for (size_t y = 0; y < pheremone_.rows (); ++y)
       {
-        utility::GPSPosition possible_gps =
-          pheremone_.get_gps_from_index (possible[index]);
-        if (search_area_.contains (possible_gps))
+        for (size_t x = 0; x < pheremone_.cols (); ++x)
         {
+          double dx = (x + 0.5) * cell_size_ - local.x ();
+          double dy = (y + 0.5) * cell_size_ - local.y ();
+
+          if (pheremone_.is_valid (x, y) && dx * dx + dy * dy < closest)
           {
-            concentration = my_concentration;
-            lowest = possible_gps;
-            s = possible[index];
+            closest = dx * dx + dy * dy;
+            best_col = x;
+            best_row = y;
+            found = true;
           }
         }
       }
     }
 
-    // update pheremone value
-    pheremone_.set_value (lowest, executions_ + 1);
-
-    // assign new next
-    // TODO: fix with proper altitude
-    lowest.altitude (self_->agent.desired_altitude.to_double ());
-    next_position_ = lowest;
+    if (found)
+    {
+      // assign new next
+      // TODO: fix with proper altitude
+      next_position_ = utility::GPSPosition (to_position (best_col, best_row));
+      next_position_.altitude (self_->agent.desired_altitude.to_double ());
 
-    initialized_ = true;
+      initialized_ = true;
+    }
+    else
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+        "gams::algorithms::area_coverage::LocalPheremoneAreaCoverage::" \
+        "generate_new_position: search area has no cells\n");
+    }
   }
 }
-
-#endif
@@ -48,8 +48,6 @@
  * @file LocalPheremoneAreaCoverage.h
  * @author Anton Dukeman <anton.dukeman@gmail.com>
  * Contains implementation of area coverage based on pheremone tracking
- *
- * NOTE: Disabled pending repair of the variables::Sensor class
  **/
 
 #ifndef _GAMS_ALGORITHMS_AREA_COVERAGE_PHEREMONE_AREA_COVERAGE_H_
@@ -57,7 +55,8 @@
 
 #include "gams/algorithms/area_coverage/BaseAreaCoverage.h"
 #include "gams/pose/SearchArea.h"
-#include "gams/variables/Sensor.h"
+#include "gams/pose/ReferenceFrame.h"
+#include "gams/utility/PheromoneField.h"
 #include "gams/algorithms/AlgorithmFactory.h"
 
 namespace gams
@@ -67,7 +66,10 @@ namespace gams
     namespace area_coverage
     {
       /**
-      * Covers an area based on concentrations of virtual pheremones
+      * Covers an area based on concentrations of virtual pheremones. Every
+      * agent marks the cell it is in, the pheremone evaporates and
+      * diffuses each cycle, and an agent moves to the neighboring cell
+      * with the lowest concentration.
       **/
       class GAMS_EXPORT LocalPheremoneAreaCoverage : public BaseAreaCoverage
       {
@@ -77,6 +79,11 @@ namespace gams
          * @param  knowledge    the context containing variables and values
          * @param  search_id    the identifier of the search area
          * @param  e_time       execution time
+         * @param  cell_size    width of a pheremone cell in meters
+         * @param  evaporation  fraction of pheremone that evaporates
+         *                      each cycle
+         * @param  diffusion    fraction of pheremone that diffuses to
+         *                      neighboring cells each cycle
          * @param  platform     the underlying platform the algorithm will use
          * @param  sensors      map of sensor names to sensor information
          * @param  self         self-referencing variables
@@ -85,6 +92,9 @@ namespace gams
         LocalPheremoneAreaCoverage (
           const std::string& search_id, 
           double e_time, 
+          double cell_size = 5.0,
+          double evaporation = 0.01,
+          double diffusion = 0.1,
           madara::knowledge::KnowledgeBase * knowledge = 0,
           platforms::BasePlatform * platform = 0,
           variables::Sensors * sensors = 0,
@@ -96,18 +106,48 @@ namespace gams
          * @param  rhs   values to copy
          **/
         void operator= (const LocalPheremoneAreaCoverage & rhs);
+
+        /**
+         * Marks the cells of all agents and advances the pheremone
+         * @return bitmask status of the platform. @see Status.
+         **/
+        virtual int analyze (void);
         
       protected:
         /**
          * Generate new next position
          */
         virtual void generate_new_position (void);
+
+        /**
+         * Finds the cell that contains a position
+         * @param  position  the position to convert
+         * @param  col       the column of the cell
+         * @param  row       the row of the cell
+         * @return true if the position is on the grid
+         **/
+        bool to_cell (const pose::Position & position,
+          size_t & col, size_t & row) const;
+
+        /**
+         * Converts the center of a cell to GPS
+         * @param  col       the column of the cell
+         * @param  row       the row of the cell
+         * @return the position of the cell's center
+         **/
+        pose::Position to_position (size_t col, size_t row) const;
   
         /// Search Area to cover
         pose::SearchArea search_area_;
+
+        /// cartesian frame at the southwest corner of the search area
+        pose::ReferenceFrame frame_;
+
+        /// width of a cell in meters
+        double cell_size_;
   
         /// virtual pheremone
-        variables::Sensor pheremone_;
+        utility::PheromoneField pheremone_;
       }; // class LocalPheremoneAreaCoverage
       
       /**
@@ -120,7 +160,11 @@ namespace gams
 
         /**
          * Creates a pheremone area coverage Algorithm.
-         * @param   args      args[0] = search area id
+         * @param   args      search_area = search area id
+         *                    time = execution time
+         *                    cell_size = cell width in meters (5.0)
+         *                    evaporation = evaporated fraction (0.01)
+         *                    diffusion = diffused fraction (0.1)
          * @param   knowledge the knowledge base to use
          * @param   platform  the platform. This will be set by the
          *                    controller in init_vars.
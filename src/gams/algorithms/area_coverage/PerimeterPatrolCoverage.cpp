@@ -59,6 +59,8 @@
 #include "gams/loggers/GlobalLogger.h"
 #include "gams/algorithms/area_coverage/PerimeterPatrolCoverage.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "gams/utility/GPSPosition.h"
@@ -97,6 +99,7 @@ gams::algorithms::area_coverage::PerimeterPatrolCoverageFactory::create (
   {
     std::string search_area;
     double time = 360;
+    double spacing = 0;
 
     for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
     {
@@ -128,6 +131,16 @@ gams::algorithms::area_coverage::PerimeterPatrolCoverageFactory::create (
             " setting search_area to %s\n", search_area.c_str ());
           break;
         }
+        else if (i->first == "spacing")
+        {
+          spacing = i->second.to_double ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::PerimeterPatrolCoverageFactory:" \
+            " setting spacing to %f\n", spacing);
+          break;
+        }
         goto unknown;
       case 't':
         if (i->first == "time")
@@ -163,7 +176,7 @@ gams::algorithms::area_coverage::PerimeterPatrolCoverageFactory::create (
     else
     {
       result = new area_coverage::PerimeterPatrolCoverage (
-        search_area, time,
+        search_area, time, spacing,
         knowledge, platform, sensors, self, agents);
     }
   }
@@ -173,15 +186,15 @@ gams::algorithms::area_coverage::PerimeterPatrolCoverageFactory::create (
 
 /**
  * Perimeter patrol is a precomputed algorithm. The agent traverses the vertices
- * of the region in order
+ * of the region in order, or points evenly spaced along its perimeter
  */
 gams::algorithms::area_coverage::PerimeterPatrolCoverage::PerimeterPatrolCoverage (
-  const string & region_id, double e_time, 
+  const string & region_id, double e_time, double spacing,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform, variables::Sensors * sensors,
   variables::Self * self, variables::Agents * agents) :
   BaseAreaCoverage (knowledge, platform, sensors, self, agents, e_time),
-  region_id_ (region_id)
+  region_id_ (region_id), spacing_ (spacing)
 {
   // initialize some status variables
   status_.init_vars (*knowledge, "ppac", self->agent.prefix);
@@ -206,46 +219,41 @@ gams::algorithms::area_coverage::PerimeterPatrolCoverage::generate_positions (vo
     pose::SearchArea sa;
     sa.from_container (*knowledge_, region_id_);
     pose::Region reg = sa.get_convex_hull ();
-    vector<utility::GPSPosition> vertices;
-    vertices.reserve(reg.vertices.size());
-    for (pose::Position vert : reg.vertices)
-    {
-      vertices.push_back(utility::GPSPosition(
-        vert.transform_to(pose::gps_frame())));
-    }
+    utility::Perimeter perimeter (reg.vertices);
+
+    if (perimeter.empty ())
+      return;
 
-    // find closest waypoint as starting point
-    size_t closest = 0;
+    // start from the closest point on the perimeter
     utility::GPSPosition current;
     current.from_container (self_->agent.location);
-    double min_distance = current.distance_to (vertices[0]);
-    for (size_t i = 1; i < vertices.size (); ++i)
+    const double start = perimeter.project (pose::Position (
+      pose::gps_frame (), current.longitude (), current.latitude ()));
+
+    std::vector<double> distances;
+    if (spacing_ > 0 && perimeter.get_length () > 0)
     {
-      double dist = current.distance_to (vertices[i]);
-      if (min_distance > dist)
-      {
-        dist = min_distance;
-        closest = i;
-      }
+      distances = perimeter.spaced (std::max ((size_t)1, (size_t)std::ceil (
+        perimeter.get_length () / spacing_)), start);
     }
-
-    // add some intermediate points
-    const size_t NUM_INTERMEDIATE_PTS = 1;
-    for (size_t i = 0; i < vertices.size (); ++i)
+    else
     {
-      utility::GPSPosition start = vertices[(i + closest) % vertices.size ()];
-      utility::GPSPosition end = vertices[(i + closest + 1) % vertices.size ()];
-      double lat_dif = start.latitude () - end.latitude ();
-      double lon_dif = start.longitude () - end.longitude ();
+      // the vertices, beginning with the end of the closest edge
+      const size_t edge = perimeter.edge_at (start);
+      for (size_t i = 1; i <= perimeter.size (); ++i)
+        distances.push_back (perimeter.get_distance (
+          (edge + i) % perimeter.size ()));
+    }
 
-      for (size_t j = 0; j < NUM_INTERMEDIATE_PTS; ++j)
-      {
-        utility::GPSPosition temp (
-          start.latitude () - lat_dif * j / NUM_INTERMEDIATE_PTS,
-          start.longitude () - lon_dif * j / NUM_INTERMEDIATE_PTS,
-          self_->agent.desired_altitude.to_double ());
-        waypoints_.push_back (temp);
-      }
+    waypoints_.clear ();
+    waypoints_.reserve (distances.size ());
+    for (double distance : distances)
+    {
+      pose::Position waypoint = perimeter.position_at (distance).transform_to (
+        pose::gps_frame ());
+      waypoints_.push_back (utility::GPSPosition (
+        waypoint.lat (), waypoint.lng (),
+        self_->agent.desired_altitude.to_double ()));
     }
 
     // set next_position_
@@ -266,6 +274,7 @@ gams::algorithms::area_coverage::PerimeterPatrolCoverage::operator= (
     this->BaseAreaCoverage::operator= (rhs);
     this->waypoints_ = rhs.waypoints_;
     this->cur_waypoint_ = rhs.cur_waypoint_;
+    this->spacing_ = rhs.spacing_;
   }
 }
 
@@ -65,6 +65,7 @@
 #include "gams/variables/AlgorithmStatus.h"
 #include "gams/variables/Self.h"
 #include "gams/algorithms/AlgorithmFactory.h"
+#include "gams/utility/Perimeter.h"
 
 namespace gams
 {
@@ -82,6 +83,8 @@ namespace gams
          * Constructor
          * @param  region_id  id of region to be covered
          * @param  e_time     time to execute algorithm, 0 for infinite
+         * @param  spacing    meters between waypoints. If 0 or less, the
+         *                    waypoints are the vertices of the region.
          * @param  knowledge  the context containing variables and values
          * @param  platform   the underlying platform the algorithm will use
          * @param  sensors    map of sensor names to sensor information
@@ -91,6 +94,7 @@ namespace gams
         PerimeterPatrolCoverage (
           const std::string& region_id,
           double e_time,
+          double spacing,
           madara::knowledge::KnowledgeBase * knowledge = 0,
           platforms::BasePlatform * platform = 0,
           variables::Sensors * sensors = 0,
@@ -125,6 +129,9 @@ namespace gams
 
         /// indicates the region to patrol the border of
         std::string region_id_;
+
+        /// meters between waypoints, or 0 to use the vertices
+        double spacing_;
       }; // class PerimeterPatrolCoverage
       
       /**
@@ -137,7 +144,9 @@ namespace gams
 
         /**
          * Creates a perimeter patrol algorithm.
-         * @param   args      args[0] = search area id
+         * @param   args      area = search area id
+         *                    time = time to execute algorithm
+         *                    spacing = meters between waypoints
          * @param   knowledge the knowledge base to use
          * @param   platform  the platform. This will be set by the
          *                    controller in init_vars.
@@ -88,6 +88,7 @@ gams::algorithms::area_coverage::SnakeAreaCoverageFactory::create (
   {
     std::string search_area;
     double time = 360;
+    bool partition = false;
 
     for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
     {
@@ -108,6 +109,18 @@ gams::algorithms::area_coverage::SnakeAreaCoverageFactory::create (
           break;
         }
         goto unknown;
+      case 'p':
+        if (i->first == "partition")
+        {
+          partition = i->second.is_true ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::SnakeAreaCoverageFactory:" \
+            " setting partition to %d\n", (int)partition);
+          break;
+        }
+        goto unknown;
       case 's':
         if (i->first == "search_area")
         {
@@ -154,7 +167,7 @@ gams::algorithms::area_coverage::SnakeAreaCoverageFactory::create (
     else
     {
       result = new area_coverage::SnakeAreaCoverage (
-        search_area, time,
+        search_area, time, partition,
         knowledge, platform, sensors, self, agents);
     }
   }
@@ -165,14 +178,17 @@ gams::algorithms::area_coverage::SnakeAreaCoverageFactory::create (
 /**
  * SnakeAreaCoverage is a precomputed area coverage algorithm. The agent
  * traverses parallel lines in the region starting with the longest edge.
+ * If partitioning, the region is the agent's cell of the area.
  */
 gams::algorithms::area_coverage::SnakeAreaCoverage::SnakeAreaCoverage (
   const string& region_id,
   double e_time,
+  bool partition,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform, variables::Sensors * sensors,
   variables::Self * self, variables::Agents * agents) :
-  BaseAreaCoverage (knowledge, platform, sensors, self, agents, e_time),
+  BaseAreaCoverage (knowledge, platform, sensors, self, agents, e_time,
+    partition),
   cur_waypoint_ (0), region_id_ (region_id)
 {
   status_.init_vars (*knowledge, "sac", self->agent.prefix);
@@ -239,7 +255,22 @@ gams::algorithms::area_coverage::SnakeAreaCoverage::compute_waypoints (
   {
     // get region information
     pose::Region region;
-    region.from_container (*knowledge_, region_id);
+    if (partition_)
+      region = get_cell (region_id);
+    else
+      region.from_container (*knowledge_, region_id);
+
+    waypoints_.clear ();
+    cur_waypoint_ = 0;
+
+    if (region.vertices.size () < 3)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+        "gams::algorithms::SnakeAreaCoverage::compute_waypoints:" \
+        " region \"%s\" has fewer than 3 vertices\n", region_id.c_str ());
+      return;
+    }
 
     madara_logger_ptr_log (gams::loggers::global_logger.get (),
       gams::loggers::LOG_DETAILED,
@@ -82,6 +82,8 @@ namespace gams
          * Constructor
          * @param  region_id  id of region to be covered
          * @param  e_time     time to execute algorithm
+         * @param  partition  if true, cover only this agent's cell of the
+         *                    region, split between the agents
          * @param  knowledge  the context containing variables and values
          * @param  platform   the underlying platform the algorithm will use
          * @param  sensors    map of sensor names to sensor information
@@ -91,6 +93,7 @@ namespace gams
         SnakeAreaCoverage (
           const std::string& region_id,
           double e_time,
+          bool partition,
           madara::knowledge::KnowledgeBase * knowledge = 0,
           platforms::BasePlatform * platform = 0,
           variables::Sensors * sensors = 0,
@@ -140,7 +143,9 @@ namespace gams
 
         /**
          * Creates a snake area coverage algorithm
-         * @param   args      args[0] = region id
+         * @param   args      area = region id
+         *                    time = time to execute algorithm
+         *                    partition = cover only this agent's cell
          * @param   knowledge the knowledge base to use
          * @param   platform  the platform. This will be set by the
          *                    controller in init_vars.
@@ -79,6 +79,7 @@ gams::algorithms::area_coverage::UniformRandomAreaCoverageFactory::create (
   {
     std::string search_area;
     double time = 360;
+    bool partition = false;
 
     for (KnowledgeMap::const_iterator i = args.begin (); i != args.end (); ++i)
     {
@@ -99,6 +100,18 @@ gams::algorithms::area_coverage::UniformRandomAreaCoverageFactory::create (
           break;
         }
         goto unknown;
+      case 'p':
+        if (i->first == "partition")
+        {
+          partition = i->second.is_true ();
+
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_DETAILED,
+            "gams::algorithms::UniformRandomAreaCoverageFactory:" \
+            " setting partition to %d\n", (int)partition);
+          break;
+        }
+        goto unknown;
       case 's':
         if (i->first == "search_area")
         {
@@ -145,7 +158,7 @@ gams::algorithms::area_coverage::UniformRandomAreaCoverageFactory::create (
     else
     {
       result = new area_coverage::UniformRandomAreaCoverage (
-        search_area, time,
+        search_area, time, partition,
         knowledge, platform, sensors, self, agents);
     }
   }
@@ -157,21 +170,22 @@ gams::algorithms::area_coverage::UniformRandomAreaCoverage::
   UniformRandomAreaCoverage (
   const string& search_area_id,
   double e_time,
+  bool partition,
   madara::knowledge::KnowledgeBase * knowledge,
   platforms::BasePlatform * platform,
   variables::Sensors * sensors,
   variables::Self * self,
   variables::Agents * agents) :
-  BaseAreaCoverage (knowledge, platform, sensors, self, agents, e_time)
+  BaseAreaCoverage (knowledge, platform, sensors, self, agents, e_time,
+    partition),
+  search_area_id_ (search_area_id)
 {
   // init status vars
   status_.init_vars (*knowledge, "urac", self->agent.prefix);
   status_.init_variable_values ();
 
   // get region to cover
-  pose::SearchArea search;
-  search.from_container (*knowledge, search_area_id);
-  region_ = search.get_convex_hull ();
+  region_ = get_cell (search_area_id);
 
   // generate initial waypoint
   generate_new_position();
@@ -190,6 +204,7 @@ gams::algorithms::area_coverage::UniformRandomAreaCoverage::operator= (
   {
     this->BaseAreaCoverage::operator= (rhs);
     this->region_ = rhs.region_;
+    this->search_area_id_ = rhs.search_area_id_;
   }
 }
 
@@ -206,6 +221,13 @@ gams::algorithms::area_coverage::UniformRandomAreaCoverage::
 {
   if (platform_ && *platform_->get_platform_status ()->movement_available)
   {
+    // our cell changes with the agents
+    if (partition_ && !initialized_)
+      region_ = get_cell (search_area_id_);
+
+    if (region_.vertices.size () < 3)
+      return;
+
     do
     {
       next_position_.latitude (madara::utility::rand_double (region_.min_lat_,
@@ -79,6 +79,8 @@ namespace gams
          * Constructor
          * @param search_area_id  identifier of region to cover
          * @param e_time          time to execute algorithm
+         * @param partition       if true, cover only this agent's cell of
+         *                        the area, split between the agents
          * @param knowledge       the context containing variables and values
          * @param platform        the underlying platform the algorithm will use
          * @param sensors         map of sensor names to sensor information
@@ -88,6 +90,7 @@ namespace gams
         UniformRandomAreaCoverage (
           const std::string& search_area_id,
           double e_time,
+          bool partition,
           madara::knowledge::KnowledgeBase * knowledge = 0,
           platforms::BasePlatform * platform = 0,
           variables::Sensors * sensors = 0,
@@ -113,6 +116,9 @@ namespace gams
 
         /// region to cover
         pose::Region region_;
+
+        /// identifier of the search area
+        std::string search_area_id_;
       };
 
       /**
@@ -126,7 +132,9 @@ namespace gams
 
         /**
          * Creates a uniform random area coverage algorithm
-         * @param   args      args[0] = region id
+         * @param   args      area = region id
+         *                    time = time to execute algorithm
+         *                    partition = cover only this agent's cell
          * @param   knowledge the knowledge base to use
          * @param   platform  the platform. This will be set by the
          *                    controller in init_vars.
@@ -213,7 +213,9 @@ gams::algorithms::JavaAlgorithm::JavaAlgorithm (
   variables::Sensors * sensors,
   variables::Self * self,
   variables::Agents * agents)
-  : BaseAlgorithm (knowledge, platform, sensors, self, agents)
+  : BaseAlgorithm (knowledge, platform, sensors, self, agents),
+  obj_ (0), class_ (0), analyze_method_ (0), execute_method_ (0),
+  plan_method_ (0), get_id_method_ (0), get_name_method_ (0)
 {
   gams::utility::java::Acquire_VM jvm;
 
@@ -232,13 +234,18 @@ gams::algorithms::JavaAlgorithm::JavaAlgorithm (
         gams::loggers::LOG_MAJOR,
          "gams::algorithms::JavaAlgorithm::constructor:" \
         " allocating global reference for object's class.\n");
-      class_ = (jclass) jvm.env->NewGlobalRef (jvm.env->GetObjectClass (obj_));
+      jclass local_class = jvm.env->GetObjectClass (obj_);
+      class_ = (jclass) jvm.env->NewGlobalRef (local_class);
+      jvm.env->DeleteLocalRef (local_class);
+
       if (class_)
       {
         madara_logger_ptr_log (gams::loggers::global_logger.get (),
           gams::loggers::LOG_MAJOR,
            "gams::algorithms::JavaAlgorithm::constructor:" \
           " class and object obtained successfully.\n");
+
+        resolve_methods (jvm.env);
       }
       else
       {
@@ -280,6 +287,25 @@ gams::algorithms::JavaAlgorithm::~JavaAlgorithm ()
   }
 }
 
+void
+gams::algorithms::JavaAlgorithm::resolve_methods (JNIEnv * env)
+{
+  using utility::java::find_method;
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+     "gams::algorithms::JavaAlgorithm::resolve_methods:" \
+    " Obtaining user-defined methods.\n");
+
+  analyze_method_ = find_method (env, class_, "analyze", "()I");
+  execute_method_ = find_method (env, class_, "execute", "()I");
+  plan_method_ = find_method (env, class_, "plan", "()I");
+  get_id_method_ = find_method (env, class_,
+    "getId", "()Ljava/lang/String;");
+  get_name_method_ = find_method (env, class_,
+    "getName", "()Ljava/lang/String;");
+}
+
 void
 gams::algorithms::JavaAlgorithm::operator= (const JavaAlgorithm & rhs)
 {
@@ -314,6 +340,12 @@ gams::algorithms::JavaAlgorithm::operator= (const JavaAlgorithm & rhs)
 
       obj_ = jvm.env->NewGlobalRef (rhs.obj_);
       class_ = (jclass) jvm.env->NewGlobalRef (rhs.class_);
+
+      analyze_method_ = rhs.analyze_method_;
+      execute_method_ = rhs.execute_method_;
+      plan_method_ = rhs.plan_method_;
+      get_id_method_ = rhs.get_id_method_;
+      get_name_method_ = rhs.get_name_method_;
     }
     else
     {
@@ -328,25 +360,18 @@ gams::algorithms::JavaAlgorithm::operator= (const JavaAlgorithm & rhs)
 int
 gams::algorithms::JavaAlgorithm::analyze (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::algorithms::JavaAlgorithm::analyze:" \
-      " Obtaining user-defined analyze method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "analyze", "()I");
-
-    if (call)
+    if (analyze_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::algorithms::JavaAlgorithm::analyze:" \
         " Calling user-defined analyze method.\n");
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, analyze_method_);
     }
     else
     {
@@ -369,29 +394,27 @@ gams::algorithms::JavaAlgorithm::analyze (void)
 
 std::string gams::algorithms::JavaAlgorithm::get_id () const
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   std::string id;
   jstring result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::algorithms::JavaAlgorithm::get_id:" \
-      " Obtaining user-defined getId method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "getId", "()Ljava.lang.String;");
-
-    if (call)
+    if (get_id_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::algorithms::JavaAlgorithm::get_id:" \
         " Calling user-defined getId method.\n");
 
-      result = (jstring)jvm.env->CallObjectMethod (obj_, call);
-      const char * id_chars = jvm.env->GetStringUTFChars (result, 0);
-      id = id_chars;
+      result = (jstring)jvm.env->CallObjectMethod (obj_, get_id_method_);
+      if (result)
+      {
+        const char * id_chars = jvm.env->GetStringUTFChars (result, 0);
+        id = id_chars;
+        jvm.env->ReleaseStringUTFChars (result, id_chars);
+        jvm.env->DeleteLocalRef (result);
+      }
     }
     else
     {
@@ -414,29 +437,27 @@ std::string gams::algorithms::JavaAlgorithm::get_id () const
 
 std::string gams::algorithms::JavaAlgorithm::get_name () const
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   std::string name;
   jstring result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::algorithms::JavaAlgorithm::get_name:" \
-      " Obtaining user-defined getName method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "getName", "()Ljava.lang.String;");
-
-    if (call)
+    if (get_name_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::algorithms::JavaAlgorithm::get_name:" \
         " Calling user-defined getName method.\n");
 
-      result = (jstring)jvm.env->CallObjectMethod (obj_, call);
-      const char * name_chars = jvm.env->GetStringUTFChars (result, 0);
-      name = name_chars;
+      result = (jstring)jvm.env->CallObjectMethod (obj_, get_name_method_);
+      if (result)
+      {
+        const char * name_chars = jvm.env->GetStringUTFChars (result, 0);
+        name = name_chars;
+        jvm.env->ReleaseStringUTFChars (result, name_chars);
+        jvm.env->DeleteLocalRef (result);
+      }
     }
     else
     {
@@ -460,26 +481,19 @@ std::string gams::algorithms::JavaAlgorithm::get_name () const
 int
 gams::algorithms::JavaAlgorithm::execute (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::algorithms::JavaAlgorithm::execute:" \
-      " Obtaining user-defined execute method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "execute", "()I");
-
-    if (call)
+    if (execute_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::algorithms::JavaAlgorithm::execute:" \
         " Calling user-defined execute method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, execute_method_);
     }
     else
     {
@@ -503,26 +517,19 @@ gams::algorithms::JavaAlgorithm::execute (void)
 int
 gams::algorithms::JavaAlgorithm::plan (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::algorithms::JavaAlgorithm::plan:" \
-      " Obtaining user-defined plan method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "plan", "()I");
-
-    if (call)
+    if (plan_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::algorithms::JavaAlgorithm::plan:" \
         " Calling user-defined plan method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, plan_method_);
     }
     else
     {
@@ -546,7 +553,7 @@ gams::algorithms::JavaAlgorithm::plan (void)
 jobject
 gams::algorithms::JavaAlgorithm::get_java_instance (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jobject result (0);
 
   if (jvm.env)
@@ -142,11 +142,34 @@ namespace gams
       jobject get_java_instance (void);
 
     protected:
+      /**
+       * Resolves the method IDs of class_. Method IDs stay valid while the
+       * class is loaded, which the global reference guarantees, so this is
+       * done once rather than per call.
+       * @param  env   Java environment
+       **/
+      void resolve_methods (JNIEnv * env);
+
       /// the Java object with callable methods
       jobject obj_;
 
       /// the class of the Java object obj_
       jclass class_;
+
+      /// obj_.analyze
+      jmethodID analyze_method_;
+
+      /// obj_.execute
+      jmethodID execute_method_;
+
+      /// obj_.plan
+      jmethodID plan_method_;
+
+      /// obj_.getId
+      jmethodID get_id_method_;
+
+      /// obj_.getName
+      jmethodID get_name_method_;
     };
 
 
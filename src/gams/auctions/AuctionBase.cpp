@@ -45,7 +45,49 @@
 **/
 
 #include "AuctionBase.h"
+#include "gams/loggers/GlobalLogger.h"
 #include <sstream>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+  /**
+   * Encodes a partial result as "count amount leader"
+   **/
+  std::string encode_partial (size_t count, double amount,
+    const std::string & leader)
+  {
+    char buffer[64];
+    snprintf (buffer, sizeof (buffer), "%lu %.17g ",
+      (unsigned long)count, amount);
+
+    return buffer + leader;
+  }
+
+  /**
+   * Decodes a partial result
+   * @return false if the partial result has no bids
+   **/
+  bool decode_partial (const std::string & partial, size_t & count,
+    double & amount, std::string & leader)
+  {
+    const char * cur = partial.c_str ();
+    char * end = 0;
+
+    count = (size_t)strtoul (cur, &end, 10);
+    if (end == cur || count == 0 || *end != ' ')
+      return false;
+
+    cur = end + 1;
+    amount = strtod (cur, &end);
+    if (end == cur || *end != ' ')
+      return false;
+
+    leader = end + 1;
+    return true;
+  }
+}
 
 gams::auctions::AuctionBase::AuctionBase (const std::string & auction_prefix,
   const std::string & agent_prefix,
@@ -53,7 +95,8 @@ gams::auctions::AuctionBase::AuctionBase (const std::string & auction_prefix,
   : knowledge_ (knowledge),
     auction_prefix_ (auction_prefix),
     agent_prefix_ (agent_prefix),
-    round_ (0)
+    round_ (0), discovered_ (false), tree_fanout_ (0),
+    tree_version_ (0), tree_bound_ (false), tree_index_ (-1), tree_bids_ (0)
 {
   reset_bids_pointer ();
 }
@@ -69,6 +112,9 @@ gams::auctions::AuctionBase::add_group (groups::GroupBase * group)
   group->get_members (members);
 
   group_.add_members (members);
+
+  for (size_t i = 0; i < members.size (); ++i)
+    track (members[i]);
 }
 
 void
@@ -94,15 +140,25 @@ double
 gams::auctions::AuctionBase::get_participation (void) const
 {
   double result = 1.0;
-  AuctionBids bids;
-  groups::AgentVector members;
+  size_t count = 0;
 
-  get_bids (bids);
-  group_.get_members (members);
+  if (tree_fanout_ > 0)
+  {
+    update_bids ();
+    count = tree_bids_;
+  }
+  else
+  {
+    AuctionBids bids;
+    get_bids (bids);
+    count = bids.size ();
+  }
+
+  const groups::AgentVector & members = group_.get_member_list ();
 
   if (members.size () > 0)
   {
-    result = (double)bids.size () / members.size ();
+    result = (double)count / members.size ();
   }
 
   return result;
@@ -123,17 +179,252 @@ gams::auctions::AuctionBase::set_knowledge_base (
   reset_bids_pointer ();
 }
 
+void
+gams::auctions::AuctionBase::set_tree (size_t fanout)
+{
+  tree_fanout_ = fanout;
+
+  if (fanout > 0)
+  {
+    tree_.set_fanout (fanout);
+    tree_.set_group (&group_);
+  }
+
+  // in tree mode, only partial results leave this agent
+  bids_.set_settings (madara::knowledge::KnowledgeUpdateSettings (fanout > 0));
+
+  leaders_.clear ();
+  tree_bound_ = false;
+}
+
 void
 gams::auctions::AuctionBase::sync (void)
 {
   bids_.sync_keys ();
+  discover ();
 }
 
 void
 gams::auctions::AuctionBase::bid (const std::string & agent,
   const madara::knowledge::KnowledgeRecord & amount)
 {
+  // in tree mode, a member's partial result only counts its own bid
+  if (tree_fanout_ > 0 && agent != agent_prefix_)
+  {
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_ERROR,
+      "gams::auctions::AuctionBase::bid:" \
+      " %s cannot bid for %s in tree mode. Ignoring bid.\n",
+      agent_prefix_.c_str (), agent.c_str ());
+    return;
+  }
+
   bids_.set (agent, amount.to_double ());
+  track (agent);
+
+  // publish the new partial result with the next send, without waiting
+  // for this agent to poll
+  if (tree_fanout_ > 0)
+    update_bids ();
+}
+
+void
+gams::auctions::AuctionBase::track (const std::string & bidder) const
+{
+  if (knowledge_ && auction_prefix_ != "" &&
+    bidder_index_.find (bidder) == bidder_index_.end ())
+  {
+    Bidder entry;
+    entry.name = bidder;
+    entry.ref = knowledge_->get_ref (
+      get_auction_round_prefix () + "." + bidder);
+
+    bidder_index_[bidder] = bidders_.size ();
+    bidders_.push_back (entry);
+  }
+}
+
+void
+gams::auctions::AuctionBase::discover (void) const
+{
+  if (!knowledge_ || auction_prefix_ == "")
+    return;
+
+  if (!discovered_)
+  {
+    const groups::AgentVector & members = group_.get_member_list ();
+    for (size_t i = 0; i < members.size (); ++i)
+      track (members[i]);
+  }
+
+  const std::string prefix = get_auction_round_prefix () + ".";
+
+  madara::knowledge::VariableReferences refs;
+  knowledge_->get_matches (prefix, "", refs);
+
+  for (size_t i = 0; i < refs.size (); ++i)
+  {
+    const std::string bidder = std::string (refs[i].get_name ()).substr (
+      prefix.size ());
+
+    if (bidder_index_.find (bidder) == bidder_index_.end ())
+    {
+      Bidder entry;
+      entry.name = bidder;
+      entry.ref = refs[i];
+
+      bidder_index_[bidder] = bidders_.size ();
+      bidders_.push_back (entry);
+    }
+  }
+
+  discovered_ = true;
+}
+
+void
+gams::auctions::AuctionBase::update_bids (void) const
+{
+  if (!knowledge_)
+    return;
+
+  madara::knowledge::ContextGuard guard (*knowledge_);
+
+  if (tree_fanout_ > 0)
+  {
+    update_tree ();
+    return;
+  }
+
+  // the round is searched once, and again on each sync, so polling
+  // does not scan the knowledge base
+  if (!discovered_)
+    discover ();
+
+  for (size_t i = 0; i < bidders_.size (); ++i)
+  {
+    Bidder & bidder = bidders_[i];
+    madara::knowledge::KnowledgeRecord amount = knowledge_->get (bidder.ref);
+
+    if (amount.is_valid () == bidder.amount.is_valid () &&
+      (!amount.is_valid () || amount == bidder.amount))
+      continue;
+
+    if (amount.is_valid ())
+      leaders_.set (bidder.name, amount.to_double ());
+    else
+      leaders_.erase (bidder.name);
+
+    bidder.amount = amount;
+  }
+}
+
+void
+gams::auctions::AuctionBase::bind_tree (void) const
+{
+  tree_.update ();
+
+  tree_version_ = tree_.get_version ();
+  tree_index_ = tree_.get_index (agent_prefix_);
+  tree_children_.clear ();
+  tree_published_.clear ();
+
+  const std::string prefix = get_tree_prefix () + ".";
+
+  if (tree_.size () > 0)
+  {
+    tree_root_ = knowledge_->get_ref (prefix + tree_.get_members ()[0]);
+  }
+
+  if (tree_index_ >= 0)
+  {
+    tree_bid_ = knowledge_->get_ref (
+      get_auction_round_prefix () + "." + agent_prefix_);
+    tree_partial_ = knowledge_->get_ref (prefix + agent_prefix_);
+
+    std::vector<size_t> children;
+    tree_.get_children ((size_t)tree_index_, children);
+
+    for (size_t i = 0; i < children.size (); ++i)
+    {
+      tree_children_.push_back (knowledge_->get_ref (
+        prefix + tree_.get_members ()[children[i]]));
+    }
+  }
+
+  tree_bound_ = true;
+}
+
+void
+gams::auctions::AuctionBase::update_tree (void) const
+{
+  if (auction_prefix_ == "")
+    return;
+
+  if (!tree_bound_ || tree_.update () ||
+    tree_version_ != tree_.get_version ())
+  {
+    bind_tree ();
+  }
+
+  if (subtree_.is_ascending () != leaders_.is_ascending ())
+  {
+    subtree_.set_ascending (leaders_.is_ascending ());
+  }
+
+  subtree_.clear ();
+  size_t count = 0;
+  size_t child_count;
+  double amount;
+  std::string leader;
+
+  if (tree_index_ >= 0)
+  {
+    madara::knowledge::KnowledgeRecord bid = knowledge_->get (tree_bid_);
+
+    if (bid.is_valid ())
+    {
+      subtree_.set (agent_prefix_, bid.to_double ());
+      ++count;
+    }
+
+    for (size_t i = 0; i < tree_children_.size (); ++i)
+    {
+      if (decode_partial (knowledge_->get (tree_children_[i]).to_string (),
+        child_count, amount, leader))
+      {
+        subtree_.set (leader, amount);
+        count += child_count;
+      }
+    }
+
+    std::string partial = count > 0 ? encode_partial (
+      count, subtree_.get_leader_amount (), subtree_.get_leader ()) : "0";
+
+    if (partial != tree_published_)
+    {
+      knowledge_->set (tree_partial_, partial);
+      tree_published_ = partial;
+    }
+  }
+
+  // the root's partial result covers the whole group
+  leaders_.clear ();
+  tree_bids_ = 0;
+
+  if (tree_index_ == 0)
+  {
+    if (count > 0)
+    {
+      leaders_.set (subtree_.get_leader (), subtree_.get_leader_amount ());
+      tree_bids_ = count;
+    }
+  }
+  else if (tree_.size () > 0 && decode_partial (
+    knowledge_->get (tree_root_).to_string (), child_count, amount, leader))
+  {
+    leaders_.set (leader, amount);
+    tree_bids_ = child_count;
+  }
 }
 
 void gams::auctions::AuctionBase::advance_round (void)
@@ -157,39 +448,40 @@ void gams::auctions::AuctionBase::set_round (int round)
 void gams::auctions::AuctionBase::get_bids (
   AuctionBids & bids, bool strip_prefix, bool include_all_members) const
 {
+  bids.clear ();
+
   if (knowledge_)
   {
-    // get all bids
-    madara::knowledge::VariableReferences bid_refs;
-    knowledge_->get_matches (get_auction_round_prefix (), "", bid_refs);
-
-    // the bids should be same size as bid references
-    bids.resize (bid_refs.size ());
+    update_bids ();
 
-    // keep track of actual bids
-    size_t actuals = 0;
+    const std::string prefix = strip_prefix ?
+      "" : get_auction_round_prefix () + ".";
 
-    for (size_t i = 0; i < bid_refs.size (); ++i)
+    // only this agent's bid and its children's leaders are known
+    if (tree_fanout_ > 0)
     {
-      bids[actuals].amount = knowledge_->get (bid_refs[i]);
+      subtree_.get_bids (bids);
 
-      // if we're including all member bids or if the bid is real
-      if (include_all_members || bids[actuals].amount.is_valid ())
+      for (size_t i = 0; i < bids.size (); ++i)
       {
-        // set bidder to full name (includes round number)
-        bids[actuals].bidder = bid_refs[i].get_name ();
-        ++actuals;
+        bids[i].bidder = prefix + bids[i].bidder;
       }
-    } // end for loop over bid references
 
-    // resize the bids to smaller if necessary
-    if (actuals != bids.size ())
-      bids.resize (actuals);
+      return;
+    }
+
+    bids.reserve (bidders_.size ());
 
-    // strip the prefixes if necessary
-    if (strip_prefix)
+    for (size_t i = 0; i < bidders_.size (); ++i)
     {
-      strip_prefix_fast (get_auction_round_prefix () + ".", bids);
+      // if we're including all member bids or if the bid is real
+      if (include_all_members || bidders_[i].amount.is_valid ())
+      {
+        AuctionBid bid;
+        bid.bidder = prefix + bidders_[i].name;
+        bid.amount = bidders_[i].amount;
+        bids.push_back (bid);
+      }
     }
   } // end if knowledge base is valid
 }
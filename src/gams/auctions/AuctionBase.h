@@ -57,6 +57,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include "madara/knowledge/KnowledgeBase.h"
 #include "madara/knowledge/containers/Map.h"
@@ -64,16 +65,27 @@
 #include "AuctionTypesEnum.h"
 #include "gams/groups/GroupBase.h"
 #include "gams/groups/GroupFixedList.h"
+#include "gams/groups/GroupTree.h"
 #include "gams/GamsExport.h"
 
 #include "gams/auctions/AuctionBid.h"
+#include "gams/auctions/AuctionBidHeap.h"
 
 namespace gams
 {
   namespace auctions
   {
     /**
-    * Base class for an auction
+    * Base class for an auction. Bids are read through a cached reference
+    * per bidder and kept in an indexed heap, so finding the leader does
+    * not search or sort the knowledge base. Bidders are the members of
+    * the auction group, agents that bid through this auction, and any
+    * bidders found in the knowledge base when a round is first read or on
+    * sync (). Call sync () to find bidders from outside the group that
+    * post their first bid later in the round.
+    *
+    * With set_tree, bids are instead reduced up a groups::GroupTree over
+    * the auction group. See set_tree.
     **/
     class GAMS_EXPORT AuctionBase
     {
@@ -142,10 +154,42 @@ namespace gams
         madara::knowledge::KnowledgeBase * knowledge);
 
       /**
-      * Syncs the auction information from the knowledge base
+      * Syncs the auction information from the knowledge base, including
+      * any bidders that are not group members and bid from elsewhere
       **/
       virtual void sync (void);
 
+      /**
+      * Reduces bids up a tree over the auction group, instead of every
+      * agent reading every bid. Bids are kept local, and each member
+      * publishes only the leading bid and bid count of its subtree to
+      * {auction}.tree.{round}.{member}. A member reads its children and
+      * the root, which holds the leader of the whole group. bid publishes
+      * the bidder's partial result, but interior members only forward
+      * their children's results when they poll, so every member must keep
+      * calling get_leader (or get_bids) for bids to reach the root. A bid
+      * moves up one level per poll and send.
+      *
+      * Only the members of the auction group are counted, and each member
+      * counts only its own bid, so bidding for another agent is rejected.
+      * get_bids returns this agent's bid and the leaders of its child
+      * subtrees.
+      * @param  fanout   children per member, or 0 to read every bid
+      **/
+      virtual void set_tree (size_t fanout);
+
+      /**
+      * Gets the fanout of the aggregation tree
+      * @return  children per member, or 0 if every bid is read
+      **/
+      size_t get_tree_fanout (void) const;
+
+      /**
+      * Returns the prefix of the partial results in this round
+      * @return  the tree prefix (e.g., auction.protectors.tree.0)
+      **/
+      std::string get_tree_prefix (void) const;
+
       /**
       * Gets the prefix for the current agent
       * @return  the name of this bidding agent (e.g. agent.0)
@@ -177,7 +221,8 @@ namespace gams
       void bid (const madara::knowledge::KnowledgeRecord & amount);
 
       /**
-      * Bids in the auction
+      * Bids in the auction. In tree mode, only bids for this agent are
+      * accepted (@see set_tree).
       * @param  agent  the agent prefix who is bidding
       * @param  amount bidded amount. This is a very flexible amount
       *         that allows for almost any type of MADARA data type.
@@ -244,6 +289,51 @@ namespace gams
        **/
       void reset_bids_pointer (void);
 
+      /**
+       * Starts reading a bidder's bid from the knowledge base
+       * @param  bidder  the bidder (e.g., agent.0)
+       **/
+      void track (const std::string & bidder) const;
+
+      /**
+       * Searches the knowledge base for bidders in the current round.
+       * Runs on the first read of a round and on each sync.
+       **/
+      void discover (void) const;
+
+      /**
+       * Reads every tracked bid and updates the leaders for the bids that
+       * changed. O(B) reads, plus O(log B) per changed bid.
+       **/
+      void update_bids (void) const;
+
+      /**
+       * Reduces this agent's bid and its children's partial results,
+       * publishes the partial result of its subtree, and sets leaders_ to
+       * the root's leader. O(fanout log fanout).
+       **/
+      void update_tree (void) const;
+
+      /**
+       * Binds the tree references for the current round and members
+       **/
+      void bind_tree (void) const;
+
+      /**
+       * A bidder whose bid is read through a cached reference
+       **/
+      struct Bidder
+      {
+        /// the bidder (e.g., agent.0)
+        std::string name;
+
+        /// reference to the bid in the current round
+        madara::knowledge::VariableReference ref;
+
+        /// the last bid read
+        madara::knowledge::KnowledgeRecord amount;
+      };
+
       /**
       * The knowledge base to use as a data plane
       **/
@@ -273,6 +363,87 @@ namespace gams
        * the expected participant group
        **/
       groups::GroupFixedList group_;
+
+      /**
+       * the bidders being tracked in this round
+       **/
+      mutable std::vector<Bidder> bidders_;
+
+      /**
+       * index of each bidder in bidders_
+       **/
+      mutable std::unordered_map<std::string, size_t> bidder_index_;
+
+      /**
+       * the valid bids, ordered so the leader is on top. Subclasses set
+       * which bid leads.
+       **/
+      mutable AuctionBidHeap leaders_;
+
+      /**
+       * true once this round has been searched for bidders
+       **/
+      mutable bool discovered_;
+
+      /**
+       * children per member in tree mode, or 0 to read every bid
+       **/
+      size_t tree_fanout_;
+
+      /**
+       * the tree over the auction group
+       **/
+      mutable groups::GroupTree tree_;
+
+      /**
+       * the tree version the references were bound for
+       **/
+      mutable uint64_t tree_version_;
+
+      /**
+       * true if the tree references are bound for this round
+       **/
+      mutable bool tree_bound_;
+
+      /**
+       * this agent's position in the tree, or -1 if not a member
+       **/
+      mutable int tree_index_;
+
+      /**
+       * this agent's bid in the current round
+       **/
+      mutable madara::knowledge::VariableReference tree_bid_;
+
+      /**
+       * this agent's partial result
+       **/
+      mutable madara::knowledge::VariableReference tree_partial_;
+
+      /**
+       * the partial results of this agent's children
+       **/
+      mutable std::vector<madara::knowledge::VariableReference> tree_children_;
+
+      /**
+       * the partial result of the root
+       **/
+      mutable madara::knowledge::VariableReference tree_root_;
+
+      /**
+       * the partial result last published by this agent
+       **/
+      mutable std::string tree_published_;
+
+      /**
+       * this agent's bid and the leaders of its child subtrees
+       **/
+      mutable AuctionBidHeap subtree_;
+
+      /**
+       * the number of bids counted at the root
+       **/
+      mutable size_t tree_bids_;
     };
   }
 }
@@ -81,6 +81,30 @@ gams::auctions::AuctionBase::reset_bids_pointer (void)
   {
     bids_.set_name (get_auction_round_prefix (), *knowledge_);
   }
+
+  // references point into the old round
+  bidders_.clear ();
+  bidder_index_.clear ();
+  leaders_.clear ();
+  discovered_ = false;
+  tree_bound_ = false;
+}
+
+inline size_t
+gams::auctions::AuctionBase::get_tree_fanout (void) const
+{
+  return tree_fanout_;
+}
+
+inline std::string
+gams::auctions::AuctionBase::get_tree_prefix (void) const
+{
+  std::stringstream buffer;
+  buffer << auction_prefix_;
+  buffer << ".tree.";
+  buffer << round_;
+
+  return buffer.str ();
 }
 
 inline std::string
@@ -0,0 +1,251 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file AuctionBidHeap.cpp
+*
+* This file contains the implementation of an indexed heap of auction bids
+**/
+
+#include "AuctionBidHeap.h"
+
+#include <utility>
+
+namespace
+{
+  /// returned as the leader of an empty heap
+  const std::string NO_LEADER;
+}
+
+gams::auctions::AuctionBidHeap::AuctionBidHeap (bool ascending)
+  : ascending_ (ascending)
+{
+}
+
+void
+gams::auctions::AuctionBidHeap::set_ascending (bool ascending)
+{
+  if (ascending != ascending_)
+  {
+    ascending_ = ascending;
+
+    // rebuild bottom up
+    for (size_t i = heap_.size () / 2; i > 0; --i)
+      sift_down (i - 1);
+  }
+}
+
+bool
+gams::auctions::AuctionBidHeap::is_ascending (void) const
+{
+  return ascending_;
+}
+
+void
+gams::auctions::AuctionBidHeap::clear (void)
+{
+  heap_.clear ();
+  positions_.clear ();
+}
+
+size_t
+gams::auctions::AuctionBidHeap::size (void) const
+{
+  return heap_.size ();
+}
+
+bool
+gams::auctions::AuctionBidHeap::empty (void) const
+{
+  return heap_.empty ();
+}
+
+void
+gams::auctions::AuctionBidHeap::set (const std::string & bidder, double amount)
+{
+  std::unordered_map<std::string, size_t>::iterator found =
+    positions_.find (bidder);
+
+  if (found == positions_.end ())
+  {
+    Entry entry;
+    entry.bidder = bidder;
+    entry.amount = amount;
+
+    positions_[bidder] = heap_.size ();
+    heap_.push_back (entry);
+    sift_up (heap_.size () - 1);
+  }
+  else if (heap_[found->second].amount != amount)
+  {
+    const size_t index = found->second;
+    heap_[index].amount = amount;
+    sift_up (index);
+    sift_down (positions_[bidder]);
+  }
+}
+
+bool
+gams::auctions::AuctionBidHeap::erase (const std::string & bidder)
+{
+  std::unordered_map<std::string, size_t>::iterator found =
+    positions_.find (bidder);
+
+  if (found == positions_.end ())
+    return false;
+
+  const size_t index = found->second;
+  const size_t last = heap_.size () - 1;
+
+  if (index != last)
+    swap (index, last);
+
+  positions_.erase (bidder);
+  heap_.pop_back ();
+
+  // the entry moved into index may belong higher or lower
+  if (index < heap_.size ())
+  {
+    const std::string moved = heap_[index].bidder;
+    sift_up (index);
+    sift_down (positions_[moved]);
+  }
+
+  return true;
+}
+
+bool
+gams::auctions::AuctionBidHeap::get (
+  const std::string & bidder, double & amount) const
+{
+  std::unordered_map<std::string, size_t>::const_iterator found =
+    positions_.find (bidder);
+
+  if (found == positions_.end ())
+    return false;
+
+  amount = heap_[found->second].amount;
+  return true;
+}
+
+const std::string &
+gams::auctions::AuctionBidHeap::get_leader (void) const
+{
+  return heap_.empty () ? NO_LEADER : heap_[0].bidder;
+}
+
+double
+gams::auctions::AuctionBidHeap::get_leader_amount (void) const
+{
+  return heap_.empty () ? 0 : heap_[0].amount;
+}
+
+void
+gams::auctions::AuctionBidHeap::get_bids (AuctionBids & bids) const
+{
+  bids.resize (heap_.size ());
+
+  for (size_t i = 0; i < heap_.size (); ++i)
+  {
+    bids[i].bidder = heap_[i].bidder;
+    bids[i].amount = madara::knowledge::KnowledgeRecord (heap_[i].amount);
+  }
+}
+
+bool
+gams::auctions::AuctionBidHeap::before (
+  const Entry & a, const Entry & b) const
+{
+  if (a.amount != b.amount)
+    return ascending_ ? a.amount < b.amount : a.amount > b.amount;
+
+  return a.bidder < b.bidder;
+}
+
+void
+gams::auctions::AuctionBidHeap::sift_up (size_t index)
+{
+  while (index > 0)
+  {
+    const size_t parent = (index - 1) / 2;
+
+    if (!before (heap_[index], heap_[parent]))
+      break;
+
+    swap (index, parent);
+    index = parent;
+  }
+}
+
+void
+gams::auctions::AuctionBidHeap::sift_down (size_t index)
+{
+  for (;;)
+  {
+    const size_t left = 2 * index + 1;
+    const size_t right = left + 1;
+    size_t best = index;
+
+    if (left < heap_.size () && before (heap_[left], heap_[best]))
+      best = left;
+    if (right < heap_.size () && before (heap_[right], heap_[best]))
+      best = right;
+
+    if (best == index)
+      break;
+
+    swap (index, best);
+    index = best;
+  }
+}
+
+void
+gams::auctions::AuctionBidHeap::swap (size_t a, size_t b)
+{
+  std::swap (heap_[a], heap_[b]);
+  positions_[heap_[a].bidder] = a;
+  positions_[heap_[b].bidder] = b;
+}
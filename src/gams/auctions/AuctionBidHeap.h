@@ -0,0 +1,184 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file AuctionBidHeap.h
+*
+* This file contains the definition of an indexed heap of auction bids
+**/
+
+#ifndef   _GAMS_AUCTIONS_AUCTION_BID_HEAP_H_
+#define   _GAMS_AUCTIONS_AUCTION_BID_HEAP_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "gams/GamsExport.h"
+#include "gams/auctions/AuctionBid.h"
+
+namespace gams
+{
+  namespace auctions
+  {
+    /**
+    * A binary heap of bids, indexed by bidder, so that the leading bid is
+    * always at the top and any bidder's bid can be changed or removed in
+    * O(log n). Equal bids are ordered by bidder name, so every agent with
+    * the same bids agrees on the leader.
+    **/
+    class GAMS_EXPORT AuctionBidHeap
+    {
+    public:
+      /**
+       * Constructor
+       * @param  ascending  if true, the lowest bid leads. Otherwise, the
+       *                    highest bid leads.
+       **/
+      AuctionBidHeap (bool ascending = true);
+
+      /**
+       * Changes which bid leads. O(n).
+       * @param  ascending  if true, the lowest bid leads
+       **/
+      void set_ascending (bool ascending);
+
+      /**
+       * Checks which bid leads
+       * @return true if the lowest bid leads
+       **/
+      bool is_ascending (void) const;
+
+      /**
+       * Removes all bids
+       **/
+      void clear (void);
+
+      /**
+       * Gets the number of bids
+       * @return the number of bids
+       **/
+      size_t size (void) const;
+
+      /**
+       * Checks if there are no bids
+       * @return true if there are no bids
+       **/
+      bool empty (void) const;
+
+      /**
+       * Adds or changes a bid. O(log n).
+       * @param  bidder   the bidder (e.g., agent.0)
+       * @param  amount   the amount of the bid
+       **/
+      void set (const std::string & bidder, double amount);
+
+      /**
+       * Removes a bid. O(log n).
+       * @param  bidder   the bidder (e.g., agent.0)
+       * @return true if the bidder had a bid
+       **/
+      bool erase (const std::string & bidder);
+
+      /**
+       * Gets a bid. O(1).
+       * @param  bidder   the bidder (e.g., agent.0)
+       * @param  amount   the amount of the bid, if found
+       * @return true if the bidder has a bid
+       **/
+      bool get (const std::string & bidder, double & amount) const;
+
+      /**
+       * Gets the leading bidder. O(1).
+       * @return the leading bidder, or an empty string if there are no bids
+       **/
+      const std::string & get_leader (void) const;
+
+      /**
+       * Gets the leading bid. O(1).
+       * @return the leading bid, or 0 if there are no bids
+       **/
+      double get_leader_amount (void) const;
+
+      /**
+       * Gets all bids, in heap order. O(n).
+       * @param  bids   the bids
+       **/
+      void get_bids (AuctionBids & bids) const;
+
+    private:
+      /// a bid in the heap
+      struct Entry
+      {
+        std::string bidder;
+        double amount;
+      };
+
+      /// true if a should be closer to the top than b
+      bool before (const Entry & a, const Entry & b) const;
+
+      /// moves the entry at index up to its place
+      void sift_up (size_t index);
+
+      /// moves the entry at index down to its place
+      void sift_down (size_t index);
+
+      /// swaps two entries and updates their positions
+      void swap (size_t a, size_t b);
+
+      /// if true, the lowest bid leads
+      bool ascending_;
+
+      /// the heap
+      std::vector<Entry> heap_;
+
+      /// position of each bidder in the heap
+      std::unordered_map<std::string, size_t> positions_;
+    };
+  }
+}
+
+#endif // _GAMS_AUCTIONS_AUCTION_BID_HEAP_H_
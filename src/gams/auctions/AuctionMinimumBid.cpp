@@ -100,51 +100,10 @@ gams::auctions::AuctionMinimumBid::get_leader (void)
 
   if (knowledge_)
   {
-    madara::knowledge::ContextGuard guard (*knowledge_);
-
-    madara::knowledge::VariableReferences bids;
-    knowledge_->get_matches (get_auction_round_prefix (), "", bids);
-
-    double leader_bid = -1;
-
-    if (bids.size () > 0)
-    {
-      leader_bid = knowledge_->get (bids[0]).to_double ();
-      leader = bids[0].get_name ();
-    }
-
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MINOR,
-      "gams::auctions::AuctionMinimumBid::get_leader:" \
-      " iterating through bids from %s\n",
-      auction_prefix_.c_str ());
-
-    for (size_t i = 1; i < bids.size (); ++i)
-    {
-      double current_bid = knowledge_->get (bids[i]).to_double ();
-
-      madara_logger_ptr_log (gams::loggers::global_logger.get (),
-        gams::loggers::LOG_DETAILED,
-        "gams::auctions::AuctionMinimumBid::get_leader:" \
-        " %s: bid from %s is %f\n",
-        auction_prefix_.c_str (), bids[i].get_name (), current_bid);
-
-      if (current_bid < leader_bid)
-      {
-        leader_bid = current_bid;
-        leader = bids[i].get_name ();
-
-        madara_logger_ptr_log (gams::loggers::global_logger.get (),
-          gams::loggers::LOG_MINOR,
-          "gams::auctions::AuctionMinimumBid::get_leader:" \
-          " %s: %s is new leader of auction\n",
-          auction_prefix_.c_str (), bids[i].get_name ());
-      }
-    }
+    update_bids ();
+    leader = leaders_.get_leader ();
   }
 
-  leader = leader.substr (bids_.get_name ().size () + 1);
-
   madara_logger_ptr_log (gams::loggers::global_logger.get (),
     gams::loggers::LOG_MAJOR,
     "gams::auctions::AuctionMinimumBid::get_leader:" \
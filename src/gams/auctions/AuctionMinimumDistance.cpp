@@ -102,13 +102,10 @@ gams::auctions::AuctionMinimumDistance::get_leader (void)
 
   std::string leader;
 
-  AuctionBids bids;
-  get_bids (bids);
-  sort_ascending (bids);
-
-  if (bids.size () > 0)
+  if (knowledge_)
   {
-    leader = bids[0].bidder;
+    update_bids ();
+    leader = leaders_.get_leader ();
   }
 
   madara_logger_ptr_log (gams::loggers::global_logger.get (),
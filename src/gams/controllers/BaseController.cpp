@@ -46,6 +46,7 @@
 
 #include "BaseController.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -54,6 +55,7 @@
 #include "gams/platforms/PlatformFactoryRepository.h"
 #include "gams/loggers/GlobalLogger.h"
 #include "gams/groups/GroupFactoryRepository.h"
+#include "gams/utility/EventBarrier.h"
 #include "madara/utility/EpochEnforcer.h"
 
 // Java-specific header includes
@@ -71,9 +73,10 @@ typedef  madara::utility::EpochEnforcer<
 gams::controllers::BaseController::BaseController (
   madara::knowledge::KnowledgeBase & knowledge,
   const ControllerSettings & settings)
-  : algorithm_ (0), knowledge_ (knowledge), platform_ (0),
-  settings_ (settings), checkpoint_count_ (0)
+  : algorithm_ (0), neighbors_ (&agents_), knowledge_ (knowledge),
+  platform_ (0), settings_ (settings), checkpoint_count_ (0)
 {
+  neighbors_.set_swarm_view (&swarm_view_);
   init_vars (settings_.agent_prefix);
 
   // setup the platform and algorithm global repositories
@@ -156,6 +159,8 @@ gams::controllers::BaseController::monitor (void)
         "gams::controllers::BaseController::analyze:" \
         " exception in platform_->sense (): %s\n", e.what());
     }
+
+    neighbors_.set_frame (platform_->get_location ().frame ());
   }
   else
   {
@@ -165,6 +170,13 @@ gams::controllers::BaseController::monitor (void)
       " Platform undefined. Unable to call platform_->sense ()\n");
   }
 
+  // unpack any packed telemetry received since the last monitor
+  telemetry_.receive (swarm_view_);
+
+  // agent locations may have changed, so rebuild on the next query
+  neighbors_.invalidate ();
+  swarm_view_.invalidate ();
+
   return result;
 }
 
@@ -586,6 +598,8 @@ gams::controllers::BaseController::run_once (void)
     "gams::controllers::BaseController::run:" \
     " sending updates\n");
 
+  publish_telemetry ();
+
   // send modified values through network
   knowledge_.send_modifieds ();
 
@@ -612,6 +626,28 @@ gams::controllers::BaseController::run (void)
     settings_.run_time, settings_.send_hertz);
 }
 
+void
+gams::controllers::BaseController::publish_telemetry (void)
+{
+  if (telemetry_.is_enabled ())
+  {
+    telemetry_.publish ();
+  }
+}
+
+void
+gams::controllers::BaseController::set_agent_prefixes (void)
+{
+  // binding every agent's containers costs O(swarm) references, so only
+  // agents that are used get bound, through swarm_view_
+  agents_.assign (swarm_view_.size (), variables::Agent ());
+
+  for (size_t i = 0; i < agents_.size (); ++i)
+  {
+    agents_[i].prefix = swarm_view_.get_prefix (i);
+  }
+}
+
 void
 gams::controllers::BaseController::save_checkpoint (void)
 {
@@ -706,6 +742,10 @@ gams::controllers::BaseController::run (double loop_period,
   madara::utility::TimeValue end_time = current +
     madara::utility::seconds_to_duration (max_runtime);
 
+  // barrier rounds completed as of this controller's last wait
+  uint64_t barrier_generation =
+    gams::utility::BarrierEvents::instance ().get_generation ();
+
   madara_logger_ptr_log (gams::loggers::global_logger.get (),
     gams::loggers::LOG_MAJOR,
     "gams::controllers::BaseController::run:" \
@@ -754,6 +794,8 @@ gams::controllers::BaseController::run (double loop_period,
           save_checkpoint ();
         }
 
+        publish_telemetry ();
+
         // send modified values through network
         knowledge_.send_modifieds ();
 
@@ -777,7 +819,16 @@ gams::controllers::BaseController::run (double loop_period,
           "gams::controllers::BaseController::run:" \
           " sleeping until next epoch\n");
 
-        std::this_thread::sleep_until (next_loop);
+        // a barrier completing a round ends the sleep early, so waiting
+        // agents proceed without waiting out the loop period
+        if (gams::utility::BarrierEvents::instance ().wait_until (
+          next_loop, barrier_generation))
+        {
+          madara_logger_ptr_log (gams::loggers::global_logger.get (),
+            gams::loggers::LOG_MINOR,
+            "gams::controllers::BaseController::run:" \
+            " woken early by a completed barrier round\n");
+        }
 
         current = madara::utility::Clock::now ();
         while (next_loop <= current)
@@ -888,6 +939,8 @@ const madara::knowledge::KnowledgeMap & args)
 
     if (new_accent)
     {
+      new_accent->set_neighbor_index (&neighbors_);
+      new_accent->set_swarm_view (&swarm_view_);
       accents_.push_back (new_accent);
     }
     else
@@ -1312,7 +1365,8 @@ gams::controllers::BaseController::init_vars (
       " %s self, %s group\n",
       self_prefix.c_str (), group->get_prefix ().c_str ());
 
-    variables::init_vars (agents_, knowledge_, *group);
+    swarm_view_.set_agents (knowledge_, group->get_member_list ());
+    set_agent_prefixes ();
   }
   else
   {
@@ -1327,6 +1381,9 @@ gams::controllers::BaseController::init_vars (
   self_.init_vars (knowledge_, self_prefix);
   swarm_.init_vars (knowledge_);
 
+  if (settings_.packed_telemetry)
+    telemetry_.init_vars (knowledge_, self_.agent);
+
   if (settings_.madara_log_level >= 0)
   {
     self_.agent.madara_debug_level = settings_.madara_log_level;
@@ -1350,10 +1407,22 @@ const Integer & processes)
     " %" PRId64 " id, %" PRId64 " processes\n", id, processes);
 
   // initialize the agents, swarm, and self variables
-  variables::init_vars (agents_, knowledge_, processes);
+  // a negative count means the swarm size in agent.size
+  Integer count = processes;
+  if (count < 0)
+  {
+    count = std::max (knowledge_.get ("agent.size").to_integer (),
+      (Integer)0);
+  }
+
+  swarm_view_.set_agents (knowledge_, (size_t)count);
+  set_agent_prefixes ();
   swarm_.init_vars (knowledge_, processes);
   self_.init_vars (knowledge_, id);
 
+  if (settings_.packed_telemetry)
+    telemetry_.init_vars (knowledge_, self_.agent);
+
   if (settings_.madara_log_level >= 0)
   {
     self_.agent.madara_debug_level = settings_.madara_log_level;
@@ -1397,6 +1466,8 @@ gams::controllers::BaseController::init_vars (
   algorithm.platform_ = platform_;
   algorithm.self_ = &self_;
   algorithm.sensors_ = &sensors_;
+  algorithm.neighbors_ = &neighbors_;
+  algorithm.swarm_view_ = &swarm_view_;
 }
 
 gams::algorithms::BaseAlgorithm *
@@ -61,6 +61,9 @@
 #include "gams/variables/Swarm.h"
 #include "gams/variables/Self.h"
 #include "gams/variables/Sensor.h"
+#include "gams/variables/NeighborIndex.h"
+#include "gams/variables/SwarmView.h"
+#include "gams/variables/Telemetry.h"
 #include "gams/variables/AlgorithmStatus.h"
 #include "gams/variables/PlatformStatus.h"
 #include "gams/algorithms/BaseAlgorithm.h"
@@ -347,6 +350,11 @@ namespace gams
        **/
       void save_checkpoint (void);
 
+      /**
+       * Packs this agent's telemetry for the next send, if enabled
+       **/
+      void publish_telemetry (void);
+
     protected:
 
       /// Accents on the primary algorithm
@@ -358,9 +366,18 @@ namespace gams
       /// Containers for algorithm information
       variables::Algorithms algorithms_;
       
-      /// Containers for agent-related variables
+      /// Agent prefixes. Containers are bound through swarm_view_
       variables::Agents agents_;
 
+      /// Spatial index over agents_, marked stale in each monitor
+      variables::NeighborIndex neighbors_;
+
+      /// Lazily bound view of the agents, marked stale in each monitor
+      variables::SwarmView swarm_view_;
+
+      /// Packed telemetry, if enabled in the settings
+      variables::Telemetry telemetry_;
+
       /// Knowledge base
       madara::knowledge::KnowledgeBase & knowledge_;
 
@@ -388,6 +405,12 @@ namespace gams
 
       /// Code shared between run and run_once
       int run_once_ (void);
+
+      /**
+       * Fills agents_ with the prefixes in swarm_view_, leaving their
+       * containers to be bound by the view when used
+       **/
+      void set_agent_prefixes (void);
     };
   }
 }
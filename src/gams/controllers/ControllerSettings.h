@@ -85,7 +85,8 @@ namespace gams
       ControllerSettings ()
         : agent_prefix ("agent.0"), checkpoint_prefix ("checkpoint"),
           checkpoint_strategy (CHECKPOINT_NONE), gams_log_level (-1), loop_hertz (2.0),
-          madara_log_level (-1), run_time (-1), send_hertz (1.0)
+          madara_log_level (-1), packed_telemetry (false), run_time (-1),
+          send_hertz (1.0)
       {
       }
 
@@ -113,6 +114,13 @@ namespace gams
       /// the MADARA logging level (negative means don't change)
       int madara_log_level;
 
+      /**
+      * if true, the agent's hot fields are sent as one packed record
+      * ({agent}.telemetry) instead of separate variables.
+      * @see variables::Telemetry
+      **/
+      bool packed_telemetry;
+
       /// maximum runtime (-1 means persistent, forever)
       double run_time;
 
@@ -45,12 +45,110 @@
 **/
 
 #include "ElectionBase.h"
+#include "gams/loggers/GlobalLogger.h"
 #include <sstream>
+#include <cstdlib>
+#include <cstring>
 
 // create shortcuts
 namespace  knowledge = madara::knowledge;
 typedef    knowledge::KnowledgeRecord  KnowledgeRecord;
 
+namespace
+{
+  /**
+   * Votes and voters (one per voter) for each candidate
+   **/
+  typedef std::map <std::string, std::pair <KnowledgeRecord::Integer,
+    KnowledgeRecord::Integer> > PartialCounts;
+
+  /**
+   * Encodes partial counts as lines of "votes voters candidate"
+   **/
+  std::string encode_partial (const PartialCounts & counts)
+  {
+    std::stringstream buffer;
+
+    for (PartialCounts::const_iterator i = counts.begin ();
+      i != counts.end (); ++i)
+    {
+      buffer << i->second.first << " " << i->second.second << " " <<
+        i->first << "\n";
+    }
+
+    return buffer.str ();
+  }
+
+  /**
+   * Adds encoded partial counts to counts
+   **/
+  void decode_partial (const std::string & partial, PartialCounts & counts)
+  {
+    const char * cur = partial.c_str ();
+
+    while (*cur)
+    {
+      char * end = 0;
+      KnowledgeRecord::Integer votes = strtoll (cur, &end, 10);
+      if (end == cur || *end != ' ')
+        return;
+
+      cur = end + 1;
+      KnowledgeRecord::Integer voters = strtoll (cur, &end, 10);
+      if (end == cur || *end != ' ')
+        return;
+
+      cur = end + 1;
+      const char * line_end = strchr (cur, '\n');
+      if (!line_end)
+        return;
+
+      std::pair <KnowledgeRecord::Integer, KnowledgeRecord::Integer> & entry =
+        counts[std::string (cur, line_end)];
+      entry.first += votes;
+      entry.second += voters;
+
+      cur = line_end + 1;
+    }
+  }
+
+  /**
+   * Sets a tally to the given counts
+   * @param  tally    the tally to change
+   * @param  counts   the counts to set
+   * @param  voters   if true, use the voter counts instead of the votes
+   **/
+  void set_tally (gams::elections::ElectionTally & tally,
+    const PartialCounts & counts, bool voters)
+  {
+    gams::elections::CandidateVotes current;
+    tally.get_votes (current);
+
+    // candidates no longer in the counts go to zero
+    for (gams::elections::CandidateVotes::const_iterator i =
+      current.begin (); i != current.end (); ++i)
+    {
+      if (i->second != 0 && counts.find (i->first) == counts.end ())
+      {
+        tally.add (i->first, -i->second);
+      }
+    }
+
+    for (PartialCounts::const_iterator i = counts.begin ();
+      i != counts.end (); ++i)
+    {
+      KnowledgeRecord::Integer target =
+        voters ? i->second.second : i->second.first;
+      KnowledgeRecord::Integer existing = tally.get (i->first);
+
+      if (target != existing)
+      {
+        tally.add (i->first, target - existing);
+      }
+    }
+  }
+}
+
 gams::elections::ElectionBase::ElectionBase (
   const std::string & election_prefix,
   const std::string & agent_prefix,
@@ -58,7 +156,12 @@ gams::elections::ElectionBase::ElectionBase (
   : knowledge_ (knowledge),
   election_prefix_ (election_prefix),
   agent_prefix_ (agent_prefix),
-  round_ (0)
+  round_ (0),
+  discovered_ (false),
+  tree_fanout_ (0),
+  tree_version_ (0),
+  tree_bound_ (false),
+  tree_index_ (-1)
 {
   reset_votes_pointer ();
 }
@@ -76,12 +179,14 @@ gams::elections::ElectionBase::has_voted (const std::string & agent_prefix)
   {
     knowledge::ContextGuard guard (*knowledge_);
 
-    // create a list of votes for quick reference
-    knowledge::VariableReferences votes;
-    knowledge_->get_matches (
-      votes_.get_name () + "." + agent_prefix + "->", "", votes);
+    result = choices_.find (agent_prefix) != choices_.end ();
 
-    result = votes.size () != 0;
+    // the ballot may have arrived since the round was searched
+    if (!result)
+    {
+      discover (agent_prefix + "->");
+      result = choices_.find (agent_prefix) != choices_.end ();
+    }
   }
 
   return result;
@@ -94,25 +199,10 @@ gams::elections::ElectionBase::get_votes (CandidateVotes & results)
 
   if (knowledge_ && election_prefix_ != "")
   {
-    // create a list of votes for quick reference
-    knowledge::VariableReferences votes;
-    knowledge_->get_matches (votes_.get_name (), "", votes);
-
-    // tally the votes
-    for (knowledge::VariableReferences::const_iterator i = votes.begin ();
-      i != votes.end (); ++i)
-    {
-      std::string ballot_string = i->get_name ();
-      std::string::size_type delimiter_pos = ballot_string.find ("->");
-
-      if (delimiter_pos != std::string::npos)
-      {
-        std::string candidate = ballot_string.substr (delimiter_pos + 2);
+    knowledge::ContextGuard guard (*knowledge_);
 
-        // add the votes to the results
-        results[candidate] += knowledge_->get (*i).to_integer ();
-      }
-    }
+    update_votes ();
+    tally_.get_votes (results);
   }
 }
 
@@ -124,31 +214,232 @@ gams::elections::ElectionBase::get_votes (
 
   if (knowledge_ && election_prefix_ != "")
   {
-    // create a list of votes for quick reference
-    knowledge::VariableReferences votes;
-    knowledge_->get_matches (votes_.get_name (), "", votes);
+    knowledge::ContextGuard guard (*knowledge_);
 
-    // tally the votes
-    for (knowledge::VariableReferences::const_iterator i = votes.begin ();
-      i != votes.end (); ++i)
+    update_votes ();
+
+    // tally the votes of the group members
+    for (size_t i = 0; i < ballots_.size (); ++i)
     {
-      std::string ballot_string = i->get_name ();
-      std::string::size_type delimiter_pos = ballot_string.find ("->");
+      if (group->is_member_id (ballots_[i].voter_id))
+      {
+        results[ballots_[i].candidate] += ballots_[i].votes;
+      }
+    }
+  }
+}
 
-      if (delimiter_pos != std::string::npos)
+bool
+gams::elections::ElectionBase::track (const std::string & ballot,
+  const knowledge::VariableReference & ref)
+{
+  std::string::size_type delimiter_pos = ballot.find ("->");
+
+  if (delimiter_pos == std::string::npos ||
+    ballot_index_.find (ballot) != ballot_index_.end ())
+  {
+    return false;
+  }
+
+  Ballot entry;
+  entry.voter = ballot.substr (0, delimiter_pos);
+  entry.voter_id = groups::get_agent_id (entry.voter);
+  entry.candidate = ballot.substr (delimiter_pos + 2);
+  entry.ref = ref;
+  entry.votes = 0;
+
+  // the votes themselves are counted by update_votes
+  tally_.add (entry.candidate, 0);
+
+  // a voter's first ballot in candidate order is its one vote
+  std::unordered_map<std::string, std::string>::iterator choice =
+    choices_.find (entry.voter);
+
+  if (choice == choices_.end ())
+  {
+    choices_[entry.voter] = entry.candidate;
+    choice_tally_.add (entry.candidate, 1);
+  }
+  else if (entry.candidate < choice->second)
+  {
+    choice_tally_.add (choice->second, -1);
+    choice_tally_.add (entry.candidate, 1);
+    choice->second = entry.candidate;
+  }
+
+  ballot_index_[ballot] = ballots_.size ();
+  ballots_.push_back (entry);
+
+  return true;
+}
+
+void
+gams::elections::ElectionBase::discover (const std::string & prefix)
+{
+  if (!knowledge_ || election_prefix_ == "")
+    return;
+
+  const std::string round_prefix = votes_.get_name () + ".";
+
+  knowledge::VariableReferences votes;
+  knowledge_->get_matches (round_prefix + prefix, "", votes);
+
+  for (knowledge::VariableReferences::const_iterator i = votes.begin ();
+    i != votes.end (); ++i)
+  {
+    track (std::string (i->get_name ()).substr (round_prefix.size ()), *i);
+  }
+
+  if (prefix == "")
+  {
+    discovered_ = true;
+  }
+}
+
+void
+gams::elections::ElectionBase::update_votes (void)
+{
+  // the round is searched once, and again on each sync, so polling
+  // does not scan the knowledge base
+  if (!discovered_)
+  {
+    discover ();
+  }
+
+  for (size_t i = 0; i < ballots_.size (); ++i)
+  {
+    Ballot & ballot = ballots_[i];
+    KnowledgeRecord::Integer votes = knowledge_->get (ballot.ref).to_integer ();
+
+    if (votes != ballot.votes)
+    {
+      tally_.add (ballot.candidate, votes - ballot.votes);
+      ballot.votes = votes;
+    }
+  }
+
+  if (tree_fanout_ > 0)
+  {
+    update_tree ();
+  }
+}
+
+void
+gams::elections::ElectionBase::set_tree (
+  const groups::GroupBase * group, size_t fanout)
+{
+  tree_fanout_ = group ? fanout : 0;
+
+  if (tree_fanout_ > 0)
+  {
+    tree_.set_fanout (fanout);
+  }
+  tree_.set_group (tree_fanout_ > 0 ? group : 0);
+
+  // in tree mode, only partial counts leave this agent
+  votes_.set_settings (knowledge::KnowledgeUpdateSettings (tree_fanout_ > 0));
+
+  // the tallies are rebuilt from the ballots or the tree
+  ballots_.clear ();
+  ballot_index_.clear ();
+  choices_.clear ();
+  tally_.clear ();
+  choice_tally_.clear ();
+  discovered_ = false;
+  tree_bound_ = false;
+}
+
+void
+gams::elections::ElectionBase::bind_tree (void)
+{
+  tree_.update ();
+
+  tree_version_ = tree_.get_version ();
+  tree_index_ = tree_.get_index (agent_prefix_);
+  tree_children_.clear ();
+  tree_published_.clear ();
+
+  const std::string prefix = get_tree_prefix () + ".";
+
+  if (tree_.size () > 0)
+  {
+    tree_root_ = knowledge_->get_ref (prefix + tree_.get_members ()[0]);
+  }
+
+  if (tree_index_ >= 0)
+  {
+    tree_partial_ = knowledge_->get_ref (prefix + agent_prefix_);
+
+    std::vector<size_t> children;
+    tree_.get_children ((size_t)tree_index_, children);
+
+    for (size_t i = 0; i < children.size (); ++i)
+    {
+      tree_children_.push_back (knowledge_->get_ref (
+        prefix + tree_.get_members ()[children[i]]));
+    }
+  }
+
+  tree_bound_ = true;
+}
+
+void
+gams::elections::ElectionBase::update_tree (void)
+{
+  if (!tree_bound_ || tree_.update () ||
+    tree_version_ != tree_.get_version ())
+  {
+    bind_tree ();
+  }
+
+  PartialCounts counts;
+
+  if (tree_index_ >= 0)
+  {
+    // this agent's own ballots, and its one vote
+    for (size_t i = 0; i < ballots_.size (); ++i)
+    {
+      if (ballots_[i].voter == agent_prefix_)
       {
-        std::string candidate = ballot_string.substr (delimiter_pos + 2);
-        std::string voter = ballot_string.substr (
-          votes_.get_name ().size () + 1, delimiter_pos);
-
-        if (group->is_member (voter))
-        {
-          // add the votes to the results
-          results[candidate] += knowledge_->get (*i).to_integer ();
-        }
+        counts[ballots_[i].candidate].first += ballots_[i].votes;
       }
     }
+
+    std::unordered_map<std::string, std::string>::const_iterator choice =
+      choices_.find (agent_prefix_);
+    if (choice != choices_.end ())
+    {
+      counts[choice->second].second += 1;
+    }
+
+    for (size_t i = 0; i < tree_children_.size (); ++i)
+    {
+      decode_partial (knowledge_->get (tree_children_[i]).to_string (),
+        counts);
+    }
+
+    std::string partial = encode_partial (counts);
+
+    if (partial != tree_published_)
+    {
+      knowledge_->set (tree_partial_, partial);
+      tree_published_ = partial;
+    }
+  }
+
+  // the root's counts cover the whole group
+  if (tree_index_ != 0)
+  {
+    counts.clear ();
+
+    if (tree_.size () > 0)
+    {
+      decode_partial (knowledge_->get (tree_root_).to_string (), counts);
+    }
   }
+
+  set_tally (tally_, counts, false);
+  set_tally (choice_tally_, counts, true);
 }
 
 void
@@ -171,17 +462,50 @@ void
 gams::elections::ElectionBase::sync (void)
 {
   votes_.sync_keys ();
+
+  if (knowledge_)
+  {
+    knowledge::ContextGuard guard (*knowledge_);
+
+    discover ();
+  }
 }
 
 void
 gams::elections::ElectionBase::vote (const std::string & agent,
 const std::string & candidate, int votes)
 {
+  // in tree mode, a member's partial counts only include its own ballots
+  if (tree_fanout_ > 0 && agent != agent_prefix_)
+  {
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_ERROR,
+      "gams::elections::ElectionBase::vote:" \
+      " %s cannot vote for %s in tree mode. Ignoring vote.\n",
+      agent_prefix_.c_str (), agent.c_str ());
+    return;
+  }
+
   std::stringstream buffer;
   buffer << agent;
   buffer << "->";
   buffer << candidate;
   votes_.set (buffer.str (), KnowledgeRecord::Integer (votes));
+
+  if (knowledge_ && election_prefix_ != "")
+  {
+    knowledge::ContextGuard guard (*knowledge_);
+
+    track (buffer.str (),
+      knowledge_->get_ref (votes_.get_name () + "." + buffer.str ()));
+
+    // publish the new partial counts with the next send, without waiting
+    // for this agent to poll
+    if (tree_fanout_ > 0)
+    {
+      update_votes ();
+    }
+  }
 }
 
 void gams::elections::ElectionBase::advance_round (void)
@@ -57,27 +57,31 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include "madara/knowledge/KnowledgeBase.h"
 #include "madara/knowledge/containers/Map.h"
 
 #include "ElectionTypesEnum.h"
+#include "ElectionTally.h"
 #include "gams/groups/GroupBase.h"
+#include "gams/groups/GroupTree.h"
 #include "gams/GamsExport.h"
 
 namespace gams
 {
   namespace elections
   {
-    /// list of candidates
-    typedef  std::vector<std::string> CandidateList;
-
-    /// candidate vote tally
-    typedef std::map <std::string,
-      madara::knowledge::KnowledgeRecord::Integer> CandidateVotes;
-
     /**
-    * Base class for an election
+    * Base class for an election. Ballots are parsed once, when first seen,
+    * and read through cached references after that. Running tallies are
+    * updated only for ballots whose votes changed. Ballots are found when
+    * they are cast through this election, when a round is first read,
+    * and on sync (). Call sync () to count voters that cast their first
+    * ballot elsewhere later in the round.
+    *
+    * With set_tree, vote counts are instead reduced up a
+    * groups::GroupTree over a group of voters. See set_tree.
     **/
     class GAMS_EXPORT ElectionBase
     {
@@ -138,10 +142,43 @@ namespace gams
         madara::knowledge::KnowledgeBase * knowledge);
 
       /**
-      * Syncs the election information from the knowledge base
+      * Syncs the election information from the knowledge base, including
+      * any new ballots cast by other agents
       **/
       virtual void sync (void);
 
+      /**
+      * Reduces vote counts up a tree over a group of voters, instead of
+      * every agent reading every ballot. Ballots are kept local, and each
+      * member publishes only the vote counts of its subtree to
+      * {election}.tree.{round}.{member}. A member reads its children and
+      * the root, which holds the counts of the whole group. vote
+      * publishes the voter's partial counts, but interior members only
+      * forward their children's counts when they poll, so every member
+      * must keep calling get_leaders (or get_votes) for counts to reach
+      * the root. Counts move up one level per poll and send.
+      *
+      * Only group members are counted, and each member counts only its
+      * own ballots, so voting for another agent is rejected. has_voted
+      * and get_votes for a group only see ballots cast through this
+      * agent.
+      * @param  group    the voters, which must outlive the election
+      * @param  fanout   children per member, or 0 to read every ballot
+      **/
+      virtual void set_tree (const groups::GroupBase * group, size_t fanout);
+
+      /**
+      * Gets the fanout of the aggregation tree
+      * @return  children per member, or 0 if every ballot is read
+      **/
+      size_t get_tree_fanout (void) const;
+
+      /**
+      * Returns the prefix of the partial results in this round
+      * @return  the tree prefix (e.g., election.leader.tree.0)
+      **/
+      std::string get_tree_prefix (void) const;
+
       /**
       * Gets the prefix for the current agent
       * @return  the name of this bidding agent (e.g. agent.0)
@@ -163,7 +200,8 @@ namespace gams
       void vote (const std::string & candidate, int votes = 1);
 
       /**
-      * Bids in the election
+      * Bids in the election. In tree mode, only votes by this agent are
+      * accepted (@see set_tree).
       * @param  agent  the agent prefix who is bidding
       * @param  candidate   the candidate receiving votes
       * @param  votes       the number of votes cast
@@ -205,6 +243,63 @@ namespace gams
       **/
       void reset_votes_pointer (void);
 
+      /**
+      * A ballot whose votes are read through a cached reference
+      **/
+      struct Ballot
+      {
+        /// the voter (e.g., agent.0)
+        std::string voter;
+
+        /// the interned id of the voter
+        groups::AgentId voter_id;
+
+        /// the candidate receiving votes
+        std::string candidate;
+
+        /// the ballot in the knowledge base
+        madara::knowledge::VariableReference ref;
+
+        /// the votes last read from the ballot
+        madara::knowledge::KnowledgeRecord::Integer votes;
+      };
+
+      /**
+      * Starts tracking a ballot, if it is not already tracked
+      * @param  ballot   the ballot name within the round (voter->candidate)
+      * @param  ref      the ballot in the knowledge base
+      * @return  true if the ballot was new
+      **/
+      bool track (const std::string & ballot,
+        const madara::knowledge::VariableReference & ref);
+
+      /**
+      * Searches the knowledge base for ballots in the current round. All
+      * ballots are searched on the first read of a round and on each
+      * sync.
+      * @param  prefix   only ballots starting with this prefix (e.g.,
+      *                  agent.0->), or all ballots if empty
+      **/
+      void discover (const std::string & prefix = "");
+
+      /**
+      * Reads every tracked ballot and updates the tallies for the ballots
+      * that changed. O(B) reads, plus O(log C) per changed ballot.
+      **/
+      void update_votes (void);
+
+      /**
+      * Reduces this agent's ballots and its children's partial counts,
+      * publishes the counts of its subtree, and sets the tallies to the
+      * root's counts. O(fanout * C) for C candidates.
+      **/
+      void update_tree (void);
+
+      /**
+      * Binds the tree references for the current round and members
+      **/
+      void bind_tree (void);
+
       /**
       * The knowledge base to use as a data plane
       **/
@@ -229,6 +324,82 @@ namespace gams
       * convenience class for bids
       **/
       madara::knowledge::containers::Map votes_;
+
+      /**
+      * the ballots being tracked in this round
+      **/
+      std::vector<Ballot> ballots_;
+
+      /**
+      * index of each ballot (voter->candidate) in ballots_
+      **/
+      std::unordered_map<std::string, size_t> ballot_index_;
+
+      /**
+      * the candidate counted for each voter in a one vote per voter
+      * tally, which is the voter's first ballot in candidate order
+      **/
+      std::unordered_map<std::string, std::string> choices_;
+
+      /**
+      * the sum of votes cast for each candidate
+      **/
+      ElectionTally tally_;
+
+      /**
+      * one vote per voter for the candidate in choices_
+      **/
+      ElectionTally choice_tally_;
+
+      /**
+      * true once this round has been searched for ballots
+      **/
+      bool discovered_;
+
+      /**
+      * children per member in tree mode, or 0 to read every ballot
+      **/
+      size_t tree_fanout_;
+
+      /**
+      * the tree over the voters
+      **/
+      groups::GroupTree tree_;
+
+      /**
+      * the tree version the references were bound for
+      **/
+      uint64_t tree_version_;
+
+      /**
+      * true if the tree references are bound for this round
+      **/
+      bool tree_bound_;
+
+      /**
+      * this agent's position in the tree, or -1 if not a member
+      **/
+      int tree_index_;
+
+      /**
+      * this agent's partial counts
+      **/
+      madara::knowledge::VariableReference tree_partial_;
+
+      /**
+      * the partial counts of this agent's children
+      **/
+      std::vector<madara::knowledge::VariableReference> tree_children_;
+
+      /**
+      * the partial counts of the root
+      **/
+      madara::knowledge::VariableReference tree_root_;
+
+      /**
+      * the partial counts last published by this agent
+      **/
+      std::string tree_published_;
     };
   }
 }
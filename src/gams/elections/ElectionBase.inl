@@ -85,6 +85,31 @@ gams::elections::ElectionBase::reset_votes_pointer (void)
     buffer << round_;
     votes_.set_name (buffer.str (), *knowledge_);
   }
+
+  ballots_.clear ();
+  ballot_index_.clear ();
+  choices_.clear ();
+  tally_.clear ();
+  choice_tally_.clear ();
+  discovered_ = false;
+  tree_bound_ = false;
+}
+
+inline size_t
+gams::elections::ElectionBase::get_tree_fanout (void) const
+{
+  return tree_fanout_;
+}
+
+inline std::string
+gams::elections::ElectionBase::get_tree_prefix (void) const
+{
+  std::stringstream buffer;
+  buffer << election_prefix_;
+  buffer << ".tree.";
+  buffer << round_;
+
+  return buffer.str ();
 }
 
 inline void
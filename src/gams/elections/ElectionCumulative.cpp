@@ -107,27 +107,8 @@ gams::elections::ElectionCumulative::get_leaders (int num_leaders)
   {
     knowledge::ContextGuard guard (*knowledge_);
 
-    typedef std::map <KnowledgeRecord::Integer, CandidateList> Leaderboard;
-
-    CandidateVotes candidates;
-    Leaderboard leaderboard;
-
-    get_votes (candidates);
-
-    // construct the leaderboard
-    for (CandidateVotes::iterator i = candidates.begin ();
-      i != candidates.end (); ++i)
-    {
-      leaderboard[i->second].push_back (i->first);
-    }
-
-    // leaderboard is in ascending order, so grab from the back
-    for (Leaderboard::reverse_iterator i = leaderboard.rbegin ();
-      i != leaderboard.rend () && (int) leaders.size () < num_leaders; ++i)
-    {
-      // if it is a tie, we could provide more than num_leaders
-      leaders.insert (leaders.end (), i->second.begin (), i->second.end ());
-    }
+    update_votes ();
+    leaders = tally_.get_leaders (num_leaders);
   }
 
   return leaders;
@@ -0,0 +1,125 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file ElectionTally.cpp
+*
+* This file contains the implementation of a running tally of election votes
+**/
+
+#include "ElectionTally.h"
+
+void
+gams::elections::ElectionTally::clear (void)
+{
+  votes_.clear ();
+  leaderboard_.clear ();
+}
+
+size_t
+gams::elections::ElectionTally::size (void) const
+{
+  return votes_.size ();
+}
+
+void
+gams::elections::ElectionTally::add (
+  const std::string & candidate, Integer votes)
+{
+  std::unordered_map <std::string, Integer>::iterator found =
+    votes_.find (candidate);
+
+  if (found == votes_.end ())
+  {
+    votes_[candidate] = votes;
+    leaderboard_.insert (Entry (votes, candidate));
+  }
+  else if (votes != 0)
+  {
+    leaderboard_.erase (Entry (found->second, candidate));
+    found->second += votes;
+    leaderboard_.insert (Entry (found->second, candidate));
+  }
+}
+
+gams::elections::ElectionTally::Integer
+gams::elections::ElectionTally::get (const std::string & candidate) const
+{
+  std::unordered_map <std::string, Integer>::const_iterator found =
+    votes_.find (candidate);
+
+  return found != votes_.end () ? found->second : 0;
+}
+
+void
+gams::elections::ElectionTally::get_votes (CandidateVotes & results) const
+{
+  results.clear ();
+  results.insert (votes_.begin (), votes_.end ());
+}
+
+gams::elections::CandidateList
+gams::elections::ElectionTally::get_leaders (int num_leaders) const
+{
+  CandidateList leaders;
+  Integer last_votes = 0;
+
+  for (std::set <Entry, MostVotes>::const_iterator i = leaderboard_.begin ();
+    i != leaderboard_.end (); ++i)
+  {
+    // past num_leaders, only candidates tied with the last leader remain
+    if ((int) leaders.size () >= num_leaders &&
+      (leaders.empty () || i->first != last_votes))
+    {
+      break;
+    }
+
+    leaders.push_back (i->second);
+    last_votes = i->first;
+  }
+
+  return leaders;
+}
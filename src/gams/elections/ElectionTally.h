@@ -0,0 +1,157 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file ElectionTally.h
+*
+* This file contains the definition of a running tally of election votes
+**/
+
+#ifndef   _GAMS_ELECTIONS_ELECTION_TALLY_H_
+#define   _GAMS_ELECTIONS_ELECTION_TALLY_H_
+
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include "madara/knowledge/KnowledgeRecord.h"
+
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace elections
+  {
+    /// list of candidates
+    typedef  std::vector<std::string> CandidateList;
+
+    /// candidate vote tally
+    typedef std::map <std::string,
+      madara::knowledge::KnowledgeRecord::Integer> CandidateVotes;
+
+    /**
+    * A running tally of votes per candidate, kept in leaderboard order
+    * so that the top k candidates can be read without sorting
+    **/
+    class GAMS_EXPORT ElectionTally
+    {
+    public:
+      /// the type of a vote count
+      typedef madara::knowledge::KnowledgeRecord::Integer Integer;
+
+      /**
+      * Removes all candidates from the tally
+      **/
+      void clear (void);
+
+      /**
+      * Returns the number of candidates in the tally
+      * @return  the number of candidates
+      **/
+      size_t size (void) const;
+
+      /**
+      * Adds votes to a candidate. Candidates are added on first use and
+      * stay in the tally, even with no votes. O(log C).
+      * @param  candidate   the candidate receiving votes
+      * @param  votes       the votes to add, which may be negative
+      **/
+      void add (const std::string & candidate, Integer votes);
+
+      /**
+      * Returns the votes for a candidate
+      * @param  candidate   the candidate of interest
+      * @return  the votes for the candidate, or 0 if not in the tally
+      **/
+      Integer get (const std::string & candidate) const;
+
+      /**
+      * Copies the tally
+      * @param  results  the votes for each candidate
+      **/
+      void get_votes (CandidateVotes & results) const;
+
+      /**
+      * Returns the leaders in order of votes, with ties in candidate order.
+      * Candidates tied with the last leader are also returned, so there
+      * may be more than num_leaders. O(k) for k returned leaders.
+      * @param  num_leaders maximum leaders to return
+      * @return the leaders of the tally
+      **/
+      CandidateList get_leaders (int num_leaders = 1) const;
+
+    private:
+      /// a leaderboard entry of votes and candidate
+      typedef std::pair <Integer, std::string> Entry;
+
+      /**
+      * Orders entries by most votes, then by candidate
+      **/
+      struct MostVotes
+      {
+        bool operator() (const Entry & lhs, const Entry & rhs) const
+        {
+          return lhs.first != rhs.first ?
+            lhs.first > rhs.first : lhs.second < rhs.second;
+        }
+      };
+
+      /**
+      * votes for each candidate
+      **/
+      std::unordered_map <std::string, Integer> votes_;
+
+      /**
+      * candidates in leaderboard order
+      **/
+      std::set <Entry, MostVotes> leaderboard_;
+    };
+  }
+}
+
+#endif // _GAMS_ELECTIONS_ELECTION_TALLY_H_
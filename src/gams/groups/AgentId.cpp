@@ -0,0 +1,161 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file AgentId.cpp
+*
+* This file contains the implementation of interned integer agent ids
+**/
+
+#include "AgentId.h"
+
+namespace
+{
+  /// returned for unknown ids
+  const std::string NO_PREFIX;
+}
+
+gams::groups::AgentId
+gams::groups::AgentIdTable::intern (const std::string & prefix)
+{
+  std::lock_guard <std::mutex> guard (mutex_);
+
+  std::unordered_map <std::string, AgentId>::const_iterator found =
+    ids_.find (prefix);
+
+  if (found != ids_.end ())
+  {
+    return found->second;
+  }
+
+  AgentId id = (AgentId)prefixes_.size ();
+  prefixes_.push_back (prefix);
+  ids_[prefix] = id;
+
+  return id;
+}
+
+bool
+gams::groups::AgentIdTable::find (
+  const std::string & prefix, AgentId & id) const
+{
+  std::lock_guard <std::mutex> guard (mutex_);
+
+  std::unordered_map <std::string, AgentId>::const_iterator found =
+    ids_.find (prefix);
+
+  if (found != ids_.end ())
+  {
+    id = found->second;
+    return true;
+  }
+
+  return false;
+}
+
+const std::string &
+gams::groups::AgentIdTable::get_prefix (AgentId id) const
+{
+  std::lock_guard <std::mutex> guard (mutex_);
+
+  return id < prefixes_.size () ? prefixes_[id] : NO_PREFIX;
+}
+
+size_t
+gams::groups::AgentIdTable::size (void) const
+{
+  std::lock_guard <std::mutex> guard (mutex_);
+
+  return prefixes_.size ();
+}
+
+gams::groups::AgentIdTable &
+gams::groups::AgentIdTable::instance (void)
+{
+  // constructed on first use, so ids can be interned during static init
+  static AgentIdTable table;
+  return table;
+}
+
+gams::groups::AgentId
+gams::groups::get_agent_id (const std::string & prefix)
+{
+  return AgentIdTable::instance ().intern (prefix);
+}
+
+const std::string &
+gams::groups::get_agent_prefix (AgentId id)
+{
+  return AgentIdTable::instance ().get_prefix (id);
+}
+
+void
+gams::groups::get_agent_ids (
+  const std::vector <std::string> & prefixes, AgentIdVector & ids)
+{
+  AgentIdTable & table = AgentIdTable::instance ();
+
+  ids.resize (prefixes.size ());
+
+  for (size_t i = 0; i < prefixes.size (); ++i)
+  {
+    ids[i] = table.intern (prefixes[i]);
+  }
+}
+
+int
+gams::groups::find_member_index (AgentId id, const AgentIdVector & members)
+{
+  for (size_t i = 0; i < members.size (); ++i)
+  {
+    if (members[i] == id)
+    {
+      return (int)i;
+    }
+  }
+
+  return -1;
+}
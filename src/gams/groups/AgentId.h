@@ -0,0 +1,165 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file AgentId.h
+*
+* This file contains the definition of interned integer agent ids
+**/
+
+#ifndef   _GAMS_GROUPS_AGENT_ID_H_
+#define   _GAMS_GROUPS_AGENT_ID_H_
+
+#include <vector>
+#include <string>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace groups
+  {
+    /// A dense integer id for an agent prefix
+    typedef uint32_t AgentId;
+
+    /// A vector of agent ids
+    typedef std::vector <AgentId> AgentIdVector;
+
+    /**
+    * Interns agent prefixes (e.g., agent.17) as dense integers, starting
+    * at 0, so that membership and index checks can be done without
+    * string compares. Ids are never reused and prefixes are never
+    * released. All methods are thread-safe.
+    **/
+    class GAMS_EXPORT AgentIdTable
+    {
+    public:
+      /**
+      * Returns the id for a prefix, adding the prefix if it is new
+      * @param  prefix  the agent prefix (e.g., agent.0)
+      * @return  the id of the prefix
+      **/
+      AgentId intern (const std::string & prefix);
+
+      /**
+      * Looks up the id for a prefix without adding it
+      * @param  prefix  the agent prefix (e.g., agent.0)
+      * @param  id      the id of the prefix, if found
+      * @return  true if the prefix has an id
+      **/
+      bool find (const std::string & prefix, AgentId & id) const;
+
+      /**
+      * Returns the prefix of an id. The reference stays valid for the
+      * life of the table.
+      * @param  id      an id returned by intern
+      * @return  the agent prefix, or an empty string if id is unknown
+      **/
+      const std::string & get_prefix (AgentId id) const;
+
+      /**
+      * Returns the number of interned prefixes, which is also one past
+      * the largest id
+      * @return  the number of ids
+      **/
+      size_t size (void) const;
+
+      /**
+      * Returns the process-wide table
+      * @return  the table shared by all groups, auctions and elections
+      **/
+      static AgentIdTable & instance (void);
+
+    private:
+      /// protects the table
+      mutable std::mutex mutex_;
+
+      /// the id of each prefix
+      std::unordered_map <std::string, AgentId> ids_;
+
+      /// the prefix of each id. A deque keeps references stable.
+      std::deque <std::string> prefixes_;
+    };
+
+    /**
+     * Interns an agent prefix in the process-wide table
+     * @param  prefix  the agent prefix (e.g., agent.0)
+     * @return  the id of the prefix
+     **/
+    GAMS_EXPORT AgentId get_agent_id (const std::string & prefix);
+
+    /**
+     * Returns the prefix of an agent id in the process-wide table
+     * @param  id      the agent id
+     * @return  the agent prefix (e.g., agent.0)
+     **/
+    GAMS_EXPORT const std::string & get_agent_prefix (AgentId id);
+
+    /**
+     * Interns a list of agent prefixes in the process-wide table
+     * @param  prefixes  the agent prefixes (e.g., agent.0, agent.1)
+     * @param  ids       the ids of the prefixes, in the same order
+     **/
+    GAMS_EXPORT void get_agent_ids (
+      const std::vector <std::string> & prefixes, AgentIdVector & ids);
+
+    /**
+     * Finds the index of an agent id in a member listing
+     * @param id       the id of the agent
+     * @param members  the listing of all members in the group
+     * @return 0+ is the index of the id in the list. If member does
+     *            not exist in the member listing, then -1 is returned.
+     **/
+    GAMS_EXPORT int find_member_index (AgentId id,
+      const AgentIdVector & members);
+  }
+}
+
+#endif // _GAMS_GROUPS_AGENT_ID_H_
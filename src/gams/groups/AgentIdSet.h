@@ -0,0 +1,126 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file AgentIdSet.h
+*
+* This file contains the definition of a bitset of agent ids
+**/
+
+#ifndef   _GAMS_GROUPS_AGENT_ID_SET_H_
+#define   _GAMS_GROUPS_AGENT_ID_SET_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "gams/GamsExport.h"
+#include "AgentId.h"
+
+namespace gams
+{
+  namespace groups
+  {
+    /**
+    * A set of agent ids stored as a bitset. Insert, erase and contains
+    * are O(1). Memory is one bit per id up to the largest id inserted.
+    **/
+    class GAMS_EXPORT AgentIdSet
+    {
+    public:
+      /**
+      * Constructor
+      **/
+      AgentIdSet ();
+
+      /**
+      * Adds an id to the set
+      * @param  id   the agent id
+      * @return  true if the id was not already in the set
+      **/
+      bool insert (AgentId id);
+
+      /**
+      * Removes an id from the set
+      * @param  id   the agent id
+      * @return  true if the id was in the set
+      **/
+      bool erase (AgentId id);
+
+      /**
+      * Checks if an id is in the set
+      * @param  id   the agent id
+      * @return  true if the id is in the set
+      **/
+      bool contains (AgentId id) const;
+
+      /**
+      * Removes all ids from the set
+      **/
+      void clear (void);
+
+      /**
+      * Returns the number of ids in the set
+      * @return  the number of ids
+      **/
+      size_t size (void) const;
+
+      /**
+      * Checks if the set is empty
+      * @return  true if there are no ids in the set
+      **/
+      bool empty (void) const;
+
+    private:
+      /// the bits, 64 ids per word
+      std::vector <uint64_t> words_;
+
+      /// the number of ids in the set
+      size_t size_;
+    };
+  }
+}
+
+#endif // _GAMS_GROUPS_AGENT_ID_SET_H_
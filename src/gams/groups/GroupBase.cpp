@@ -48,7 +48,8 @@
 
 gams::groups::GroupBase::GroupBase (const std::string & prefix,
   madara::knowledge::KnowledgeBase * knowledge)
-  : knowledge_ (knowledge), prefix_ (prefix)
+  : knowledge_ (knowledge), prefix_ (prefix),
+  version_ (1), member_list_version_ (0), member_ids_version_ (0)
 {
 }
 
@@ -56,6 +57,93 @@ gams::groups::GroupBase::~GroupBase ()
 {
 }
 
+const gams::groups::AgentVector &
+gams::groups::GroupBase::get_member_list (void) const
+{
+  if (member_list_version_ != version_)
+  {
+    get_members (member_list_);
+    member_list_version_ = version_;
+  }
+
+  return member_list_;
+}
+
+void
+gams::groups::GroupBase::update_member_ids (void) const
+{
+  if (member_ids_version_ != version_)
+  {
+    const AgentVector & members = get_member_list ();
+
+    // clear the indices of the old members
+    for (size_t i = 0; i < member_ids_.size (); ++i)
+    {
+      member_indices_[member_ids_[i]] = -1;
+    }
+
+    get_agent_ids (members, member_ids_);
+    member_id_set_.clear ();
+
+    for (size_t i = 0; i < member_ids_.size (); ++i)
+    {
+      const AgentId id = member_ids_[i];
+
+      member_id_set_.insert (id);
+
+      if (id >= member_indices_.size ())
+      {
+        member_indices_.resize (id + 1, -1);
+      }
+
+      // the first listing of a member is its index
+      if (member_indices_[id] < 0)
+      {
+        member_indices_[id] = (int)i;
+      }
+    }
+
+    member_ids_version_ = version_;
+  }
+}
+
+const gams::groups::AgentIdVector &
+gams::groups::GroupBase::get_member_ids (void) const
+{
+  update_member_ids ();
+  return member_ids_;
+}
+
+bool
+gams::groups::GroupBase::is_member_id (AgentId id) const
+{
+  update_member_ids ();
+  return member_id_set_.contains (id);
+}
+
+int
+gams::groups::GroupBase::get_member_index (AgentId id) const
+{
+  update_member_ids ();
+  return id < member_indices_.size () ? member_indices_[id] : -1;
+}
+
+int
+gams::groups::GroupBase::get_member_index (const std::string & id) const
+{
+  AgentId agent_id;
+
+  // members are interned here, so unknown prefixes cannot be members
+  update_member_ids ();
+
+  if (AgentIdTable::instance ().find (id, agent_id))
+  {
+    return get_member_index (agent_id);
+  }
+
+  return -1;
+}
+
 void
 gams::groups::GroupBase::set_prefix (const std::string & prefix,
 madara::knowledge::KnowledgeBase * knowledge)
@@ -57,11 +57,14 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <cstdint>
 
 #include "madara/knowledge/KnowledgeBase.h"
 
 #include "gams/GamsExport.h"
 #include "GroupTypesEnum.h"
+#include "AgentId.h"
+#include "AgentIdSet.h"
 
 namespace gams
 {
@@ -120,6 +123,52 @@ namespace gams
       **/
       virtual void get_members (AgentVector & members) const = 0;
 
+      /**
+      * Returns the members of the group without copying them. The list is
+      * only rebuilt when the membership version changes, so the same list
+      * can be read every loop for free until members are added or removed.
+      * @return  the members currently in the group
+      **/
+      const AgentVector & get_member_list (void) const;
+
+      /**
+      * Returns the membership version, which starts at 1 and increases
+      * whenever members are added or removed. Comparing versions is a
+      * cheap way to check whether a group changed after a sync.
+      * @return  the membership version
+      **/
+      uint64_t get_version (void) const;
+
+      /**
+      * Returns the interned ids of the members, in get_member_list order.
+      * Rebuilt only when the membership version changes.
+      * @return  the ids of the members currently in the group
+      **/
+      const AgentIdVector & get_member_ids (void) const;
+
+      /**
+      * Checks membership by interned id. O(1) while the membership
+      * version is unchanged.
+      * @param  id     the agent id (@see get_agent_id)
+      * @return  true if the agent is a member of the group
+      **/
+      bool is_member_id (AgentId id) const;
+
+      /**
+      * Returns the index of a member in get_member_list. O(1) while the
+      * membership version is unchanged.
+      * @param  id     the agent id (@see get_agent_id)
+      * @return  0+ is the index of the member, -1 if not a member
+      **/
+      int get_member_index (AgentId id) const;
+
+      /**
+      * Returns the index of a member in get_member_list
+      * @param  id     the agent prefix (e.g. agent.0)
+      * @return  0+ is the index of the member, -1 if not a member
+      **/
+      int get_member_index (const std::string & id) const;
+
       /**
       * Checks if the agent is a  member of the formation
       * @param  id     the agent id (e.g. agent.0 or agent.leader). If null,
@@ -175,6 +224,48 @@ namespace gams
        * the prefix for the group
        **/
       std::string prefix_;
+
+      /**
+       * the membership version. Increment when members are added or removed
+       **/
+      uint64_t version_;
+
+    private:
+
+      /**
+       * rebuilds the member ids, set and indices if the version changed
+       **/
+      void update_member_ids (void) const;
+
+      /**
+       * cached member list for get_member_list
+       **/
+      mutable AgentVector member_list_;
+
+      /**
+       * the membership version of member_list_
+       **/
+      mutable uint64_t member_list_version_;
+
+      /**
+       * cached member ids for get_member_ids
+       **/
+      mutable AgentIdVector member_ids_;
+
+      /**
+       * the member ids as a set
+       **/
+      mutable AgentIdSet member_id_set_;
+
+      /**
+       * the index of each member, by id, or -1 for non-members
+       **/
+      mutable std::vector <int> member_indices_;
+
+      /**
+       * the membership version of the member ids
+       **/
+      mutable uint64_t member_ids_version_;
     };
   }
 }
@@ -56,6 +56,12 @@ gams::groups::GroupBase::get_prefix (void) const
   return prefix_;
 }
 
+inline uint64_t
+gams::groups::GroupBase::get_version (void) const
+{
+  return version_;
+}
+
 
 inline int gams::groups::find_member_index (
   const std::string & prefix, const AgentVector & members)
@@ -98,6 +98,11 @@ gams::groups::GroupFixedList::add_members (const AgentVector & members)
     "gams::groups::GroupFixedList:add_members" \
     " adding %d members\n", (int)members.size ());
 
+  if (!members.empty ())
+  {
+    ++version_;
+  }
+
   // add the members to the fast list
   fast_members_.insert (
     fast_members_.end (), members.begin (), members.end ());
@@ -127,6 +132,11 @@ gams::groups::GroupFixedList::clear_members (void)
     "gams::groups::GroupFixedList:clear_members" \
     " clearing all %d members\n", (int)fast_members_.size ());
 
+  if (!fast_members_.empty ())
+  {
+    ++version_;
+  }
+
   fast_members_.clear ();
   members_.resize (0);
 }
@@ -191,8 +201,10 @@ gams::groups::GroupFixedList::sync (void)
   size_t old_size = fast_members_.size ();
   size_t new_size = members_.size ();
 
+  bool changed = old_size != new_size;
+
   // if new size is not the same, resize fast_members
-  if (old_size != new_size)
+  if (changed)
   {
     fast_members_.resize (new_size);
   }
@@ -208,8 +220,14 @@ gams::groups::GroupFixedList::sync (void)
     if (fast_members_[i] != members_[i])
     {
       fast_members_[i] = members_[i];
+      changed = true;
     }
   }
+
+  if (changed)
+  {
+    ++version_;
+  }
 }
 
 void
@@ -105,6 +105,7 @@ gams::groups::GroupTransient::add_members (const AgentVector & members)
     (knowledge::KnowledgeRecord::Integer)time (NULL);
 
   bool update_knowledge = knowledge_ && prefix_ != "";
+  bool changed = false;
 
   // add the members to the underlying knowledge base
   for (size_t i = 0; i < members.size (); ++i)
@@ -116,7 +117,17 @@ gams::groups::GroupTransient::add_members (const AgentVector & members)
       "gams::groups::GroupTransient:add_members" \
       " adding member %s to fast map\n", id.c_str ());
 
-    fast_members_[id] = cur_time;
+    std::pair <AgentMap::iterator, bool> added =
+      fast_members_.insert (AgentMap::value_type (id, cur_time));
+
+    if (added.second)
+    {
+      changed = true;
+    }
+    else
+    {
+      added.first->second = cur_time;
+    }
 
     if (update_knowledge)
     {
@@ -128,6 +139,11 @@ gams::groups::GroupTransient::add_members (const AgentVector & members)
       members_.set (id, cur_time);
     }
   }
+
+  if (changed)
+  {
+    ++version_;
+  }
 }
 
 void
@@ -138,6 +154,11 @@ gams::groups::GroupTransient::clear_members (void)
     "gams::groups::GroupTransient:clear_members" \
     " clearing all %d members\n", (int)fast_members_.size ());
 
+  if (!fast_members_.empty ())
+  {
+    ++version_;
+  }
+
   fast_members_.clear ();
   members_.clear ();
 }
@@ -201,19 +222,61 @@ gams::groups::GroupTransient::sync (void)
 
   if (knowledge_ && prefix_ != "")
   {
-    // sync with map is always expensive. Sync and clear
+    // sync with map is always expensive, so only apply the differences
     members_.sync_keys ();
-    fast_members_.clear ();
 
     // get the new list of keys
     std::vector <std::string> keys;
     members_.keys (keys);
-    
-    // add the keys with values to the AgentMap fast_members_
+
+    if (!std::is_sorted (keys.begin (), keys.end ()))
+    {
+      std::sort (keys.begin (), keys.end ());
+    }
+
+    bool changed = false;
+    AgentMap::iterator member = fast_members_.begin ();
+
+    // walk the sorted keys and members together
     for (size_t i = 0; i < keys.size (); ++i)
     {
-      const std::string key = keys[i];
-      fast_members_[key] = members_[key].to_integer ();
+      const std::string & key = keys[i];
+
+      // members before this key have been removed
+      while (member != fast_members_.end () && member->first < key)
+      {
+        fast_members_.erase (member++);
+        changed = true;
+      }
+
+      if (member != fast_members_.end () && member->first == key)
+      {
+        member->second = members_[key].to_integer ();
+        ++member;
+      }
+      else
+      {
+        fast_members_.insert (member,
+          AgentMap::value_type (key, members_[key].to_integer ()));
+        changed = true;
+      }
+    }
+
+    // members after the last key have been removed
+    while (member != fast_members_.end ())
+    {
+      fast_members_.erase (member++);
+      changed = true;
+    }
+
+    if (changed)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_MINOR,
+        "gams::groups::GroupTransient:sync" \
+        " membership changed to %d members\n", (int)fast_members_.size ());
+
+      ++version_;
     }
   }
 }
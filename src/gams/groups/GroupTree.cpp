@@ -0,0 +1,211 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file GroupTree.cpp
+*
+* This file contains the implementation of an aggregation tree over a group
+**/
+
+#include "GroupTree.h"
+
+#include <algorithm>
+
+gams::groups::GroupTree::GroupTree (size_t fanout)
+  : fanout_ (fanout > 0 ? fanout : 1), group_ (0), group_version_ (0),
+    version_ (0)
+{
+}
+
+void
+gams::groups::GroupTree::set_fanout (size_t fanout)
+{
+  fanout = fanout > 0 ? fanout : 1;
+
+  if (fanout != fanout_)
+  {
+    fanout_ = fanout;
+    ++version_;
+  }
+}
+
+size_t
+gams::groups::GroupTree::get_fanout (void) const
+{
+  return fanout_;
+}
+
+void
+gams::groups::GroupTree::set_group (const GroupBase * group)
+{
+  group_ = group;
+
+  if (group_)
+  {
+    group_version_ = group_->get_version ();
+    set_members (group_->get_member_list ());
+  }
+}
+
+void
+gams::groups::GroupTree::set_members (const AgentVector & members)
+{
+  members_ = members;
+  std::sort (members_.begin (), members_.end ());
+  members_.erase (std::unique (members_.begin (), members_.end ()),
+    members_.end ());
+
+  ++version_;
+}
+
+bool
+gams::groups::GroupTree::update (void)
+{
+  if (group_ && group_->get_version () != group_version_)
+  {
+    set_group (group_);
+    return true;
+  }
+
+  return false;
+}
+
+uint64_t
+gams::groups::GroupTree::get_version (void) const
+{
+  return version_;
+}
+
+size_t
+gams::groups::GroupTree::size (void) const
+{
+  return members_.size ();
+}
+
+const gams::groups::AgentVector &
+gams::groups::GroupTree::get_members (void) const
+{
+  return members_;
+}
+
+int
+gams::groups::GroupTree::get_index (const std::string & member) const
+{
+  AgentVector::const_iterator found = std::lower_bound (
+    members_.begin (), members_.end (), member);
+
+  if (found != members_.end () && *found == member)
+  {
+    return (int)(found - members_.begin ());
+  }
+
+  return -1;
+}
+
+int
+gams::groups::GroupTree::get_parent (size_t index) const
+{
+  return index > 0 ? (int)((index - 1) / fanout_) : -1;
+}
+
+void
+gams::groups::GroupTree::get_children (size_t index,
+  std::vector<size_t> & children) const
+{
+  children.clear ();
+
+  for (size_t i = 1; i <= fanout_; ++i)
+  {
+    size_t child = fanout_ * index + i;
+
+    if (child >= members_.size ())
+      break;
+
+    children.push_back (child);
+  }
+}
+
+size_t
+gams::groups::GroupTree::get_depth (size_t index) const
+{
+  size_t depth = 0;
+
+  while (index > 0)
+  {
+    index = (index - 1) / fanout_;
+    ++depth;
+  }
+
+  return depth;
+}
+
+size_t
+gams::groups::GroupTree::get_height (void) const
+{
+  return members_.empty () ? 0 : get_depth (members_.size () - 1) + 1;
+}
+
+void
+gams::groups::GroupTree::get_subgroup (size_t index,
+  AgentVector & members) const
+{
+  members.clear ();
+
+  // each level of the subtree is a contiguous range of indices
+  size_t first = index;
+  size_t last = index;
+
+  while (first < members_.size ())
+  {
+    for (size_t i = first; i <= last && i < members_.size (); ++i)
+    {
+      members.push_back (members_[i]);
+    }
+
+    first = fanout_ * first + 1;
+    last = fanout_ * last + fanout_;
+  }
+}
@@ -0,0 +1,193 @@
+/**
+* Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following acknowledgments and disclaimers.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+*    Engineering Institute" shall not be used to endorse or promote products
+*    derived from this software without prior written permission. For written
+*    permission, please contact permission@sei.cmu.edu.
+*
+* 4. Products derived from this software may not be called "SEI" nor may "SEI"
+*    appear in their names without prior written permission of
+*    permission@sei.cmu.edu.
+*
+* 5. Redistributions of any form whatsoever must retain the following
+*    acknowledgment:
+*
+*      This material is based upon work funded and supported by the Department
+*      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+*      University for the operation of the Software Engineering Institute, a
+*      federally funded research and development center. Any opinions,
+*      findings and conclusions or recommendations expressed in this material
+*      are those of the author(s) and do not necessarily reflect the views of
+*      the United States Department of Defense.
+*
+*      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+*      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+*      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+*      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+*      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+*      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+*      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+*      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+*
+*      This material has been approved for public release and unlimited
+*      distribution.
+**/
+
+/**
+* @file GroupTree.h
+*
+* This file contains the definition of an aggregation tree over a group
+**/
+
+#ifndef   _GAMS_GROUPS_GROUP_TREE_H_
+#define   _GAMS_GROUPS_GROUP_TREE_H_
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "gams/GamsExport.h"
+#include "GroupBase.h"
+
+namespace gams
+{
+  namespace groups
+  {
+    /**
+    * Arranges the members of a group into a complete tree with a fixed
+    * fanout, so results can be reduced up the tree instead of every member
+    * reading every other member. Members are sorted, so every agent with
+    * the same member list builds the same tree. Member i has children
+    * fanout * i + 1 through fanout * i + fanout, and member 0 is the root.
+    * The subtree under a member is its subgroup.
+    **/
+    class GAMS_EXPORT GroupTree
+    {
+    public:
+      /**
+      * Constructor
+      * @param  fanout   the maximum children of a member
+      **/
+      GroupTree (size_t fanout = 4);
+
+      /**
+      * Sets the maximum children of a member
+      * @param  fanout   the maximum children (at least 1)
+      **/
+      void set_fanout (size_t fanout);
+
+      /**
+      * Gets the maximum children of a member
+      * @return  the fanout
+      **/
+      size_t get_fanout (void) const;
+
+      /**
+      * Builds the tree from a group, and rebuilds it in update when the
+      * group's membership changes
+      * @param  group   the group to arrange, or 0 to use set_members
+      **/
+      void set_group (const GroupBase * group);
+
+      /**
+      * Builds the tree from a member list
+      * @param  members   the members to arrange
+      **/
+      void set_members (const AgentVector & members);
+
+      /**
+      * Rebuilds the tree if the group has changed
+      * @return  true if the tree was rebuilt
+      **/
+      bool update (void);
+
+      /**
+      * Returns a number that changes whenever the tree is rebuilt
+      * @return  the tree version
+      **/
+      uint64_t get_version (void) const;
+
+      /**
+      * Returns the number of members in the tree
+      * @return  the member count
+      **/
+      size_t size (void) const;
+
+      /**
+      * Returns the members in tree order
+      * @return  the sorted members
+      **/
+      const AgentVector & get_members (void) const;
+
+      /**
+      * Returns the position of a member in the tree
+      * @param  member  the member (e.g., agent.0)
+      * @return  the index of the member, or -1 if not in the tree
+      **/
+      int get_index (const std::string & member) const;
+
+      /**
+      * Returns the parent of a member
+      * @param  index   the index of the member
+      * @return  the index of the parent, or -1 for the root
+      **/
+      int get_parent (size_t index) const;
+
+      /**
+      * Returns the children of a member
+      * @param  index     the index of the member
+      * @param  children  the indices of the children
+      **/
+      void get_children (size_t index, std::vector<size_t> & children) const;
+
+      /**
+      * Returns the depth of a member, where the root is at depth 0
+      * @param  index   the index of the member
+      * @return  the depth of the member
+      **/
+      size_t get_depth (size_t index) const;
+
+      /**
+      * Returns the number of levels in the tree
+      * @return  the height of the tree, 0 if empty
+      **/
+      size_t get_height (void) const;
+
+      /**
+      * Returns the subgroup of members under a member, itself included
+      * @param  index     the index of the member
+      * @param  members   the members of the subtree, in tree order
+      **/
+      void get_subgroup (size_t index, AgentVector & members) const;
+
+    private:
+      /// the maximum children of a member
+      size_t fanout_;
+
+      /// the group the tree is built from, if any
+      const GroupBase * group_;
+
+      /// the group version the tree was built from
+      uint64_t group_version_;
+
+      /// the members, sorted
+      AgentVector members_;
+
+      /// the tree version
+      uint64_t version_;
+    };
+  }
+}
+
+#endif // _GAMS_GROUPS_GROUP_TREE_H_
@@ -49,6 +49,7 @@
 #include "PlatformFactoryRepository.h"
 #include "DebugPlatform.h"
 #include "NullPlatform.h"
+#include "SimulatedPlatform.h"
 
 #ifdef _GAMS_VREP_
 #include "gams/platforms/vrep/VREPQuad.h"
@@ -109,6 +110,22 @@ platforms::PlatformFactoryRepository::initialize_default_mappings (void)
   aliases[0] = "null";
 
   add (aliases, new NullPlatformFactory ());
+
+  // the simulated quadrotor platform
+  aliases.resize (4);
+  aliases[0] = "sim-quad";
+  aliases[1] = "sim_quad";
+  aliases[2] = "sim-uav";
+  aliases[3] = "sim_uav";
+
+  add (aliases, new SimulatedPlatformFactory (SimulatedWorld::QUADROTOR));
+
+  // the simulated ground robot platform
+  aliases.resize (2);
+  aliases[0] = "sim-ground";
+  aliases[1] = "sim_ground";
+
+  add (aliases, new SimulatedPlatformFactory (SimulatedWorld::GROUND));
   
   // VREP Platforms
 #ifdef _GAMS_VREP_
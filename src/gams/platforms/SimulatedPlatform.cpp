@@ -0,0 +1,352 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file SimulatedPlatform.cpp
+ *
+ * This file contains the implementation of a platform simulated in process
+ * by a shared kinematic world
+ **/
+
+#include "SimulatedPlatform.h"
+#include "gams/loggers/GlobalLogger.h"
+#include "gams/pose/GPSFrame.h"
+#include "madara/knowledge/containers/NativeDoubleVector.h"
+
+namespace containers = madara::knowledge::containers;
+
+gams::platforms::SimulatedPlatformFactory::SimulatedPlatformFactory (
+  SimulatedWorld::AgentType type)
+  : type_ (type)
+{
+}
+
+gams::platforms::BasePlatform *
+gams::platforms::SimulatedPlatformFactory::create (
+  const madara::knowledge::KnowledgeMap & /*args*/,
+  madara::knowledge::KnowledgeBase * knowledge,
+  variables::Sensors * sensors,
+  variables::Platforms * platforms,
+  variables::Self * self)
+{
+  BasePlatform * result (0);
+
+  if (knowledge && sensors && platforms && self)
+  {
+    result = new SimulatedPlatform (knowledge, sensors, platforms, self,
+      type_);
+  }
+
+  return result;
+}
+
+gams::platforms::SimulatedPlatform::SimulatedPlatform (
+  madara::knowledge::KnowledgeBase * knowledge,
+  variables::Sensors * sensors,
+  variables::Platforms * platforms,
+  variables::Self * self,
+  SimulatedWorld::AgentType type)
+  : BasePlatform (knowledge, sensors, self),
+    world_ (SimulatedWorld::instance ()), type_ (type), index_ (0),
+    accuracy_ (1.0)
+{
+  if (platforms && knowledge)
+  {
+    (*platforms)[get_id ()].init_vars (*knowledge, get_id ());
+    status_ = (*platforms)[get_id ()];
+  }
+
+  move_speed_ = get_setting (".sim_move_speed", 2.0);
+  accuracy_ = get_setting (".sim_accuracy", 1.0);
+
+  // the origin of the world, as a GPS pose
+  pose::Pose origin (pose::gps_frame (), 0, 0, 0, 0, 0, 0);
+  if (knowledge_)
+  {
+    const std::string origin_key = knowledge_->exists (".sim_origin") ?
+      ".sim_origin" : ".vrep_sw_position";
+
+    if (knowledge_->exists (origin_key))
+    {
+      containers::NativeDoubleVector sw (origin_key, *knowledge_);
+
+      // as with VREP, the origin is stored as latitude, longitude
+      origin = pose::Pose (pose::gps_frame (), sw[1], sw[0], 0, 0, 0, 0);
+    }
+  }
+  world_frame_ = pose::ReferenceFrame (origin);
+
+  // the initial position in the world
+  pose::Position start (world_frame_,
+    get_setting (".initial_x", 0.0), get_setting (".initial_y", 0.0), 0);
+
+  if (knowledge_ && knowledge_->exists (".initial_lat") &&
+    knowledge_->exists (".initial_lon"))
+  {
+    pose::Position gps_start (pose::gps_frame (),
+      knowledge_->get (".initial_lon").to_double (),
+      knowledge_->get (".initial_lat").to_double ());
+
+    start = pose::Position (world_frame_, gps_start);
+  }
+
+  // the first platform configures the world for the whole process
+  if (knowledge_ && !world_.is_running ())
+  {
+    if (knowledge_->exists (".sim_threads"))
+    {
+      world_.set_threads (
+        (size_t)knowledge_->get (".sim_threads").to_integer ());
+    }
+
+    if (knowledge_->exists (".sim_turn_rate"))
+    {
+      world_.set_turn_rate (
+        knowledge_->get (".sim_turn_rate").to_double ());
+    }
+
+    world_.run (get_setting (".sim_hertz", 20.0),
+      get_setting (".sim_time_scale", 1.0));
+  }
+  else if (knowledge_)
+  {
+    check_world_setting (".sim_hertz", world_.get_hertz ());
+    check_world_setting (".sim_time_scale", world_.get_time_scale ());
+    check_world_setting (".sim_turn_rate", world_.get_turn_rate ());
+
+    // 0 threads asks for one per core, whatever the world chose
+    if (get_setting (".sim_threads", 0) > 0)
+    {
+      check_world_setting (".sim_threads", (double)world_.get_threads ());
+    }
+  }
+
+  index_ = world_.add (type, start.x (), start.y (),
+    get_setting (".initial_alt", 0.0), move_speed_);
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::platforms::SimulatedPlatform::constructor:" \
+    " added %s %d at [%f, %f], %d threads\n",
+    get_id ().c_str (), (int)index_, start.x (), start.y (),
+    (int)world_.get_threads ());
+
+  if (self_)
+  {
+    sense ();
+  }
+}
+
+gams::platforms::SimulatedPlatform::~SimulatedPlatform ()
+{
+  world_.remove (index_);
+}
+
+double
+gams::platforms::SimulatedPlatform::get_setting (
+  const std::string & name, double value) const
+{
+  if (knowledge_ && knowledge_->exists (name))
+  {
+    value = knowledge_->get (name).to_double ();
+  }
+
+  return value;
+}
+
+void
+gams::platforms::SimulatedPlatform::check_world_setting (
+  const std::string & name, double current) const
+{
+  if (knowledge_ && knowledge_->exists (name) &&
+    knowledge_->get (name).to_double () != current)
+  {
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_WARNING,
+      "gams::platforms::SimulatedPlatform::constructor:" \
+      " %s is %f, but the world was started with %f by the first" \
+      " simulated platform in this process. Ignoring.\n",
+      name.c_str (), knowledge_->get (name).to_double (), current);
+  }
+}
+
+int
+gams::platforms::SimulatedPlatform::analyze (void)
+{
+  return 0;
+}
+
+std::string
+gams::platforms::SimulatedPlatform::get_id () const
+{
+  return type_ == SimulatedWorld::GROUND ? "sim_ground" : "sim_quad";
+}
+
+std::string
+gams::platforms::SimulatedPlatform::get_name () const
+{
+  return type_ == SimulatedWorld::GROUND ?
+    "Simulated Ground Robot" : "Simulated Quadrotor";
+}
+
+double
+gams::platforms::SimulatedPlatform::get_accuracy () const
+{
+  return accuracy_;
+}
+
+double
+gams::platforms::SimulatedPlatform::get_move_speed () const
+{
+  return move_speed_;
+}
+
+void
+gams::platforms::SimulatedPlatform::set_move_speed (const double& speed)
+{
+  move_speed_ = speed;
+  world_.set_speed (index_, speed);
+}
+
+int
+gams::platforms::SimulatedPlatform::move (const pose::Position & target,
+  const PositionBounds & bounds)
+{
+  // update variables
+  int result = BasePlatform::move (target, bounds);
+
+  pose::Position world_target (world_frame_, target);
+
+  double x, y, z, yaw;
+  world_.get_state (index_, x, y, z, yaw);
+  pose::Position current (world_frame_, x, y, z);
+
+  if (bounds.check_position (current, world_target))
+  {
+    return 2;
+  }
+
+  if (*status_.paused_moving)
+  {
+    return result;
+  }
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_TRACE,
+    "gams::platforms::SimulatedPlatform::move:" \
+    " world target \"%f,%f,%f\"\n",
+    world_target.x (), world_target.y (), world_target.z ());
+
+  world_.set_destination (index_,
+    world_target.x (), world_target.y (), world_target.z ());
+
+  return 1;
+}
+
+void
+gams::platforms::SimulatedPlatform::pause_move (void)
+{
+  BasePlatform::pause_move ();
+  world_.stop (index_);
+}
+
+void
+gams::platforms::SimulatedPlatform::resume_move (void)
+{
+  BasePlatform::resume_move ();
+
+  pose::Position dest (get_frame (), 0, 0);
+  dest.from_container (self_->agent.dest);
+
+  pose::Position world_dest (world_frame_, dest);
+  world_.set_destination (index_,
+    world_dest.x (), world_dest.y (), world_dest.z ());
+}
+
+void
+gams::platforms::SimulatedPlatform::stop_move (void)
+{
+  BasePlatform::stop_move ();
+  world_.stop (index_);
+}
+
+int
+gams::platforms::SimulatedPlatform::sense (void)
+{
+  double x, y, z, yaw;
+  world_.get_state (index_, x, y, z, yaw);
+
+  pose::Position world_loc (world_frame_, x, y, z);
+  pose::Position loc (pose::gps_frame (), world_loc);
+
+  // set position in madara
+  loc.to_container (self_->agent.location);
+  self_->agent.orientation.set (0, 0.0);
+  self_->agent.orientation.set (1, 0.0);
+  self_->agent.orientation.set (2, yaw);
+
+  status_.movement_available = 1;
+
+  return 0;
+}
+
+const gams::pose::ReferenceFrame &
+gams::platforms::SimulatedPlatform::get_frame (void) const
+{
+  return pose::gps_frame ();
+}
+
+const gams::pose::ReferenceFrame &
+gams::platforms::SimulatedPlatform::get_world_frame (void) const
+{
+  return world_frame_;
+}
+
+size_t
+gams::platforms::SimulatedPlatform::get_world_index (void) const
+{
+  return index_;
+}
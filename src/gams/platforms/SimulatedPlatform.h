@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file SimulatedPlatform.h
+ *
+ * This file contains the definition of a platform simulated in process by
+ * a shared kinematic world
+ **/
+
+#ifndef   _GAMS_SIMULATED_PLATFORM_H_
+#define   _GAMS_SIMULATED_PLATFORM_H_
+
+#include "gams/platforms/PlatformFactory.h"
+#include "gams/platforms/BasePlatform.h"
+#include "gams/platforms/SimulatedWorld.h"
+#include "gams/variables/Self.h"
+#include "gams/variables/Sensor.h"
+#include "gams/variables/PlatformStatus.h"
+#include "gams/pose/ReferenceFrame.h"
+#include "madara/knowledge/KnowledgeBase.h"
+
+namespace gams
+{
+  namespace platforms
+  {
+    /**
+    * A quadrotor or ground robot simulated by SimulatedWorld::instance,
+    * which steps every simulated agent in the process together. No
+    * external simulator is needed.
+    *
+    * The platform reads its settings from the knowledge base:
+    * .sim_move_speed (meters per second, default 2), .sim_accuracy
+    * (meters, default 1), .sim_hertz (world steps per second, default 20,
+    * or 0 to step the world manually), .sim_time_scale (simulated seconds
+    * per second, default 1), .sim_threads (default one per core) and
+    * .sim_turn_rate (radians per second for ground robots). The world is
+    * configured and started by the first platform created, and later
+    * platforms that ask for other world settings are warned.
+    *
+    * gams_controller hosts one agent, so agents launched by the scenario
+    * scripts each step a world of their own. To step a swarm together,
+    * create its platforms in one process.
+    *
+    * Positions are GPS, relative to an origin at .sim_origin or, as with
+    * the VREP platforms, .vrep_sw_position. Agents start at
+    * .initial_lat/.initial_lon or .initial_x/.initial_y, at .initial_alt.
+    **/
+    class GAMS_EXPORT SimulatedPlatform : public BasePlatform
+    {
+    public:
+      /**
+       * Constructor
+       * @param  knowledge  knowledge base
+       * @param  sensors    map of sensor names to sensor information
+       * @param  platforms  map of platform names to platform information
+       * @param  self       agent variables that describe self state
+       * @param  type       the kind of agent to simulate
+       **/
+      SimulatedPlatform (
+        madara::knowledge::KnowledgeBase * knowledge,
+        variables::Sensors * sensors,
+        variables::Platforms * platforms,
+        variables::Self * self,
+        SimulatedWorld::AgentType type = SimulatedWorld::QUADROTOR);
+
+      /**
+       * Destructor. Removes the agent from the world.
+       **/
+      ~SimulatedPlatform ();
+
+      /**
+       * Analyzes platform information
+       * @return bitmask status of the platform. @see Status.
+       **/
+      virtual int analyze (void) override;
+
+      /**
+       * Get the location aproximation value of what is considered close enough
+       * @return location approximation radius
+       **/
+      virtual double get_accuracy () const override;
+
+      /**
+       * Gets the unique identifier of the platform. This should be an
+       * alphanumeric identifier that can be used as part of a MADARA
+       * variable (e.g. vrep_ant, autonomous_snake, etc.)
+       **/
+      virtual std::string get_id () const override;
+
+      /**
+       * Get move speed
+       **/
+      virtual double get_move_speed () const override;
+
+      /**
+       * Gets the name of the platform
+       **/
+      virtual std::string get_name () const override;
+
+      /**
+       * Moves the platform to a position
+       * @param   position  the coordinate to move to
+       * @param   bounds    the bounds of arrival
+       * @return 1 if moving, 2 if arrived, 0 if error
+       **/
+      int move (const pose::Position & position,
+        const PositionBounds & bounds) override;
+
+      using BasePlatform::move;
+
+      /**
+       * Pauses movement, keeping the destination
+       **/
+      virtual void pause_move (void) override;
+
+      /**
+       * Resumes movement toward the destination
+       **/
+      virtual void resume_move (void) override;
+
+      /**
+       * Stops movement and clears the destination
+       **/
+      virtual void stop_move (void) override;
+
+      /**
+       * Reads the position of the agent from the world
+       * @return number of sensors updated/used
+       **/
+      virtual int sense (void) override;
+
+      /**
+       * Set move speed
+       * @param speed new speed in meters/second
+       **/
+      virtual void set_move_speed (const double& speed) override;
+
+      /**
+       * Gets the frame platform positions are given in
+       * @return the GPS frame
+       **/
+      virtual const pose::ReferenceFrame & get_frame (void) const override;
+
+      /**
+       * Gets the Cartesian frame of the simulated world
+       * @return the world frame
+       **/
+      const pose::ReferenceFrame & get_world_frame (void) const;
+
+      /**
+       * Gets the index of this agent in the world
+       * @return the world index
+       **/
+      size_t get_world_index (void) const;
+
+    protected:
+      /**
+       * Returns a setting from the knowledge base
+       * @param  name     the setting
+       * @param  value    the default if the setting does not exist
+       * @return the setting
+       **/
+      double get_setting (const std::string & name, double value) const;
+
+      /**
+       * Warns if a setting differs from what the world already uses.
+       * World settings are fixed by the first platform in a process.
+       * @param  name     the setting
+       * @param  current  the value the world uses
+       **/
+      void check_world_setting (const std::string & name,
+        double current) const;
+
+      /// the shared world
+      SimulatedWorld & world_;
+
+      /// the kind of agent
+      SimulatedWorld::AgentType type_;
+
+      /// the Cartesian frame of the world
+      pose::ReferenceFrame world_frame_;
+
+      /// the index of this agent in the world
+      size_t index_;
+
+      /// location approximation radius in meters
+      double accuracy_;
+    };
+
+    /**
+     * A factory class for creating simulated platforms
+     **/
+    class GAMS_EXPORT SimulatedPlatformFactory : public PlatformFactory
+    {
+    public:
+      /**
+       * Constructor
+       * @param  type     the kind of agent created platforms simulate
+       **/
+      SimulatedPlatformFactory (
+        SimulatedWorld::AgentType type = SimulatedWorld::QUADROTOR);
+
+      /**
+       * Creates a simulated platform.
+       * @param   args      no arguments are necessary for this platform
+       * @param   knowledge the knowledge base. This will be set by the
+       *                    controller in init_vars.
+       * @param   sensors   the sensor info. This will be set by the
+       *                    controller in init_vars.
+       * @param   platforms status inform for all known agents. This
+       *                    will be set by the controller in init_vars
+       * @param   self      self-referencing variables. This will be
+       *                    set by the controller in init_vars
+       **/
+      virtual BasePlatform * create (
+        const madara::knowledge::KnowledgeMap & args,
+        madara::knowledge::KnowledgeBase * knowledge,
+        variables::Sensors * sensors,
+        variables::Platforms * platforms,
+        variables::Self * self);
+
+    protected:
+      /// the kind of agent created platforms simulate
+      SimulatedWorld::AgentType type_;
+    };
+  }
+}
+
+#endif // _GAMS_SIMULATED_PLATFORM_H_
@@ -0,0 +1,493 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file SimulatedWorld.cpp
+ *
+ * This file contains the implementation of an in-process kinematic world
+ * that steps every simulated agent at once
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "SimulatedWorld.h"
+
+namespace
+{
+  /// fewest agents per thread worth waking the pool for
+  const size_t MIN_AGENTS_PER_THREAD = 256;
+
+  const double TWO_PI = 6.283185307179586;
+}
+
+gams::platforms::SimulatedWorld::SimulatedWorld ()
+  : turn_rate_ (1.5707963267948966), time_ (0), threads_ (1),
+    generation_ (0), pending_ (0), step_count_ (0), step_parts_ (1),
+    step_dt_ (0), shutdown_ (false), stepping_ (false), hertz_ (0),
+    time_scale_ (0)
+{
+  set_threads (0);
+}
+
+gams::platforms::SimulatedWorld::~SimulatedWorld ()
+{
+  terminate ();
+
+  std::lock_guard<std::mutex> guard (mutex_);
+  resize_pool (0);
+}
+
+gams::platforms::SimulatedWorld &
+gams::platforms::SimulatedWorld::instance (void)
+{
+  static SimulatedWorld world;
+  return world;
+}
+
+size_t
+gams::platforms::SimulatedWorld::add (AgentType type,
+  double x, double y, double z, double speed)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  size_t index = x_.size ();
+
+  if (free_.size () > 0)
+  {
+    index = free_.back ();
+    free_.pop_back ();
+  }
+  else
+  {
+    x_.push_back (0);
+    y_.push_back (0);
+    z_.push_back (0);
+    dest_x_.push_back (0);
+    dest_y_.push_back (0);
+    dest_z_.push_back (0);
+    yaw_.push_back (0);
+    speed_.push_back (0);
+    type_.push_back (0);
+    moving_.push_back (0);
+  }
+
+  x_[index] = dest_x_[index] = x;
+  y_[index] = dest_y_[index] = y;
+  z_[index] = dest_z_[index] = z;
+  yaw_[index] = 0;
+  speed_[index] = speed;
+  type_[index] = (unsigned char)type;
+  moving_[index] = 0;
+
+  return index;
+}
+
+void
+gams::platforms::SimulatedWorld::remove (size_t index)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (index < x_.size ())
+  {
+    moving_[index] = 0;
+    free_.push_back (index);
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::set_destination (size_t index,
+  double x, double y, double z)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (index < x_.size ())
+  {
+    dest_x_[index] = x;
+    dest_y_[index] = y;
+    moving_[index] = 1;
+
+    if (type_[index] == GROUND)
+    {
+      dest_z_[index] = z_[index];
+    }
+    else
+    {
+      dest_z_[index] = z;
+
+      // quadrotors fly straight, so they face their destination at once
+      if (x != x_[index] || y != y_[index])
+        yaw_[index] = std::atan2 (y - y_[index], x - x_[index]);
+    }
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::stop (size_t index)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (index < x_.size ())
+  {
+    dest_x_[index] = x_[index];
+    dest_y_[index] = y_[index];
+    dest_z_[index] = z_[index];
+    moving_[index] = 0;
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::set_speed (size_t index, double speed)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (index < x_.size ())
+  {
+    speed_[index] = speed;
+  }
+}
+
+bool
+gams::platforms::SimulatedWorld::get_state (size_t index,
+  double & x, double & y, double & z, double & yaw) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (index < x_.size ())
+  {
+    x = x_[index];
+    y = y_[index];
+    z = z_[index];
+    yaw = yaw_[index];
+
+    return moving_[index] != 0;
+  }
+
+  return false;
+}
+
+size_t
+gams::platforms::SimulatedWorld::size (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return x_.size ();
+}
+
+void
+gams::platforms::SimulatedWorld::set_turn_rate (double rate)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  turn_rate_ = rate;
+}
+
+double
+gams::platforms::SimulatedWorld::get_turn_rate (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return turn_rate_;
+}
+
+void
+gams::platforms::SimulatedWorld::set_threads (size_t threads)
+{
+  if (threads == 0)
+  {
+    threads = std::max (1u, std::thread::hardware_concurrency ());
+  }
+
+  std::lock_guard<std::mutex> guard (mutex_);
+  threads_ = threads;
+}
+
+size_t
+gams::platforms::SimulatedWorld::get_threads (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return threads_;
+}
+
+double
+gams::platforms::SimulatedWorld::get_time (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return time_;
+}
+
+void
+gams::platforms::SimulatedWorld::step (double dt)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  const size_t count = x_.size ();
+  const size_t parts = std::min (threads_,
+    std::max ((size_t)1, count / MIN_AGENTS_PER_THREAD));
+
+  if (parts > 1)
+  {
+    if (workers_.size () < parts - 1)
+    {
+      resize_pool (threads_ - 1);
+    }
+
+    {
+      std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+      step_count_ = count;
+      step_parts_ = parts;
+      step_dt_ = dt;
+      pending_ = workers_.size ();
+      ++generation_;
+    }
+    work_ready_.notify_all ();
+
+    // the caller steps the first part
+    step_range (0, count / parts, dt);
+
+    std::unique_lock<std::mutex> lock (pool_mutex_);
+    work_done_.wait (lock, [this] { return pending_ == 0; });
+  }
+  else
+  {
+    step_range (0, count, dt);
+  }
+
+  time_ += dt;
+}
+
+void
+gams::platforms::SimulatedWorld::step_range (size_t begin, size_t end,
+  double dt)
+{
+  const double turn = turn_rate_ * dt;
+
+  for (size_t i = begin; i < end; ++i)
+  {
+    if (!moving_[i])
+      continue;
+
+    const double dx = dest_x_[i] - x_[i];
+    const double dy = dest_y_[i] - y_[i];
+    const double reach = speed_[i] * dt;
+
+    if (type_[i] == QUADROTOR)
+    {
+      const double dz = dest_z_[i] - z_[i];
+      const double distance = std::sqrt (dx * dx + dy * dy + dz * dz);
+
+      if (distance <= reach)
+      {
+        x_[i] = dest_x_[i];
+        y_[i] = dest_y_[i];
+        z_[i] = dest_z_[i];
+        moving_[i] = 0;
+      }
+      else
+      {
+        const double scale = reach / distance;
+        x_[i] += dx * scale;
+        y_[i] += dy * scale;
+        z_[i] += dz * scale;
+      }
+    }
+    else
+    {
+      if (dx * dx + dy * dy <= reach * reach)
+      {
+        x_[i] = dest_x_[i];
+        y_[i] = dest_y_[i];
+        moving_[i] = 0;
+        continue;
+      }
+
+      // turn toward the destination, then drive along the new heading
+      double error = std::remainder (std::atan2 (dy, dx) - yaw_[i], TWO_PI);
+      const double turned = std::max (-turn, std::min (turn, error));
+      error -= turned;
+
+      const double yaw = std::remainder (yaw_[i] + turned, TWO_PI);
+      const double forward = reach * std::max (0.0, std::cos (error));
+
+      yaw_[i] = yaw;
+      x_[i] += forward * std::cos (yaw);
+      y_[i] += forward * std::sin (yaw);
+    }
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::work (size_t worker, size_t generation)
+{
+  std::unique_lock<std::mutex> lock (pool_mutex_);
+
+  for (;;)
+  {
+    work_ready_.wait (lock, [this, generation] {
+      return shutdown_ || generation_ != generation; });
+
+    if (shutdown_)
+      return;
+
+    generation = generation_;
+
+    const size_t count = step_count_;
+    const size_t parts = step_parts_;
+    const double dt = step_dt_;
+
+    // workers past the parts of this step have nothing to do
+    if (worker + 1 < parts)
+    {
+      lock.unlock ();
+      step_range (count * (worker + 1) / parts, count * (worker + 2) / parts,
+        dt);
+      lock.lock ();
+    }
+
+    if (--pending_ == 0)
+      work_done_.notify_one ();
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::resize_pool (size_t workers)
+{
+  {
+    std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+    shutdown_ = true;
+  }
+  work_ready_.notify_all ();
+
+  for (size_t i = 0; i < workers_.size (); ++i)
+  {
+    workers_[i].join ();
+  }
+
+  workers_.clear ();
+
+  std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+  shutdown_ = false;
+
+  for (size_t i = 0; i < workers; ++i)
+  {
+    workers_.push_back (
+      std::thread (&SimulatedWorld::work, this, i, generation_));
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::run (double hertz, double time_scale)
+{
+  std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+
+  if (!stepping_ && hertz > 0)
+  {
+    stepping_ = true;
+    hertz_ = hertz;
+    time_scale_ = time_scale;
+    stepper_ = std::thread (
+      &SimulatedWorld::step_loop, this, hertz, time_scale);
+  }
+}
+
+void
+gams::platforms::SimulatedWorld::terminate (void)
+{
+  {
+    std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+    stepping_ = false;
+  }
+  stepper_wake_.notify_all ();
+
+  if (stepper_.joinable ())
+  {
+    stepper_.join ();
+  }
+}
+
+bool
+gams::platforms::SimulatedWorld::is_running (void) const
+{
+  std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+  return stepping_;
+}
+
+double
+gams::platforms::SimulatedWorld::get_hertz (void) const
+{
+  std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+  return hertz_;
+}
+
+double
+gams::platforms::SimulatedWorld::get_time_scale (void) const
+{
+  std::lock_guard<std::mutex> pool_guard (pool_mutex_);
+  return time_scale_;
+}
+
+void
+gams::platforms::SimulatedWorld::step_loop (double hertz, double time_scale)
+{
+  typedef std::chrono::steady_clock Clock;
+
+  const Clock::duration period = std::chrono::duration_cast<Clock::duration> (
+    std::chrono::duration<double> (1.0 / hertz));
+  const double dt = time_scale / hertz;
+
+  Clock::time_point next = Clock::now ();
+  std::unique_lock<std::mutex> lock (pool_mutex_);
+
+  while (stepping_)
+  {
+    lock.unlock ();
+    step (dt);
+    lock.lock ();
+
+    // if a step overran its period, do not try to catch up
+    next = std::max (next + period, Clock::now ());
+
+    stepper_wake_.wait_until (lock, next, [this] { return !stepping_; });
+  }
+}
@@ -0,0 +1,347 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file SimulatedWorld.h
+ *
+ * This file contains the definition of an in-process kinematic world that
+ * steps every simulated agent at once
+ **/
+
+#ifndef   _GAMS_PLATFORMS_SIMULATED_WORLD_H_
+#define   _GAMS_PLATFORMS_SIMULATED_WORLD_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace platforms
+  {
+    /**
+    * A world of simple kinematic agents, stepped without an external
+    * simulator. Agent state is held as one array per field, and each
+    * step updates every agent over a pool of threads. Positions are in
+    * meters in the Cartesian frame of the world's users.
+    *
+    * Quadrotors fly straight to their destination at their speed. Ground
+    * agents stay at their initial altitude, turn toward their
+    * destination at a limited rate, and drive forward scaled by how well
+    * they face it.
+    *
+    * Agents are added and moved from any thread. The world is stepped
+    * either by calling step or by a stepper thread started with run.
+    **/
+    class GAMS_EXPORT SimulatedWorld
+    {
+    public:
+      /**
+       * Kinds of simulated agents
+       **/
+      enum AgentType
+      {
+        QUADROTOR = 0,
+        GROUND = 1
+      };
+
+      /**
+       * Constructor
+       **/
+      SimulatedWorld ();
+
+      /**
+       * Destructor. Terminates the stepper and worker threads.
+       **/
+      ~SimulatedWorld ();
+
+      /**
+       * Returns the world shared by simulated platforms in this process
+       * @return  the shared world
+       **/
+      static SimulatedWorld & instance (void);
+
+      /**
+       * Adds an agent at rest. Indices of removed agents are reused.
+       * @param  type      the kind of agent
+       * @param  x         the initial x in meters
+       * @param  y         the initial y in meters
+       * @param  z         the initial z in meters
+       * @param  speed     the speed in meters per second
+       * @return the index of the agent
+       **/
+      size_t add (AgentType type, double x, double y, double z,
+        double speed);
+
+      /**
+       * Removes an agent from the world
+       * @param  index     the index of the agent
+       **/
+      void remove (size_t index);
+
+      /**
+       * Moves an agent toward a destination. Ground agents ignore z.
+       * @param  index     the index of the agent
+       * @param  x         the destination x in meters
+       * @param  y         the destination y in meters
+       * @param  z         the destination z in meters
+       **/
+      void set_destination (size_t index, double x, double y, double z);
+
+      /**
+       * Stops an agent where it is
+       * @param  index     the index of the agent
+       **/
+      void stop (size_t index);
+
+      /**
+       * Sets the speed of an agent
+       * @param  index     the index of the agent
+       * @param  speed     the speed in meters per second
+       **/
+      void set_speed (size_t index, double speed);
+
+      /**
+       * Reads the position and heading of an agent
+       * @param  index     the index of the agent
+       * @param  x         the x in meters
+       * @param  y         the y in meters
+       * @param  z         the z in meters
+       * @param  yaw       the heading in radians from the x axis
+       * @return true if the agent is still moving
+       **/
+      bool get_state (size_t index,
+        double & x, double & y, double & z, double & yaw) const;
+
+      /**
+       * Returns the number of agent slots, including removed agents
+       * @return the number of slots
+       **/
+      size_t size (void) const;
+
+      /**
+       * Sets the turn rate of ground agents
+       * @param  rate      radians per second
+       **/
+      void set_turn_rate (double rate);
+
+      /**
+       * Returns the turn rate of ground agents
+       * @return radians per second
+       **/
+      double get_turn_rate (void) const;
+
+      /**
+       * Sets the number of threads a step runs on, including the caller
+       * @param  threads   the number of threads, or 0 for one per core
+       **/
+      void set_threads (size_t threads);
+
+      /**
+       * Returns the number of threads a step runs on
+       * @return the number of threads
+       **/
+      size_t get_threads (void) const;
+
+      /**
+       * Advances every agent
+       * @param  dt        the simulated seconds to advance
+       **/
+      void step (double dt);
+
+      /**
+       * Returns the simulated time
+       * @return seconds simulated since the world was created
+       **/
+      double get_time (void) const;
+
+      /**
+       * Starts a thread that steps the world. Each of the hertz ticks per
+       * second advances time_scale / hertz simulated seconds, so a time
+       * scale above 1 runs faster than real time. Does nothing if the
+       * stepper is already running.
+       * @param  hertz       steps per second of wall clock time
+       * @param  time_scale  simulated seconds per second
+       **/
+      void run (double hertz, double time_scale = 1.0);
+
+      /**
+       * Stops the stepper thread, if it is running
+       **/
+      void terminate (void);
+
+      /**
+       * Checks if the stepper thread is running
+       * @return true if the world is stepping itself
+       **/
+      bool is_running (void) const;
+
+      /**
+       * Returns the steps per second of the stepper thread
+       * @return the hertz passed to run, or 0 if it was never run
+       **/
+      double get_hertz (void) const;
+
+      /**
+       * Returns the simulated seconds per second of the stepper thread
+       * @return the time scale passed to run, or 0 if it was never run
+       **/
+      double get_time_scale (void) const;
+
+    private:
+      /**
+       * Advances the agents in [begin, end)
+       * @param  begin     the first agent
+       * @param  end       one past the last agent
+       * @param  dt        the simulated seconds to advance
+       **/
+      void step_range (size_t begin, size_t end, double dt);
+
+      /**
+       * Runs a worker of the step pool
+       * @param  worker      the index of the worker
+       * @param  generation  the last step the worker has seen
+       **/
+      void work (size_t worker, size_t generation);
+
+      /**
+       * Runs the stepper thread
+       * @param  hertz       steps per second of wall clock time
+       * @param  time_scale  simulated seconds per second
+       **/
+      void step_loop (double hertz, double time_scale);
+
+      /**
+       * Stops the workers and starts a new pool. Callers hold mutex_.
+       * @param  workers   the number of workers
+       **/
+      void resize_pool (size_t workers);
+
+      /// guards agent state. Held by step for the whole step.
+      mutable std::mutex mutex_;
+
+      /// agent positions
+      std::vector<double> x_, y_, z_;
+
+      /// agent destinations
+      std::vector<double> dest_x_, dest_y_, dest_z_;
+
+      /// agent headings in radians
+      std::vector<double> yaw_;
+
+      /// agent speeds in meters per second
+      std::vector<double> speed_;
+
+      /// agent kinds
+      std::vector<unsigned char> type_;
+
+      /// 1 while an agent is moving toward its destination
+      std::vector<unsigned char> moving_;
+
+      /// removed agent slots that can be reused
+      std::vector<size_t> free_;
+
+      /// turn rate of ground agents in radians per second
+      double turn_rate_;
+
+      /// simulated seconds
+      double time_;
+
+      /// threads per step, including the caller
+      size_t threads_;
+
+      /// guards the pool and the stepper flag
+      mutable std::mutex pool_mutex_;
+
+      /// the pool of step workers
+      std::vector<std::thread> workers_;
+
+      /// signals workers that a step (or shutdown) is ready
+      std::condition_variable work_ready_;
+
+      /// signals the stepping thread that workers are done
+      std::condition_variable work_done_;
+
+      /// incremented for each step given to the pool
+      size_t generation_;
+
+      /// workers still running the current step
+      size_t pending_;
+
+      /// agents in the current step
+      size_t step_count_;
+
+      /// parts the current step is split into
+      size_t step_parts_;
+
+      /// the time step of the current step
+      double step_dt_;
+
+      /// true while workers should exit
+      bool shutdown_;
+
+      /// the stepper thread
+      std::thread stepper_;
+
+      /// wakes the stepper when it should stop
+      std::condition_variable stepper_wake_;
+
+      /// true while the stepper should run
+      bool stepping_;
+
+      /// steps per second of the stepper
+      double hertz_;
+
+      /// simulated seconds per second of the stepper
+      double time_scale_;
+    };
+  }
+}
+
+#endif // _GAMS_PLATFORMS_SIMULATED_WORLD_H_
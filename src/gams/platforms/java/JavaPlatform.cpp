@@ -54,23 +54,18 @@ gams::platforms::JavaPlatform::JavaPlatform (
   variables::Sensors * sensors,
   variables::Platforms * platforms,
   variables::Self * self)
-  : BasePlatform (knowledge, sensors, self)
+  : BasePlatform (knowledge, sensors, self),
+  obj_ (0), class_ (0), position_class_ (0), axes_class_ (0),
+  position_init_ (0), position_free_ (0), axes_init_ (0), axes_free_ (0),
+  analyze_method_ (0), get_accuracy_method_ (0), get_id_method_ (0),
+  get_move_speed_method_ (0), get_name_method_ (0), home_method_ (0),
+  land_method_ (0), move_method_ (0), rotate_method_ (0), sense_method_ (0),
+  set_move_speed_method_ (0), takeoff_method_ (0)
 {
   gams::utility::java::Acquire_VM jvm;
   
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::constructor:" \
-      " initializing platform and status.\n");
-  
-    if (platforms && knowledge)
-    {
-      (*platforms)[get_id ()].init_vars (*knowledge, get_id ());
-      status_ = (*platforms)[get_id ()];
-    }
-
     madara_logger_ptr_log (gams::loggers::global_logger.get (),
       gams::loggers::LOG_MAJOR,
        "gams::platforms::JavaPlatform::constructor:" \
@@ -83,7 +78,10 @@ gams::platforms::JavaPlatform::JavaPlatform (
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::constructor:" \
         " allocating global reference for object's class.\n");
-      class_ = (jclass) jvm.env->NewGlobalRef (jvm.env->GetObjectClass (obj_));
+
+      jclass local_class = jvm.env->GetObjectClass (obj_);
+      class_ = (jclass) jvm.env->NewGlobalRef (local_class);
+      jvm.env->DeleteLocalRef (local_class);
 
       if (class_)
       {
@@ -91,6 +89,8 @@ gams::platforms::JavaPlatform::JavaPlatform (
           gams::loggers::LOG_MAJOR,
            "gams::platforms::JavaPlatform::constructor:" \
           " class and object obtained successfully.\n");
+
+        resolve_methods (jvm.env);
       }
       else
       {
@@ -107,6 +107,18 @@ gams::platforms::JavaPlatform::JavaPlatform (
          "gams::platforms::JavaPlatform::constructor:" \
         " ERROR: object is invalid.\n");
     }
+
+    madara_logger_ptr_log (gams::loggers::global_logger.get (),
+      gams::loggers::LOG_MAJOR,
+       "gams::platforms::JavaPlatform::constructor:" \
+      " initializing platform and status.\n");
+  
+    if (platforms && knowledge)
+    {
+      std::string id (get_id ());
+      (*platforms)[id].init_vars (*knowledge, id);
+      status_ = (*platforms)[id];
+    }
   }
 }
 
@@ -122,6 +134,76 @@ gams::platforms::JavaPlatform::~JavaPlatform ()
 
     jvm.env->DeleteGlobalRef (obj_);
     jvm.env->DeleteGlobalRef (class_);
+    release_classes (jvm.env);
+  }
+}
+
+void
+gams::platforms::JavaPlatform::resolve_methods (JNIEnv * env)
+{
+  using utility::java::find_method;
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+     "gams::platforms::JavaPlatform::resolve_methods:" \
+    " Obtaining user-defined methods.\n");
+
+  analyze_method_ = find_method (env, class_, "analyze", "()I");
+  get_accuracy_method_ = find_method (env, class_, "getAccuracy", "()D");
+  get_id_method_ = find_method (env, class_,
+    "getId", "()Ljava/lang/String;");
+  get_move_speed_method_ = find_method (env, class_, "getMoveSpeed", "()D");
+  get_name_method_ = find_method (env, class_,
+    "getName", "()Ljava/lang/String;");
+  home_method_ = find_method (env, class_, "home", "()I");
+  land_method_ = find_method (env, class_, "land", "()I");
+  move_method_ = find_method (env, class_,
+    "move", "(Lai/gams/utility/Position;D)I");
+  rotate_method_ = find_method (env, class_,
+    "rotate", "(Lai/gams/utility/Axes;)I");
+  sense_method_ = find_method (env, class_, "sense", "()I");
+  set_move_speed_method_ = find_method (env, class_, "setMoveSpeed", "(D)V");
+  takeoff_method_ = find_method (env, class_, "takeoff", "()I");
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+     "gams::platforms::JavaPlatform::resolve_methods:" \
+    " Obtaining Position and Axes classes and constructors.\n");
+
+  jclass weak_class = utility::java::find_class (env, "ai/gams/utility/Position");
+  if (weak_class)
+  {
+    position_class_ = (jclass) env->NewGlobalRef (weak_class);
+    env->DeleteWeakGlobalRef (weak_class);
+
+    position_init_ = find_method (env, position_class_, "<init>", "(DDD)V");
+    position_free_ = find_method (env, position_class_, "free", "()V");
+  }
+
+  weak_class = utility::java::find_class (env, "ai/gams/utility/Axes");
+  if (weak_class)
+  {
+    axes_class_ = (jclass) env->NewGlobalRef (weak_class);
+    env->DeleteWeakGlobalRef (weak_class);
+
+    axes_init_ = find_method (env, axes_class_, "<init>", "(DDD)V");
+    axes_free_ = find_method (env, axes_class_, "free", "()V");
+  }
+}
+
+void
+gams::platforms::JavaPlatform::release_classes (JNIEnv * env)
+{
+  if (position_class_)
+  {
+    env->DeleteGlobalRef (position_class_);
+    position_class_ = 0;
+  }
+
+  if (axes_class_)
+  {
+    env->DeleteGlobalRef (axes_class_);
+    axes_class_ = 0;
   }
 }
 
@@ -156,9 +238,32 @@ gams::platforms::JavaPlatform::operator= (const JavaPlatform & rhs)
 
       jvm.env->DeleteGlobalRef (obj_);
       jvm.env->DeleteGlobalRef (class_);
+      release_classes (jvm.env);
 
       obj_ = jvm.env->NewGlobalRef (rhs.obj_);
       class_ = (jclass) jvm.env->NewGlobalRef (rhs.class_);
+
+      if (rhs.position_class_)
+        position_class_ = (jclass) jvm.env->NewGlobalRef (rhs.position_class_);
+      if (rhs.axes_class_)
+        axes_class_ = (jclass) jvm.env->NewGlobalRef (rhs.axes_class_);
+
+      position_init_ = rhs.position_init_;
+      position_free_ = rhs.position_free_;
+      axes_init_ = rhs.axes_init_;
+      axes_free_ = rhs.axes_free_;
+      analyze_method_ = rhs.analyze_method_;
+      get_accuracy_method_ = rhs.get_accuracy_method_;
+      get_id_method_ = rhs.get_id_method_;
+      get_move_speed_method_ = rhs.get_move_speed_method_;
+      get_name_method_ = rhs.get_name_method_;
+      home_method_ = rhs.home_method_;
+      land_method_ = rhs.land_method_;
+      move_method_ = rhs.move_method_;
+      rotate_method_ = rhs.rotate_method_;
+      sense_method_ = rhs.sense_method_;
+      set_move_speed_method_ = rhs.set_move_speed_method_;
+      takeoff_method_ = rhs.takeoff_method_;
     }
   }
 }
@@ -166,25 +271,18 @@ gams::platforms::JavaPlatform::operator= (const JavaPlatform & rhs)
 int
 gams::platforms::JavaPlatform::analyze (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::platforms::JavaPlatform::analyze:" \
-      " Obtaining user-defined analyze method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "analyze", "()I");
-
-    if (call)
+    if (analyze_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::platforms::JavaPlatform::analyze:" \
         " Calling user-defined analyze method.\n");
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, analyze_method_);
     }
     else
     {
@@ -208,27 +306,19 @@ gams::platforms::JavaPlatform::analyze (void)
 double
 gams::platforms::JavaPlatform::get_accuracy () const
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jdouble result (0);
 
   if (jvm.env)
   {
-
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::platforms::JavaPlatform::get_accuracy:" \
-      " Obtaining user-defined getAccuracy method.\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "getAccuracy", "()D");
-
-    if (call)
+    if (get_accuracy_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::platforms::JavaPlatform::get_accuracy:" \
         " Calling user-defined getAccuracy method.\n");
 
-      result = jvm.env->CallDoubleMethod (obj_, call);
+      result = jvm.env->CallDoubleMethod (obj_, get_accuracy_method_);
     }
     else
     {
@@ -256,29 +346,27 @@ gams::platforms::JavaPlatform::get_accuracy () const
 
 std::string gams::platforms::JavaPlatform::get_id () const
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   std::string id;
   jstring result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::get_id:" \
-      " Obtaining user-defined getId method.\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "getId", "()Ljava.lang.String;" );
-
-    if (call)
+    if (get_id_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::get_id:" \
         " Calling user-defined getId method.\n");
 
-      result = (jstring) jvm.env->CallObjectMethod (obj_, call);
-      const char * id_chars = jvm.env->GetStringUTFChars(result, 0);
-      id = id_chars;
+      result = (jstring) jvm.env->CallObjectMethod (obj_, get_id_method_);
+      if (result)
+      {
+        const char * id_chars = jvm.env->GetStringUTFChars(result, 0);
+        id = id_chars;
+        jvm.env->ReleaseStringUTFChars (result, id_chars);
+        jvm.env->DeleteLocalRef (result);
+      }
     }
     else
     {
@@ -300,29 +388,27 @@ std::string gams::platforms::JavaPlatform::get_id () const
 
 std::string gams::platforms::JavaPlatform::get_name () const
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   std::string name;
   jstring result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::get_name:" \
-      " Obtaining user-defined getName method.\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "getName", "()Ljava.lang.String;" );
-
-    if (call)
+    if (get_name_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::get_name:" \
         " Calling user-defined getName method.\n");
 
-      result = (jstring) jvm.env->CallObjectMethod (obj_, call);
-      const char * name_chars = jvm.env->GetStringUTFChars(result, 0);
-      name = name_chars;
+      result = (jstring) jvm.env->CallObjectMethod (obj_, get_name_method_);
+      if (result)
+      {
+        const char * name_chars = jvm.env->GetStringUTFChars(result, 0);
+        name = name_chars;
+        jvm.env->ReleaseStringUTFChars (result, name_chars);
+        jvm.env->DeleteLocalRef (result);
+      }
     }
     else
     {
@@ -347,26 +433,19 @@ std::string gams::platforms::JavaPlatform::get_name () const
 double
 gams::platforms::JavaPlatform::get_move_speed () const
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jdouble result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-      "gams::platforms::JavaPlatform::get_move_speed:" \
-      " Obtaining user-defined getMoveSpeed method\n");
-
-    jmethodID call = jvm.env->GetMethodID (class_, "getMoveSpeed", "()D");
-
-    if (call)
+    if (get_move_speed_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
         "gams::platforms::JavaPlatform::get_move_speed:" \
         " Calling user-defined getMoveSpeed method.\n");
 
-      result = jvm.env->CallDoubleMethod (obj_, call);
+      result = jvm.env->CallDoubleMethod (obj_, get_move_speed_method_);
     }
     else
     {
@@ -390,26 +469,19 @@ gams::platforms::JavaPlatform::get_move_speed () const
 int
 gams::platforms::JavaPlatform::home (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::home:" \
-      " Obtaining user-defined home method\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "home", "()I" );
-
-    if (call)
+    if (home_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::home:" \
         " Calling user-defined home method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, home_method_);
     }
     else
     {
@@ -432,26 +504,19 @@ gams::platforms::JavaPlatform::home (void)
 int
 gams::platforms::JavaPlatform::land (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::land:" \
-      " Obtaining user-defined land method\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "land", "()I" );
-
-    if (call)
+    if (land_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::land:" \
         " Calling user-defined land method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, land_method_);
     }
     else
     {
@@ -476,37 +541,20 @@ int
 gams::platforms::JavaPlatform::move (const pose::Position & position,
         const PositionBounds &)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::move:" \
-      " Obtaining user-defined move method\n");
-
-    jmethodID move_call = jvm.env->GetMethodID(
-      class_, "move", "(Lai/gams/utility/Position;D)I" );
-
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::move:" \
-      " Obtaining Position class and constructor\n");
-
-    jclass pos_class = utility::java::find_class (jvm.env, "ai/gams/pose/Position");
-    jmethodID pos_const = jvm.env->GetMethodID (pos_class, "<init>", "(DDD)V");
-    jmethodID pos_free = jvm.env->GetMethodID (pos_class, "free", "()V");
-
-    if (move_call)
+    if (move_method_ && position_init_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MINOR,
          "gams::platforms::JavaPlatform::move:" \
         " Creating new position object.\n");
 
-      jobject inpos = jvm.env->NewObject (
-        pos_class, pos_const, position.x (), position.y (), position.z ());
+      jobject inpos = jvm.env->NewObject (position_class_, position_init_,
+        position.x (), position.y (), position.z ());
       jdouble inepsilon (0.1); // TODO support bounds checking in Java
 
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
@@ -514,9 +562,10 @@ gams::platforms::JavaPlatform::move (const pose::Position & position,
          "gams::platforms::JavaPlatform::move:" \
         " Calling user-defined move method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, move_call, inpos, inepsilon);
+      result = jvm.env->CallIntMethod (obj_, move_method_, inpos, inepsilon);
 
-      jvm.env->CallVoidMethod (inpos, pos_free);
+      if (position_free_)
+        jvm.env->CallVoidMethod (inpos, position_free_);
 
       jvm.env->DeleteLocalRef (inpos);
     }
@@ -527,14 +576,12 @@ gams::platforms::JavaPlatform::move (const pose::Position & position,
          "gams::platforms::JavaPlatform::move:" \
         " ERROR: Unable to find user-defined move method.\n");
     }
-
-    jvm.env->DeleteWeakGlobalRef (pos_class);
   }
   else
   {
     madara_logger_ptr_log (gams::loggers::global_logger.get (),
       gams::loggers::LOG_ERROR,
-      "gams::platforms::JavaPlatform::analyze:" \
+      "gams::platforms::JavaPlatform::move:" \
       " ERROR: Unable to obtain JVM environment.\n");
   }
 
@@ -545,29 +592,12 @@ int
 gams::platforms::JavaPlatform::orient (const pose::Orientation & axes,
     const OrientationBounds &)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::rotate:" \
-      " Obtaining user-defined rotate method\n");
-
-    jmethodID move_call = jvm.env->GetMethodID (
-      class_, "move", "(Lai/gams/utility/Position;D)I");
-
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MINOR,
-       "gams::platforms::JavaPlatform::rotate:" \
-      " Obtaining Axes class and constructor\n");
-
-    jclass axes_class = utility::java::find_class (jvm.env, "ai/gams/pose/Orientation");
-    jmethodID axes_const = jvm.env->GetMethodID (axes_class, "<init>", "(DDD)V");
-    jmethodID axes_free = jvm.env->GetMethodID (axes_class, "free", "()V");
-
-    if (move_call)
+    if (rotate_method_ && axes_init_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MINOR,
@@ -575,16 +605,18 @@ gams::platforms::JavaPlatform::orient (const pose::Orientation & axes,
         " Creating new axes object.\n");
 
       jobject inaxes = jvm.env->NewObject (
-        axes_class, axes_const, axes.rx (), axes.ry (), axes.rz ());
+        axes_class_, axes_init_, axes.rx (), axes.ry (), axes.rz ());
 
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::rotate:" \
         " Calling user-defined rotate method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, move_call, inaxes);
+      result = jvm.env->CallIntMethod (obj_, rotate_method_, inaxes);
+
+      if (axes_free_)
+        jvm.env->CallVoidMethod (inaxes, axes_free_);
 
-      jvm.env->CallVoidMethod (inaxes, axes_free);
       jvm.env->DeleteLocalRef (inaxes);
     }
     else
@@ -594,8 +626,6 @@ gams::platforms::JavaPlatform::orient (const pose::Orientation & axes,
          "gams::platforms::JavaPlatform::rotate:" \
         " ERROR: Unable to find user-defined rotate method.\n");
     }
-
-    jvm.env->DeleteWeakGlobalRef (axes_class);
   }
   else
   {
@@ -611,57 +641,33 @@ gams::platforms::JavaPlatform::orient (const pose::Orientation & axes,
 int
 gams::platforms::JavaPlatform::sense (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::sense:" \
-      " Obtaining user-defined sense method\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "sense", "()I" );
-
-    if (call)
+    if (sense_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::sense:" \
         " Calling user-defined sense method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, sense_method_);
+    }
+    else if (class_)
+    {
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+         "gams::platforms::JavaPlatform::sense:" \
+        " ERROR: No sense() method found in %s\n", get_name ().c_str ());
     }
     else
     {
-      std::stringstream buffer;
-      if (class_)
-      {
-        madara_logger_ptr_log (gams::loggers::global_logger.get (),
-          gams::loggers::LOG_MINOR,
-           "gams::platforms::JavaPlatform::sense:" \
-          " Trying to acquire class name for error message\n");
-
-        jmethodID getName = jvm.env->GetMethodID(
-          class_, "getName", "()Ljava/lang/String;");
-        jstring name = (jstring) jvm.env->CallObjectMethod(class_, getName);
-        const char * name_chars = jvm.env->GetStringUTFChars(name, 0);
-
-        madara_logger_ptr_log (gams::loggers::global_logger.get (),
-          gams::loggers::LOG_ERROR,
-           "gams::platforms::JavaPlatform::sense:" \
-          " ERROR: No sense() method found in %s\n", name_chars);
-
-      }
-      else
-      {
-        madara_logger_ptr_log (gams::loggers::global_logger.get (),
-          gams::loggers::LOG_ERROR,
-           "gams::platforms::JavaPlatform::sense:" \
-          " ERROR: Unable to acquire class from object.\n");
-      }
-
-      knowledge_->print (buffer.str ());
+      madara_logger_ptr_log (gams::loggers::global_logger.get (),
+        gams::loggers::LOG_ERROR,
+         "gams::platforms::JavaPlatform::sense:" \
+        " ERROR: Unable to acquire class from object.\n");
     }
   }
   else
@@ -677,18 +683,11 @@ gams::platforms::JavaPlatform::sense (void)
 void
 gams::platforms::JavaPlatform::set_move_speed (const double & speed)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::set_move_speed:" \
-      " Obtaining user-defined setMoveSpeed method\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "setMoveSpeed", "(D)V" );
-
-    if (call)
+    if (set_move_speed_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
@@ -696,7 +695,7 @@ gams::platforms::JavaPlatform::set_move_speed (const double & speed)
         " Calling user-defined setMoveSpeed method.\n");
 
       jdouble jspeed (speed);
-      jvm.env->CallVoidMethod (obj_, call, jspeed);
+      jvm.env->CallVoidMethod (obj_, set_move_speed_method_, jspeed);
     }
     else
     {
@@ -718,26 +717,19 @@ gams::platforms::JavaPlatform::set_move_speed (const double & speed)
 int
 gams::platforms::JavaPlatform::takeoff (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jint result (0);
 
   if (jvm.env)
   {
-    madara_logger_ptr_log (gams::loggers::global_logger.get (),
-      gams::loggers::LOG_MAJOR,
-       "gams::platforms::JavaPlatform::takeoff:" \
-      " Obtaining user-defined takeoff method\n");
-
-    jmethodID call = jvm.env->GetMethodID(class_, "takeoff", "()I" );
-
-    if (call)
+    if (takeoff_method_)
     {
       madara_logger_ptr_log (gams::loggers::global_logger.get (),
         gams::loggers::LOG_MAJOR,
          "gams::platforms::JavaPlatform::takeoff:" \
         " Calling user-defined takeoff method.\n");
 
-      result = jvm.env->CallIntMethod (obj_, call);
+      result = jvm.env->CallIntMethod (obj_, takeoff_method_);
     }
     else
     {
@@ -761,7 +753,7 @@ gams::platforms::JavaPlatform::takeoff (void)
 jobject
 gams::platforms::JavaPlatform::get_java_instance (void)
 {
-  gams::utility::java::Acquire_VM jvm;
+  gams::utility::java::Acquire_VM jvm (false);
   jobject result (0);
 
   if (jvm.env)
@@ -777,7 +769,7 @@ gams::platforms::JavaPlatform::get_java_instance (void)
   {
     madara_logger_ptr_log (gams::loggers::global_logger.get (),
       gams::loggers::LOG_ERROR,
-      "gams::platforms::JavaPlatform::analyze:" \
+      "gams::platforms::JavaPlatform::get_java_instance:" \
       " ERROR: Unable to obtain JVM environment.\n");
   }
 
@@ -192,11 +192,79 @@ namespace gams
       jobject get_java_instance (void);
 
     protected:
+      /**
+       * Resolves the method IDs of class_ and the pose classes. Method IDs
+       * stay valid while the classes are loaded, which the global
+       * references guarantee, so this is done once rather than per call.
+       * @param  env   Java environment
+       **/
+      void resolve_methods (JNIEnv * env);
+
+      /**
+       * Deletes the global references to the pose classes
+       * @param  env   Java environment
+       **/
+      void release_classes (JNIEnv * env);
+
       /// the Java object with callable methods
       jobject obj_;
 
       /// the class of the Java object obj_
       jclass class_;
+
+      /// ai.gams.utility.Position, used to pass positions to move
+      jclass position_class_;
+
+      /// ai.gams.utility.Axes, used to pass orientations to rotate
+      jclass axes_class_;
+
+      /// Position (double, double, double)
+      jmethodID position_init_;
+
+      /// Position.free
+      jmethodID position_free_;
+
+      /// Axes (double, double, double)
+      jmethodID axes_init_;
+
+      /// Axes.free
+      jmethodID axes_free_;
+
+      /// obj_.analyze
+      jmethodID analyze_method_;
+
+      /// obj_.getAccuracy
+      jmethodID get_accuracy_method_;
+
+      /// obj_.getId
+      jmethodID get_id_method_;
+
+      /// obj_.getMoveSpeed
+      jmethodID get_move_speed_method_;
+
+      /// obj_.getName
+      jmethodID get_name_method_;
+
+      /// obj_.home
+      jmethodID home_method_;
+
+      /// obj_.land
+      jmethodID land_method_;
+
+      /// obj_.move
+      jmethodID move_method_;
+
+      /// obj_.rotate
+      jmethodID rotate_method_;
+
+      /// obj_.sense
+      jmethodID sense_method_;
+
+      /// obj_.setMoveSpeed
+      jmethodID set_move_speed_method_;
+
+      /// obj_.takeoff
+      jmethodID takeoff_method_;
     };
   }
 }
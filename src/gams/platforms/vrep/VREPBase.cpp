@@ -137,6 +137,15 @@ gams::platforms::VREPBase::VREPBase (
     }
     (*sensors_)["coverage"] = (*sensors)["coverage"];
 
+    // optionally batch coverage marks into one record per period
+    double coverage_sync_hz =
+      knowledge->get (".vrep_coverage_sync_hz").to_double ();
+    if (coverage_sync_hz > 0)
+    {
+      (*sensors_)["coverage"]->enable_sync (self->id.to_string (),
+        1.0 / coverage_sync_hz, 1.0, variables::Sensor::MERGE_MAX);
+    }
+
     // get client id
     string vrep_host = knowledge->get (".vrep_host").to_string ();
     int vrep_port = knowledge->get (".vrep_port").to_integer ();
@@ -329,6 +338,7 @@ gams::platforms::VREPBase::analyze (void)
     pose::Position pos = get_location ();
     (*sensors_)["coverage"]->set_value (
       pos, knowledge_->get_context ().get_clock ());
+    (*sensors_)["coverage"]->sync ();
   }
   else
   {
@@ -89,10 +89,6 @@ namespace gams { namespace pose {
           double lat, lon, alt;
           conv.ned2Geodetic(x, y, z, &lat, &lon, &alt);
 
-          std::cerr << ox << " " << oy << " " << oz << " :: " <<
-                       x << " " << y << " " << z << " -> " <<
-                       lat << " " << lon << " " << alt << std::endl;
-
           x = lat;
           y = lon;
           z = alt;
@@ -144,10 +140,6 @@ namespace gams { namespace pose {
           double north, east, down;
           conv.geodetic2Ned(x, y, z, &north, &east, &down);
 
-          std::cerr << ox << " " << oy << " " << oz << " :: " <<
-                       x << " " << y << " " << z << " -> " <<
-                       north << " " << east << " " << down << std::endl;
-
           x = north;
           y = east;
           z = down;
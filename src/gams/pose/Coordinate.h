@@ -1029,8 +1029,8 @@ inline bool operator < (
     const Framed<BasicVector<LDerived, Units>> &lhs,
     const Framed<BasicVector<RDerived, Units>> &rhs)
 {
-  return &lhs.frame() < &rhs.frame() || (lhs.frame() == rhs.frame() &&
-    static_cast<const BasicVector<LDerived, Units> &>(lhs) ==
+  return lhs.frame() < rhs.frame() || (lhs.frame() == rhs.frame() &&
+    static_cast<const BasicVector<LDerived, Units> &>(lhs) <
     static_cast<const BasicVector<RDerived, Units> &>(rhs));
 }
 
@@ -731,8 +731,19 @@ namespace gams
         if(rx == 0 && ry == 0 && rz == 0)
           return;
 
+        orient_linear_vec(x, y, z, Quaternion(rx, ry, rz), reverse);
+      }
+
+      void orient_linear_vec(
+            double &x, double &y, double &z,
+            const Quaternion &rot,
+            bool reverse)
+      {
+        if(rot.x() == 0 && rot.y() == 0 && rot.z() == 0)
+          return;
+
         Quaternion locq(x, y, z, 0);
-        Quaternion rotq(rx, ry, rz);
+        Quaternion rotq(rot);
 
         if(reverse)
           rotq.conjugate();
@@ -746,9 +757,15 @@ namespace gams
                         const ReferenceFrameType *,
                         double orx, double ory, double orz,
                         double &rx, double &ry, double &rz)
+      {
+        transform_angular_to_origin(Quaternion(orx, ory, orz), rx, ry, rz);
+      }
+
+      void transform_angular_to_origin(
+                        const Quaternion &origin_quat,
+                        double &rx, double &ry, double &rz)
       {
         Quaternion in_quat(rx, ry, rz);
-        Quaternion origin_quat(orx, ory, orz);
         in_quat *= origin_quat;
         in_quat.to_angular_vector(rx, ry, rz);
       }
@@ -758,11 +775,16 @@ namespace gams
                         const ReferenceFrameType *,
                         double orx, double ory, double orz,
                         double &rx, double &ry, double &rz)
+      {
+        transform_angular_from_origin(Quaternion(orx, ory, orz), rx, ry, rz);
+      }
+
+      void transform_angular_from_origin(
+                        const Quaternion &origin_quat,
+                        double &rx, double &ry, double &rz)
       {
         Quaternion in_quat(rx, ry, rz);
-        Quaternion origin_quat(orx, ory, orz);
-        origin_quat.conjugate();
-        in_quat *= origin_quat;
+        in_quat *= -origin_quat;
         in_quat.to_angular_vector(rx, ry, rz);
       }
 
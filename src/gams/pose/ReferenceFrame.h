@@ -292,6 +292,13 @@ private:
   Pose origin_;
   mutable bool interpolated_ = false;
 
+  /// unit quaternion of origin_'s orientation, reused by transforms.
+  /// Written only at construction.
+  Quaternion origin_quat_;
+
+  /// the orientation of origin_ that origin_quat_ was computed from
+  double origin_quat_rx_, origin_quat_ry_, origin_quat_rz_;
+
 private:
   template<typename T>
   static uint64_t init_timestamp(uint64_t given, const T &p)
@@ -411,7 +418,11 @@ public:
     : ident_(std::move(ident)),
       type_(type),
       timestamp_(init_timestamp(timestamp, origin)),
-      origin_(std::forward<P>(origin)) {}
+      origin_(std::forward<P>(origin)),
+      origin_quat_(origin_.rx(), origin_.ry(), origin_.rz()),
+      origin_quat_rx_(origin_.rx()),
+      origin_quat_ry_(origin_.ry()),
+      origin_quat_rz_(origin_.rz()) {}
 
   /**
    * Get the ReferenceFrameIdentity object associated with this frame,
@@ -455,6 +466,28 @@ public:
     return origin_;
   }
 
+  /**
+   * Gets the orientation of this frame's origin as a unit quaternion.
+   * Computed once at construction, so transforms through this frame
+   * need not convert the origin's axis-angle representation every time.
+   *
+   * If the origin's orientation has been changed since construction, by
+   * any write through mut_origin(), a freshly converted quaternion is
+   * returned instead. The cached value is never written after
+   * construction, so this is as thread-safe as origin(): concurrent
+   * calls are safe, but not concurrently with writes through mut_origin().
+   *
+   * @return the quaternion equivalent of origin()'s orientation
+   **/
+  Quaternion origin_quat() const {
+    if (origin_.rx() == origin_quat_rx_ &&
+        origin_.ry() == origin_quat_ry_ &&
+        origin_.rz() == origin_quat_rz_) {
+      return origin_quat_;
+    }
+    return Quaternion(origin_.rx(), origin_.ry(), origin_.rz());
+  }
+
   /**
    * Creates a new ReferenceFrame with modified origin
    *
@@ -1206,6 +1239,47 @@ namespace simple_rotate {
       double rx, double ry, double rz,
       bool reverse = false);
 
+  /**
+   * Rotates a LinearVector according to an already converted Quaternion.
+   * Avoids the trigonometry of converting from axis-angle notation.
+   *
+   * @param x   the x coordinate to orient (in-place)
+   * @param y   the y coordinate to orient (in-place)
+   * @param z   the z coordinate to orient (in-place)
+   * @param rot the angular to apply, as a unit quaternion
+   * @param reverse if true, apply angular in opposite direction
+   **/
+  void orient_linear_vec(
+      double &x, double &y, double &z,
+      const Quaternion &rot,
+      bool reverse = false);
+
+  /**
+   * Transform AngularVector in-place into its origin frame from this frame,
+   * given the origin's orientation as a unit quaternion.
+   *
+   * @param origin_quat the orientation of the frame's origin
+   * @param rx  the x component of the axis-angle representation
+   * @param ry  the y component of the axis-angle representation
+   * @param rz  the z component of the axis-angle representation
+   **/
+  void transform_angular_to_origin(
+                  const Quaternion &origin_quat,
+                  double &rx, double &ry, double &rz);
+
+  /**
+   * Transform AngularVector in-place from its origin frame,
+   * given the origin's orientation as a unit quaternion.
+   *
+   * @param origin_quat the orientation of the frame's origin
+   * @param rx  the x component of the axis-angle representation
+   * @param ry  the y component of the axis-angle representation
+   * @param rz  the z component of the axis-angle representation
+   **/
+  void transform_angular_from_origin(
+                  const Quaternion &origin_quat,
+                  double &rx, double &ry, double &rz);
+
   /**
    * Transform AngularVector in-place into its origin frame from this frame
    *
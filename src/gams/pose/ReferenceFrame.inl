@@ -67,19 +67,163 @@ namespace gams { namespace pose {
 /// Implementation details
 namespace impl
 {
+  /**
+   * True if a Cartesian child of a Cartesian parent; such transforms
+   * can use the cached origin quaternion of the child frame directly.
+   **/
+  inline bool is_cartesian_pair(
+      const ReferenceFrameType *self, const ReferenceFrameType *origin)
+  {
+    return self->type_id == Cartesian->type_id &&
+           origin->type_id == Cartesian->type_id;
+  }
+
+  inline void linear_to_origin(
+      const ReferenceFrameType *s,
+      const ReferenceFrameType *o,
+      const ReferenceFrame &frame,
+      double &x, double &y, double &z,
+      bool fixed)
+  {
+    const Pose &origin = frame.origin();
+    if (is_cartesian_pair(s, o)) {
+      simple_rotate::orient_linear_vec(x, y, z, frame.origin_quat());
+
+      if (fixed) {
+        x += origin.x();
+        y += origin.y();
+        z += origin.z();
+      }
+    } else {
+      s->transform_linear_to_origin(o, s,
+          origin.x(), origin.y(), origin.z(),
+          origin.rx(), origin.ry(), origin.rz(),
+          x, y, z, fixed);
+    }
+  }
+
+  inline void angular_to_origin(
+      const ReferenceFrameType *s,
+      const ReferenceFrameType *o,
+      const ReferenceFrame &frame,
+      double &rx, double &ry, double &rz)
+  {
+    if (s->transform_angular_to_origin ==
+          static_cast<decltype(s->transform_angular_to_origin)>(
+            &simple_rotate::transform_angular_to_origin)) {
+      simple_rotate::transform_angular_to_origin(
+          frame.origin_quat(), rx, ry, rz);
+    } else {
+      const Pose &origin = frame.origin();
+      s->transform_angular_to_origin(o, s,
+          origin.rx(), origin.ry(), origin.rz(),
+          rx, ry, rz);
+    }
+  }
+
+  inline void linear_from_origin(
+      const ReferenceFrameType *f,
+      const ReferenceFrameType *t,
+      const ReferenceFrame &to_frame,
+      double &x, double &y, double &z,
+      bool fixed)
+  {
+    const Pose &to = to_frame.origin();
+    if (is_cartesian_pair(t, f)) {
+      simple_rotate::orient_linear_vec(x, y, z, to_frame.origin_quat(), true);
+
+      if (fixed) {
+        x -= to.x();
+        y -= to.y();
+        z -= to.z();
+      }
+    } else {
+      t->transform_linear_from_origin(f, t,
+          to.x(), to.y(), to.z(),
+          to.rx(), to.ry(), to.rz(),
+          x, y, z, fixed);
+    }
+  }
+
+  inline void angular_from_origin(
+      const ReferenceFrameType *f,
+      const ReferenceFrameType *t,
+      const ReferenceFrame &to_frame,
+      double &rx, double &ry, double &rz)
+  {
+    if (t->transform_angular_from_origin ==
+          static_cast<decltype(t->transform_angular_from_origin)>(
+            &simple_rotate::transform_angular_from_origin)) {
+      simple_rotate::transform_angular_from_origin(
+          to_frame.origin_quat(), rx, ry, rz);
+    } else {
+      const Pose &to = to_frame.origin();
+      t->transform_angular_from_origin(f, t,
+          to.rx(), to.ry(), to.rz(),
+          rx, ry, rz);
+    }
+  }
+
+  template<class C>
+  inline void pose_to_origin(
+      const ReferenceFrameType *s,
+      const ReferenceFrameType *o,
+      const ReferenceFrame &frame,
+      C &in)
+  {
+    if (s->transform_pose_to_origin ==
+          &simple_rotate::transform_pose_to_origin) {
+      linear_to_origin(s, o, frame,
+          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2], true);
+      angular_to_origin(s, o, frame,
+          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2]);
+    } else {
+      const Pose &origin = frame.origin();
+      s->transform_pose_to_origin(o, s,
+          origin.x(), origin.y(), origin.z(),
+          origin.rx(), origin.ry(), origin.rz(),
+          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2],
+          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2],
+          true);
+    }
+  }
+
+  template<class C>
+  inline void pose_from_origin(
+      const ReferenceFrameType *f,
+      const ReferenceFrameType *t,
+      const ReferenceFrame &to_frame,
+      C &in)
+  {
+    if (t->transform_pose_from_origin ==
+          &simple_rotate::transform_pose_from_origin) {
+      linear_from_origin(f, t, to_frame,
+          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2], true);
+      angular_from_origin(f, t, to_frame,
+          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2]);
+    } else {
+      const Pose &to = to_frame.origin();
+      t->transform_pose_from_origin(f, t,
+          to.x(), to.y(), to.z(),
+          to.rx(), to.ry(), to.rz(),
+          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2],
+          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2],
+          true);
+    }
+  }
+
   template<class C, class Func>
   inline void to_origin(C &in, Func func) {
     ReferenceFrame self_frame = in.frame();
     if (!self_frame.valid()) {
       return;
     }
-    const Pose &origin = self_frame.origin();
-    ReferenceFrame origin_frame = origin.frame();
+    ReferenceFrame origin_frame = self_frame.origin().frame();
     if (origin_frame.valid() && self_frame != origin_frame) {
       const ReferenceFrameType *s = self_frame.type();
       const ReferenceFrameType *o = origin_frame.type();
       //std::cerr << "Transform from " << in.frame().id() << " to " << in.frame().origin_frame().id() << std::endl;
-      func(s, o, origin, in);
+      func(s, o, self_frame, in);
     }
   }
 }
@@ -91,11 +235,9 @@ inline auto transform_to_origin(T &in) ->
   impl::to_origin(in, [](
           const ReferenceFrameType *s,
           const ReferenceFrameType *o,
-          const Pose &origin,
+          const ReferenceFrame &frame,
           T &in) {
-      s->transform_linear_to_origin(o, s,
-          origin.x(), origin.y(), origin.z(),
-          origin.rx(), origin.ry(), origin.rz(),
+      impl::linear_to_origin(s, o, frame,
           in.vec()[0], in.vec()[1], in.vec()[2],
           T::fixed());
     });
@@ -108,72 +250,21 @@ inline auto transform_to_origin(T &in) ->
   impl::to_origin(in, [](
           const ReferenceFrameType *s,
           const ReferenceFrameType *o,
-          const Pose &origin,
+          const ReferenceFrame &frame,
           T &in) {
-      s->transform_angular_to_origin(o, s,
-          origin.rx(), origin.ry(), origin.rz(),
+      impl::angular_to_origin(s, o, frame,
           in.vec()[0], in.vec()[1], in.vec()[2]);
     });
 }
 
 inline void transform_to_origin(Pose &in)
 {
-  impl::to_origin(in, [](
-          const ReferenceFrameType *s,
-          const ReferenceFrameType *o,
-          const Pose &origin,
-          Pose &in) {
-      s->transform_pose_to_origin(o, s,
-          origin.x(), origin.y(), origin.z(),
-          origin.rx(), origin.ry(), origin.rz(),
-          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2],
-          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2],
-          true);
-    });
-}
-
-/*
-inline void transform_to_origin(StampedPosition &in)
-{
-  impl::to_origin(in, [](
-          const ReferenceFrameType *s,
-          const ReferenceFrameType *o,
-          const Pose &origin,
-          StampedPosition &in) {
-      s->transform_linear_to_origin(o, s,
-          origin.x(), origin.y(), origin.z(),
-          origin.rx(), origin.ry(), origin.rz(),
-          in.vec()[0], in.vec()[1], in.vec()[2]);
-    });
+  impl::to_origin(in, impl::pose_to_origin<Pose>);
 }
 
-inline void transform_to_origin(StampedOrientation &in)
-{
-  impl::to_origin(in, [](
-          const ReferenceFrameType *s,
-          const ReferenceFrameType *o,
-          const Pose &origin,
-          StampedOrientation &in) {
-      s->transform_angular_to_origin(o, s,
-          origin.rx(), origin.ry(), origin.rz(),
-          in.vec()[0], in.vec()[1], in.vec()[2]);
-    });
-}*/
-
 inline void transform_to_origin(StampedPose &in)
 {
-  impl::to_origin(in, [](
-          const ReferenceFrameType *s,
-          const ReferenceFrameType *o,
-          const Pose &origin,
-          StampedPose &in) {
-      s->transform_pose_to_origin(o, s,
-          origin.x(), origin.y(), origin.z(),
-          origin.rx(), origin.ry(), origin.rz(),
-          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2],
-          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2],
-          true);
-    });
+  impl::to_origin(in, impl::pose_to_origin<StampedPose>);
 }
 
 namespace impl
@@ -186,10 +277,9 @@ namespace impl
     }
     if (from_frame.valid() && from_frame != to_frame) {
       //std::cerr << "Transform from " << in.frame().id() << " to " << to_frame.id() << std::endl;
-      const Pose &to = to_frame.origin();
       const ReferenceFrameType *t = to_frame.type();
       const ReferenceFrameType *f = from_frame.type();
-      func(f, t, to, in);
+      func(f, t, to_frame, in);
     }
   }
 }
@@ -199,13 +289,11 @@ inline auto transform_from_origin(T &in, const ReferenceFrame &to_frame) ->
   typename std::enable_if<T::positional()>::type
 {
   impl::from_origin(in, to_frame, [](
-          const ReferenceFrameType *t,
           const ReferenceFrameType *f,
-          const Pose &to,
+          const ReferenceFrameType *t,
+          const ReferenceFrame &to_frame,
           T &in) {
-      f->transform_linear_from_origin(t, f,
-          to.x(), to.y(), to.z(),
-          to.rx(), to.ry(), to.rz(),
+      impl::linear_from_origin(f, t, to_frame,
           in.vec()[0], in.vec()[1], in.vec()[2],
           T::fixed());
     });
@@ -217,12 +305,11 @@ inline auto transform_from_origin(T &in, const ReferenceFrame &to_frame) ->
   typename std::enable_if<T::rotational()>::type
 {
   impl::from_origin(in, to_frame, [](
-          const ReferenceFrameType *t,
           const ReferenceFrameType *f,
-          const Pose &to,
+          const ReferenceFrameType *t,
+          const ReferenceFrame &to_frame,
           T &in) {
-      f->transform_angular_from_origin(t, f,
-          to.rx(), to.ry(), to.rz(),
+      impl::angular_from_origin(f, t, to_frame,
           in.vec()[0], in.vec()[1], in.vec()[2]);
     });
 }
@@ -230,67 +317,13 @@ inline auto transform_from_origin(T &in, const ReferenceFrame &to_frame) ->
 inline void transform_from_origin(
   Pose &in, const ReferenceFrame &to_frame)
 {
-  impl::from_origin(in, to_frame, [](
-          const ReferenceFrameType *t,
-          const ReferenceFrameType *f,
-          const Pose &to,
-          Pose &in) {
-      f->transform_pose_from_origin(t, f,
-          to.x(), to.y(), to.z(),
-          to.rx(), to.ry(), to.rz(),
-          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2],
-          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2],
-          true);
-    });
-}
-
-/*
-inline void transform_from_origin(
-    StampedPosition &in, const ReferenceFrame &to_frame)
-{
-  impl::from_origin(in, to_frame, [](
-          const ReferenceFrameType *t,
-          const ReferenceFrameType *f,
-          const Pose &to,
-          StampedPosition &in) {
-      f->transform_linear_from_origin(t, f,
-          to.x(), to.y(), to.z(),
-          to.rx(), to.ry(), to.rz(),
-          in.vec()[0], in.vec()[1], in.vec()[2]);
-    });
-}
-
-
-inline void transform_from_origin(
-    StampedOrientation &in, const ReferenceFrame &to_frame)
-{
-  impl::from_origin(in, to_frame, [](
-          const ReferenceFrameType *t,
-          const ReferenceFrameType *f,
-          const Pose &to,
-          StampedOrientation &in) {
-      f->transform_angular_from_origin(t, f,
-          to.rx(), to.ry(), to.rz(),
-          in.vec()[0], in.vec()[1], in.vec()[2]);
-    });
+  impl::from_origin(in, to_frame, impl::pose_from_origin<Pose>);
 }
-*/
 
 inline void transform_from_origin(
   StampedPose &in, const ReferenceFrame &to_frame)
 {
-  impl::from_origin(in, to_frame, [](
-          const ReferenceFrameType *t,
-          const ReferenceFrameType *f,
-          const Pose &to,
-          StampedPose &in) {
-      f->transform_pose_from_origin(t, f,
-          to.x(), to.y(), to.z(),
-          to.rx(), to.ry(), to.rz(),
-          in.pos_vec()[0], in.pos_vec()[1], in.pos_vec()[2],
-          in.ori_vec()[0], in.ori_vec()[1], in.ori_vec()[2],
-          true);
-    });
+  impl::from_origin(in, to_frame, impl::pose_from_origin<StampedPose>);
 }
 
 inline double difference(
@@ -643,6 +676,10 @@ inline const Pose &ReferenceFrame::origin() const {
   return impl_->origin();
 }
 
+inline Quaternion ReferenceFrame::origin_quat() const {
+  return impl_->origin_quat();
+}
+
 inline ReferenceFrame ReferenceFrame::pose(
     const Pose &new_origin) const {
   return impl_->pose(new_origin);
@@ -68,6 +68,7 @@ struct ReferenceFrameType;
 class Pose;
 class Position;
 class Orientation;
+class Quaternion;
 class ReferenceFrame;
 
 MADARA_MAKE_VAL_SUPPORT_TEST(transform_to, x,
@@ -283,6 +284,17 @@ public:
    **/
   const Pose &origin() const;
 
+  /**
+   * Gets the orientation of this Frame's origin as a unit quaternion.
+   * The quaternion is cached by the frame, so repeated transforms
+   * through it avoid re-deriving it from the axis-angle origin. The
+   * cache is checked against the origin's current orientation, so it
+   * is never stale.
+   *
+   * @return the quaternion of origin()'s orientation
+   **/
+  Quaternion origin_quat() const;
+
   /**
    * Creates a new ReferenceFrame with modified origin
    *
@@ -51,6 +51,8 @@
  * This file contains a utility class for working with regions
  **/
 
+#include <algorithm>
+#include <array>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -69,6 +71,77 @@ using std::vector;
 
 typedef  madara::knowledge::KnowledgeRecord::Integer Integer;
 
+/**
+ * Precompiled form of a Region's polygon for fast point-in-polygon tests.
+ *
+ * The polygon is cut into slabs at each distinct vertex longitude. Each
+ * slab lists only the edges spanning it, with their slopes precomputed,
+ * so a query binary searches its slab and tests just those edges, instead
+ * of every edge. This gives the same crossings as the pnpoly loop it
+ * replaces. Vertices are kept sorted for the on-vertex test.
+ *
+ * Typical regions have O(V) total slab entries; pathological ones
+ * (e.g., combs) can have up to O(V^2).
+ *
+ * vertices is public and may be edited in place, so the index keeps the
+ * coordinates it was built from and is rebuilt when any of them differ.
+ * Comparing them is a linear scan, but far cheaper than a rebuild or the
+ * pnpoly loop's branches.
+ **/
+struct gams::pose::Region::ContainsIndex
+{
+  /// an edge of the polygon, as a line in lat/lng space
+  struct Edge
+  {
+    double lng;
+    double lat;
+    double slope;
+  };
+
+  /**
+   * Checks if the index was built from these vertices
+   * @param vertices  the region's current vertices
+   * @return true if every vertex matches the one it was built from
+   **/
+  bool matches (const std::vector<gams::pose::Position> & vertices) const
+  {
+    if (source.size () != vertices.size ())
+    {
+      return false;
+    }
+
+    for (size_t i = 0; i < source.size (); ++i)
+    {
+      if (source[i][0] != vertices[i].longitude () ||
+          source[i][1] != vertices[i].latitude () ||
+          source[i][2] != vertices[i].z ())
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// (lng, lat, alt) of each vertex when built, in order
+  std::vector<std::array<double, 3>> source;
+
+  /// bounding box of the vertices when built
+  double min_lat, max_lat, min_lng, max_lng;
+
+  /// sorted, distinct vertex longitudes bounding each slab
+  std::vector<double> slab_lngs;
+
+  /// edges of slab k are edges[slab_offsets[k]] to edges[slab_offsets[k+1]]
+  std::vector<size_t> slab_offsets;
+
+  /// edges, grouped by slab
+  std::vector<Edge> edges;
+
+  /// (lng, lat, alt) of each vertex in the GPS frame, sorted
+  std::vector<std::array<double, 3>> gps_vertices;
+};
+
 gams::pose::Region::Region (
   const std::vector <Position> & init_vertices, unsigned int type, 
   const std::string& name) :
@@ -147,27 +220,75 @@ gams::pose::Region::contains (const Position & pos) const
     return false;
   }
 
+  std::shared_ptr<const ContainsIndex> index = get_contains_index ();
+
+  if (pos.frame () == pose::gps_frame ())
+  {
+    return contains (*index, pos.latitude (), pos.longitude (), pos.z ());
+  }
+
   Position p(pose::gps_frame(), pos);
 
+  return contains (*index, p.latitude (), p.longitude (), p.z ());
+}
+
+std::vector<bool>
+gams::pose::Region::contains (const std::vector<Position> & positions) const
+{
+  std::vector<bool> ret (positions.size (), false);
+
+  if(vertices.size() < 1)
+  {
+    return ret;
+  }
+
+  std::shared_ptr<const ContainsIndex> index = get_contains_index ();
+  const ReferenceFrame & gps = pose::gps_frame ();
+
+  for (size_t i = 0; i < positions.size (); ++i)
+  {
+    const Position & pos = positions[i];
+    if (pos.frame () == gps)
+    {
+      ret[i] = contains (*index, pos.latitude (), pos.longitude (), pos.z ());
+    }
+    else
+    {
+      Position p(gps, pos);
+      ret[i] = contains (*index, p.latitude (), p.longitude (), p.z ());
+    }
+  }
+
+  return ret;
+}
+
+bool
+gams::pose::Region::contains (const ContainsIndex & index,
+  double lat, double lng, double alt) const
+{
   // check if in bounding box
-  if (p.latitude () < min_lat_ || p.latitude () > max_lat_ ||
-      p.longitude () < min_lon_ || p.longitude () > max_lon_)
+  if (lat < index.min_lat || lat > index.max_lat ||
+      lng < index.min_lng || lng > index.max_lng)
   {
     return false;
   }
 
-  // check if point in polygon code from 
+  // check if point in polygon, after pnpoly from
   // http://www.ecse.rpi.edu/Homepages/wrf/Research/ShortNotes/pnpoly.html
-  size_t i, j;
+  // but only over the edges spanning this point's slab
   bool ret = false;
-  for (i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+  std::vector<double>::const_iterator slab = std::upper_bound (
+    index.slab_lngs.begin (), index.slab_lngs.end (), lng);
+
+  if (slab != index.slab_lngs.begin ())
   {
-    if ( (vertices[i].longitude () > p.longitude ()) !=
-        (vertices[j].longitude () > p.longitude ()))
+    size_t k = (slab - index.slab_lngs.begin ()) - 1;
+
+    for (size_t e = index.slab_offsets[k];
+         e < index.slab_offsets[k + 1]; ++e)
     {
-      if (p.latitude () < (vertices[j].latitude () - vertices[i].latitude ()) * (p.longitude () - vertices[i].longitude ()) / 
-                (vertices[j].longitude () - vertices[i].longitude ()) + 
-                 vertices[i].latitude ())
+      const ContainsIndex::Edge & edge = index.edges[e];
+      if (lat < edge.slope * (lng - edge.lng) + edge.lat)
       {
         ret = !ret;
       }
@@ -177,8 +298,9 @@ gams::pose::Region::contains (const Position & pos) const
   // check if this is a vertex point
   if (!ret)
   {
-    for (unsigned int i = 0; i < vertices.size() && !ret; ++i)
-      ret = (vertices[i] == p);
+    const std::array<double, 3> point = {{lng, lat, alt}};
+    ret = std::binary_search (
+      index.gps_vertices.begin (), index.gps_vertices.end (), point);
   }
 
   // TODO: add check for border point
@@ -186,6 +308,122 @@ gams::pose::Region::contains (const Position & pos) const
   return ret;
 }
 
+std::shared_ptr<const gams::pose::Region::ContainsIndex>
+gams::pose::Region::get_contains_index () const
+{
+  std::shared_ptr<const ContainsIndex> index =
+    std::atomic_load (&contains_index_);
+
+  if (index && index->matches (vertices))
+  {
+    return index;
+  }
+
+  std::shared_ptr<ContainsIndex> built = std::make_shared<ContainsIndex> ();
+  const size_t num = vertices.size ();
+
+  built->source.reserve (num);
+  built->min_lat = built->min_lng = DBL_MAX;
+  built->max_lat = built->max_lng = -DBL_MAX;
+  for (size_t i = 0; i < num; ++i)
+  {
+    const double lng = vertices[i].longitude ();
+    const double lat = vertices[i].latitude ();
+    built->source.push_back (std::array<double, 3> {{
+      lng, lat, vertices[i].z ()}});
+
+    built->min_lat = std::min (built->min_lat, lat);
+    built->max_lat = std::max (built->max_lat, lat);
+    built->min_lng = std::min (built->min_lng, lng);
+    built->max_lng = std::max (built->max_lng, lng);
+  }
+
+  // slab boundaries are the distinct vertex longitudes
+  std::vector<double> & lngs = built->slab_lngs;
+  lngs.reserve (num);
+  for (size_t i = 0; i < num; ++i)
+  {
+    lngs.push_back (vertices[i].longitude ());
+  }
+  std::sort (lngs.begin (), lngs.end ());
+  lngs.erase (std::unique (lngs.begin (), lngs.end ()), lngs.end ());
+
+  // an edge spans slab k if its lower longitude <= lngs[k] < its upper
+  // longitude, matching pnpoly's (lng_i > p) != (lng_j > p) test
+  std::vector<size_t> & offsets = built->slab_offsets;
+  offsets.assign (lngs.size () + 1, 0);
+
+  // first pass counts edges per slab, second pass fills them in
+  std::vector<size_t> cursor;
+  for (size_t pass = 0; pass < 2; ++pass)
+  {
+
+    for (size_t i = 0, j = num - 1; i < num; j = i++)
+    {
+      double lng_i = vertices[i].longitude ();
+      double lng_j = vertices[j].longitude ();
+      if (lng_i == lng_j)
+      {
+        continue;
+      }
+
+      size_t first = std::lower_bound (lngs.begin (), lngs.end (),
+        std::min (lng_i, lng_j)) - lngs.begin ();
+      size_t last = std::lower_bound (lngs.begin (), lngs.end (),
+        std::max (lng_i, lng_j)) - lngs.begin ();
+
+      for (size_t k = first; k < last; ++k)
+      {
+        if (pass == 0)
+        {
+          ++offsets[k + 1];
+        }
+        else
+        {
+          ContainsIndex::Edge & edge = built->edges[cursor[k]++];
+          edge.lng = lng_i;
+          edge.lat = vertices[i].latitude ();
+          edge.slope = (vertices[j].latitude () - vertices[i].latitude ()) /
+            (lng_j - lng_i);
+        }
+      }
+    }
+
+    if (pass == 0)
+    {
+      for (size_t k = 1; k < offsets.size (); ++k)
+      {
+        offsets[k] += offsets[k - 1];
+      }
+      built->edges.resize (offsets.back ());
+      cursor.assign (offsets.begin (), offsets.end () - 1);
+    }
+  }
+
+  // only vertices in the GPS frame can equal a GPS query point
+  const ReferenceFrame & gps = pose::gps_frame ();
+  for (size_t i = 0; i < num; ++i)
+  {
+    if (vertices[i].frame () == gps)
+    {
+      built->gps_vertices.push_back (std::array<double, 3> {{
+        vertices[i].longitude (), vertices[i].latitude (), vertices[i].z ()}});
+    }
+  }
+  std::sort (built->gps_vertices.begin (), built->gps_vertices.end ());
+
+  index = built;
+  std::atomic_store (&contains_index_, index);
+
+  return index;
+}
+
+void
+gams::pose::Region::refresh (void)
+{
+  calculate_bounding_box ();
+}
+
 double
 gams::pose::Region::distance (const Position& p) const
 {
@@ -317,6 +555,11 @@ gams::pose::Region::calculate_bounding_box ()
   max_lat_ = -DBL_MAX;
   max_lon_ = -DBL_MAX;
   max_alt_ = -DBL_MAX;
+
+  // vertices have changed, so the contains index must be rebuilt
+  std::atomic_store (&contains_index_,
+    std::shared_ptr<const ContainsIndex> ());
+
   for (unsigned int i = 0; i < vertices.size(); ++i)
   {
     min_lat_ = (min_lat_ > vertices[i].latitude ()) ?
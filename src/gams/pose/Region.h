@@ -56,6 +56,7 @@
 #ifndef  _GAMS_UTILITY_REGION_H_
 #define  _GAMS_UTILITY_REGION_H_
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -130,6 +131,23 @@ namespace gams
        **/
       bool contains (const Position & position) const;
 
+      /**
+       * Determines which of several positions are in region. Faster than
+       * calling contains on each position individually.
+       * @param   positions  points to check if in region
+       * @return  for each point, true if in region or on border
+       **/
+      std::vector<bool> contains (
+        const std::vector<Position> & positions) const;
+
+      /**
+       * Recomputes the bounding box and discards the cached contains index.
+       * contains notices vertex edits on its own, but call this after
+       * modifying vertices directly to update the bounding box used by
+       * get_bounding_box and distance.
+       **/
+      void refresh (void);
+
       /**
        * Gets distance from any point in this region
        * @param   position     point to check
@@ -174,6 +192,30 @@ namespace gams
       unsigned int type_;
 
     private:
+      /// precompiled polygon used by contains, see Region.cpp
+      struct ContainsIndex;
+
+      /**
+       * Gets the contains index, building it if vertices changed since
+       * it was last built
+       * @return the current index
+       **/
+      std::shared_ptr<const ContainsIndex> get_contains_index () const;
+
+      /**
+       * Tests a GPS point against a prebuilt index
+       * @param index   index for this region
+       * @param lat     latitude of the point
+       * @param lng     longitude of the point
+       * @param alt     altitude of the point
+       * @return true if in region or a vertex
+       **/
+      bool contains (const ContainsIndex & index,
+        double lat, double lng, double alt) const;
+
+      /// lazily built on first contains, shared between copies
+      mutable std::shared_ptr<const ContainsIndex> contains_index_;
+
       /**
        * Check if object is of correct type
        * @param kb        Knowledge Base with object
@@ -53,6 +53,7 @@
 
 #include "gams/pose/SearchArea.h"
 
+#include <array>
 #include <sstream>
 #include <string>
 #include <algorithm>
@@ -82,9 +83,86 @@ using std::vector;
 namespace mutility = madara::utility;
 typedef madara::knowledge::KnowledgeRecord::Integer Integer;
 
+/**
+ * Uniform grid over the bounding boxes of a SearchArea's regions.
+ *
+ * Each cell lists the regions whose bounding box overlaps it, sorted
+ * by descending priority, so a query only runs point-in-polygon tests
+ * on regions near the point, and get_priority can stop at the first
+ * region that contains it.
+ *
+ * Subclasses may replace or edit regions_ in place, so the index keeps
+ * the bounding box and priority of each region it was built from and is
+ * rebuilt when any of them differ. Regions pick up their own vertex edits,
+ * but their bounding boxes only change on Region::refresh.
+ **/
+struct gams::pose::SearchArea::RegionIndex
+{
+  /**
+   * Checks if the index was built from these regions
+   * @param current  the search area's current regions
+   * @return true if every region's bounds and priority match
+   **/
+  bool matches (const std::vector<PrioritizedRegion> & current) const
+  {
+    if (bounds.size () != current.size ())
+      return false;
+
+    for (size_t i = 0; i < bounds.size (); ++i)
+    {
+      const PrioritizedRegion & region = current[i];
+      if (priorities[i] != region.priority ||
+          empty[i] != region.vertices.empty () ||
+          bounds[i][0] != region.min_lat_ || bounds[i][1] != region.max_lat_ ||
+          bounds[i][2] != region.min_lon_ || bounds[i][3] != region.max_lon_)
+        return false;
+    }
+
+    return true;
+  }
+
+  /// (min_lat, max_lat, min_lon, max_lon) of each region when built
+  std::vector<std::array<double, 4>> bounds;
+
+  /// priority of each region when built
+  std::vector<Integer> priorities;
+
+  /// whether each region had no vertices when built
+  std::vector<bool> empty;
+
+  /// union of region bounding boxes
+  double min_lat, max_lat;
+  double min_lon, max_lon;
+
+  /// grid dimensions and cell size, in degrees
+  size_t cols, rows;
+  double cell_lon, cell_lat;
+
+  /// regions of cell c are regions[offsets[c]] to regions[offsets[c+1]]
+  std::vector<size_t> offsets;
+  std::vector<size_t> regions;
+
+  size_t col (double lng) const
+  {
+    if (cell_lon <= 0)
+      return 0;
+    double c = (lng - min_lon) / cell_lon;
+    return c <= 0 ? 0 : std::min ((size_t)c, cols - 1);
+  }
+
+  size_t row (double lat) const
+  {
+    if (cell_lat <= 0)
+      return 0;
+    double r = (lat - min_lat) / cell_lat;
+    return r <= 0 ? 0 : std::min ((size_t)r, rows - 1);
+  }
+};
+
 gams::pose::SearchArea::SearchArea () :
   Containerize()
 {
+  calculate_bounding_box ();
 }
 
 gams::pose::SearchArea::SearchArea (const PrioritizedRegion& region, 
@@ -145,6 +223,7 @@ gams::pose::SearchArea::operator= (const SearchArea & rhs)
     this->min_alt_ = rhs.min_alt_;
     this->max_alt_ = rhs.max_alt_;
     this->name_ = rhs.name_;
+    this->region_index_ = std::atomic_load (&rhs.region_index_);
   }
 }
 
@@ -152,6 +231,7 @@ void
 gams::pose::SearchArea::add_prioritized_region (const PrioritizedRegion& r)
 {
   regions_.push_back (r);
+  invalidate_region_index ();
 
   // modify bounding box
   min_lat_ = (min_lat_ > r.min_lat_) ? r.min_lat_ : min_lat_;
@@ -343,25 +423,157 @@ madara::knowledge::KnowledgeRecord::Integer
 gams::pose::SearchArea::get_priority (const Position& pos) const
 {
   madara::knowledge::KnowledgeRecord::Integer priority = 0;
-  for (vector<PrioritizedRegion>::const_iterator it = regions_.begin ();
-    it != regions_.end (); ++it)
+
+  if (regions_.empty ())
+    return priority;
+
+  const Position p (pose::gps_frame (), pos);
+  std::shared_ptr<const RegionIndex> index = get_region_index ();
+
+  if (p.latitude () < index->min_lat || p.latitude () > index->max_lat ||
+      p.longitude () < index->min_lon || p.longitude () > index->max_lon)
+    return priority;
+
+  size_t cell = index->row (p.latitude ()) * index->cols +
+    index->col (p.longitude ());
+
+  // candidates are sorted by descending priority, so first match is max
+  for (size_t i = index->offsets[cell]; i < index->offsets[cell + 1]; ++i)
   {
-    if (it->contains (pos))
-      priority = max (priority, it->priority);
+    const PrioritizedRegion & region = regions_[index->regions[i]];
+    if (region.contains (p))
+    {
+      priority = max (priority, region.priority);
+      break;
+    }
   }
 
   return priority;
 }
 
 bool
-gams::pose::SearchArea::contains (const Position & p) const
+gams::pose::SearchArea::contains (const Position & pos) const
 {
-  for (unsigned int i = 0; i < regions_.size(); ++i)
-    if (regions_[i].contains (p))
+  if (regions_.empty ())
+    return false;
+
+  const Position p (pose::gps_frame (), pos);
+  std::shared_ptr<const RegionIndex> index = get_region_index ();
+
+  if (p.latitude () < index->min_lat || p.latitude () > index->max_lat ||
+      p.longitude () < index->min_lon || p.longitude () > index->max_lon)
+    return false;
+
+  size_t cell = index->row (p.latitude ()) * index->cols +
+    index->col (p.longitude ());
+
+  for (size_t i = index->offsets[cell]; i < index->offsets[cell + 1]; ++i)
+  {
+    if (regions_[index->regions[i]].contains (p))
       return true;
+  }
+
   return false;
 }
 
+std::shared_ptr<const gams::pose::SearchArea::RegionIndex>
+gams::pose::SearchArea::get_region_index () const
+{
+  std::shared_ptr<const RegionIndex> index =
+    std::atomic_load (&region_index_);
+
+  if (index && index->matches (regions_))
+    return index;
+
+  std::shared_ptr<RegionIndex> built = std::make_shared<RegionIndex> ();
+  const size_t num = regions_.size ();
+
+  built->bounds.reserve (num);
+  built->priorities.reserve (num);
+  built->empty.reserve (num);
+
+  built->min_lat = built->min_lon = DBL_MAX;
+  built->max_lat = built->max_lon = -DBL_MAX;
+  for (const PrioritizedRegion & region : regions_)
+  {
+    built->bounds.push_back (std::array<double, 4> {{
+      region.min_lat_, region.max_lat_, region.min_lon_, region.max_lon_}});
+    built->priorities.push_back (region.priority);
+    built->empty.push_back (region.vertices.empty ());
+
+    built->min_lat = std::min (built->min_lat, region.min_lat_);
+    built->min_lon = std::min (built->min_lon, region.min_lon_);
+    built->max_lat = std::max (built->max_lat, region.max_lat_);
+    built->max_lon = std::max (built->max_lon, region.max_lon_);
+  }
+
+  // about four cells per region, so cells average a handful of regions
+  size_t side = (size_t)std::ceil (2 * std::sqrt ((double)num));
+  side = std::max ((size_t)1, std::min (side, (size_t)256));
+
+  built->cols = built->rows = side;
+  built->cell_lon = (built->max_lon - built->min_lon) / side;
+  built->cell_lat = (built->max_lat - built->min_lat) / side;
+
+  // visit regions by descending priority, so each cell's list is sorted
+  vector<size_t> order (num);
+  for (size_t i = 0; i < num; ++i)
+    order[i] = i;
+  std::stable_sort (order.begin (), order.end (),
+    [this] (size_t lhs, size_t rhs) {
+      return regions_[lhs].priority > regions_[rhs].priority;
+    });
+
+  // first pass counts regions per cell, second pass fills them in
+  built->offsets.assign (side * side + 1, 0);
+  vector<size_t> cursor;
+  for (size_t pass = 0; pass < 2; ++pass)
+  {
+    for (size_t r : order)
+    {
+      const PrioritizedRegion & region = regions_[r];
+      if (region.vertices.empty ())
+        continue;
+
+      size_t col_begin = built->col (region.min_lon_);
+      size_t col_end = built->col (region.max_lon_);
+      size_t row_begin = built->row (region.min_lat_);
+      size_t row_end = built->row (region.max_lat_);
+
+      for (size_t row = row_begin; row <= row_end; ++row)
+      {
+        for (size_t col = col_begin; col <= col_end; ++col)
+        {
+          size_t cell = row * side + col;
+          if (pass == 0)
+            ++built->offsets[cell + 1];
+          else
+            built->regions[cursor[cell]++] = r;
+        }
+      }
+    }
+
+    if (pass == 0)
+    {
+      for (size_t c = 1; c < built->offsets.size (); ++c)
+        built->offsets[c] += built->offsets[c - 1];
+      built->regions.resize (built->offsets.back ());
+      cursor.assign (built->offsets.begin (), built->offsets.end () - 1);
+    }
+  }
+
+  index = built;
+  std::atomic_store (&region_index_, index);
+
+  return index;
+}
+
+void
+gams::pose::SearchArea::invalidate_region_index ()
+{
+  std::atomic_store (&region_index_, std::shared_ptr<const RegionIndex> ());
+}
+
 string
 gams::pose::SearchArea::to_string () const
 {
@@ -377,6 +589,8 @@ gams::pose::SearchArea::calculate_bounding_box ()
 {
   min_lat_ = min_lon_ = min_alt_ = DBL_MAX;
   max_lat_ = max_lon_ = max_alt_ = -DBL_MAX;
+  invalidate_region_index ();
+
   for (unsigned int i = 0; i < regions_.size (); ++i)
   {
     min_lat_ = (min_lat_ > regions_[i].min_lat_) ? regions_[i].min_lat_ : min_lat_;
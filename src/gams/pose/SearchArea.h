@@ -56,6 +56,7 @@
 #ifndef  _GAMS_UTILITY_SEARCH_AREA_H_
 #define  _GAMS_UTILITY_SEARCH_AREA_H_
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -180,6 +181,24 @@ namespace gams
       std::vector<PrioritizedRegion> regions_;
 
     private:
+      /// uniform grid over region bounding boxes, see SearchArea.cpp
+      struct RegionIndex;
+
+      /**
+       * Gets the region index, building it if any region's bounds or
+       * priority changed since it was last built
+       * @return the current index
+       **/
+      std::shared_ptr<const RegionIndex> get_region_index () const;
+
+      /**
+       * Discards the region index, so it is rebuilt on next query
+       **/
+      void invalidate_region_index ();
+
+      /// lazily built on first query, shared between copies
+      mutable std::shared_ptr<const RegionIndex> region_index_;
+
       /**
        * Check if object is of correct type
        * @param kb        Knowledge Base with object
@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file UTMProjection.cpp
+ *
+ * This file contains the fixed-zone UTM projection
+ **/
+
+#include "UTMProjection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include "GPSFrame.h"
+#include "gams/exceptions/ReferenceFrameException.h"
+
+namespace gams
+{
+  namespace pose
+  {
+    namespace
+    {
+      // WGS84 ellipsoid
+      constexpr double wgs84_a = 6378137;
+      constexpr double wgs84_f = 1 / 298.257223563;
+      constexpr double deg_to_rad = M_PI / 180;
+      constexpr double rad_to_deg = 180 / M_PI;
+
+      /**
+       * Sums the Krüger trig series, given sin/cos of 2 * xi and
+       * sinh/cosh of 2 * eta, by angle-addition recurrence, so only one
+       * sin/cos/sinh/cosh is needed regardless of series order.
+       **/
+      inline void kruger_sum (const double (&coeffs)[6],
+        double s2, double c2, double sh2, double ch2,
+        double & xi_sum, double & eta_sum)
+      {
+        double s = s2, c = c2, sh = sh2, ch = ch2;
+        xi_sum = 0;
+        eta_sum = 0;
+
+        for (int j = 0; j < 6; ++j)
+        {
+          xi_sum += coeffs[j] * s * ch;
+          eta_sum += coeffs[j] * c * sh;
+
+          // advance from multiple (j + 1) to (j + 2) of the base angles
+          double ns = s * c2 + c * s2;
+          double nc = c * c2 - s * s2;
+          double nsh = sh * ch2 + ch * sh2;
+          double nch = ch * ch2 + sh * sh2;
+          s = ns; c = nc; sh = nsh; ch = nch;
+        }
+      }
+    }
+
+    constexpr double UTMProjection::K0;
+    constexpr double UTMProjection::FALSE_EASTING;
+    constexpr double UTMProjection::FALSE_NORTHING;
+
+    UTMProjection::UTMProjection (int zone, bool north)
+      : zone_ (zone), north_ (north),
+        lng0_ ((zone * 6 - 183) * deg_to_rad),
+        false_northing_ (north ? 0 : FALSE_NORTHING)
+    {
+      if (zone < 1 || zone > 60)
+      {
+        std::stringstream message;
+        message << "UTMProjection: zone " << zone <<
+          " is not a UTM zone (1-60)";
+        throw exceptions::ReferenceFrameException (message.str ());
+      }
+
+      const double n = wgs84_f / (2 - wgs84_f);
+      const double n2 = n * n, n3 = n2 * n, n4 = n3 * n,
+                   n5 = n4 * n, n6 = n5 * n;
+
+      k0_a_ = K0 * wgs84_a / (1 + n) *
+        (1 + n2 / 4 + n4 / 64 + n6 / 256);
+
+      alpha_[0] = n / 2 - 2 * n2 / 3 + 5 * n3 / 16 + 41 * n4 / 180 -
+        127 * n5 / 288 + 7891 * n6 / 37800;
+      alpha_[1] = 13 * n2 / 48 - 3 * n3 / 5 + 557 * n4 / 1440 +
+        281 * n5 / 630 - 1983433 * n6 / 1935360;
+      alpha_[2] = 61 * n3 / 240 - 103 * n4 / 140 + 15061 * n5 / 26880 +
+        167603 * n6 / 181440;
+      alpha_[3] = 49561 * n4 / 161280 - 179 * n5 / 168 +
+        6601661 * n6 / 7257600;
+      alpha_[4] = 34729 * n5 / 80640 - 3418889 * n6 / 1995840;
+      alpha_[5] = 212378941 * n6 / 319334400;
+
+      beta_[0] = n / 2 - 2 * n2 / 3 + 37 * n3 / 96 - n4 / 360 -
+        81 * n5 / 512 + 96199 * n6 / 604800;
+      beta_[1] = n2 / 48 + n3 / 15 - 437 * n4 / 1440 + 46 * n5 / 105 -
+        1118711 * n6 / 3870720;
+      beta_[2] = 17 * n3 / 480 - 37 * n4 / 840 - 209 * n5 / 4480 +
+        5569 * n6 / 90720;
+      beta_[3] = 4397 * n4 / 161280 - 11 * n5 / 504 -
+        830251 * n6 / 7257600;
+      beta_[4] = 4583 * n5 / 161280 - 108847 * n6 / 3991680;
+      beta_[5] = 20648693 * n6 / 638668800;
+    }
+
+    UTMProjection UTMProjection::for_point (double lat, double lng)
+    {
+      return UTMProjection (standard_zone (lat, lng), lat >= 0);
+    }
+
+    int UTMProjection::standard_zone (double lat, double lng)
+    {
+      // normalize longitude to [-180, 180)
+      lng = std::fmod (lng + 180, 360);
+      if (lng < 0)
+        lng += 360;
+      lng -= 180;
+
+      int zone = (int)std::floor ((lng + 180) / 6) + 1;
+      if (zone > 60)
+        zone = 60;
+
+      // southwest Norway
+      if (lat >= 56 && lat < 64 && lng >= 3 && lng < 12)
+        zone = 32;
+
+      // Svalbard
+      if (lat >= 72 && lat < 84 && lng >= 0 && lng < 42)
+      {
+        if (lng < 9)
+          zone = 31;
+        else if (lng < 21)
+          zone = 33;
+        else if (lng < 33)
+          zone = 35;
+        else
+          zone = 37;
+      }
+
+      return zone;
+    }
+
+    char UTMProjection::nato_band (double lat)
+    {
+      if (lat < -80 || lat > 84)
+        return 'Z';
+
+      static const char bands[] = "CDEFGHJKLMNPQRSTUVWX";
+
+      int index = (int)std::floor ((lat + 80) / 8);
+
+      // band X covers 72N to 84N
+      if (index > 19)
+        index = 19;
+
+      return bands[index];
+    }
+
+    int UTMProjection::zone (void) const
+    {
+      return zone_;
+    }
+
+    bool UTMProjection::north (void) const
+    {
+      return north_;
+    }
+
+    double UTMProjection::central_meridian (void) const
+    {
+      return lng0_ * rad_to_deg;
+    }
+
+    void UTMProjection::forward (double lat, double lng,
+      double & easting, double & northing) const
+    {
+      static const double e = std::sqrt (wgs84_f * (2 - wgs84_f));
+
+      double phi = lat * deg_to_rad;
+      double lambda = std::remainder (lng * deg_to_rad - lng0_, 2 * M_PI);
+
+      // conformal latitude, as tangent
+      double tau = std::tan (phi);
+      double sec = std::hypot (1.0, tau);
+      double sigma = std::sinh (e * std::atanh (e * tau / sec));
+      double tau_p = tau * std::hypot (1.0, sigma) - sigma * sec;
+
+      double cos_lambda = std::cos (lambda);
+      double xi_p = std::atan2 (tau_p, cos_lambda);
+      double eta_p = std::asinh (std::sin (lambda) /
+        std::hypot (tau_p, cos_lambda));
+
+      double xi_sum, eta_sum;
+      kruger_sum (alpha_,
+        std::sin (2 * xi_p), std::cos (2 * xi_p),
+        std::sinh (2 * eta_p), std::cosh (2 * eta_p),
+        xi_sum, eta_sum);
+
+      easting = FALSE_EASTING + k0_a_ * (eta_p + eta_sum);
+      northing = false_northing_ + k0_a_ * (xi_p + xi_sum);
+    }
+
+    void UTMProjection::reverse (double easting, double northing,
+      double & lat, double & lng) const
+    {
+      static const double e2 = wgs84_f * (2 - wgs84_f);
+      static const double e = std::sqrt (e2);
+
+      double xi = (northing - false_northing_) / k0_a_;
+      double eta = (easting - FALSE_EASTING) / k0_a_;
+
+      double xi_sum, eta_sum;
+      kruger_sum (beta_,
+        std::sin (2 * xi), std::cos (2 * xi),
+        std::sinh (2 * eta), std::cosh (2 * eta),
+        xi_sum, eta_sum);
+
+      double xi_p = xi - xi_sum;
+      double eta_p = eta - eta_sum;
+
+      double sinh_eta_p = std::sinh (eta_p);
+      double cos_xi_p = std::cos (xi_p);
+      double tau_p = std::sin (xi_p) / std::hypot (sinh_eta_p, cos_xi_p);
+
+      // invert the conformal latitude by Newton's method; converges
+      // to full double precision in at most a few iterations
+      double tau = tau_p;
+      for (int i = 0; i < 5; ++i)
+      {
+        double sec = std::hypot (1.0, tau);
+        double sigma = std::sinh (e * std::atanh (e * tau / sec));
+        double tau_i = tau * std::hypot (1.0, sigma) - sigma * sec;
+        double delta = (tau_p - tau_i) / std::hypot (1.0, tau_i) *
+          (1 + (1 - e2) * tau * tau) / ((1 - e2) * sec);
+        tau += delta;
+
+        if (std::fabs (delta) < 1e-14 * std::max (1.0, std::fabs (tau)))
+          break;
+      }
+
+      lat = std::atan (tau) * rad_to_deg;
+      lng = (lng0_ + std::atan2 (sinh_eta_p, cos_xi_p)) * rad_to_deg;
+
+      if (lng >= 180)
+        lng -= 360;
+      else if (lng < -180)
+        lng += 360;
+    }
+
+    void UTMProjection::forward (size_t count,
+      const double * lats, const double * lngs,
+      double * eastings, double * northings) const
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        double easting, northing;
+        forward (lats[i], lngs[i], easting, northing);
+        eastings[i] = easting;
+        northings[i] = northing;
+      }
+    }
+
+    void UTMProjection::reverse (size_t count,
+      const double * eastings, const double * northings,
+      double * lats, double * lngs) const
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        double lat, lng;
+        reverse (eastings[i], northings[i], lat, lng);
+        lats[i] = lat;
+        lngs[i] = lng;
+      }
+    }
+
+    void UTMProjection::forward (const std::vector<Position> & points,
+      std::vector<double> & eastings,
+      std::vector<double> & northings) const
+    {
+      eastings.resize (points.size ());
+      northings.resize (points.size ());
+
+      const ReferenceFrame & gps = gps_frame ();
+
+      for (size_t i = 0; i < points.size (); ++i)
+      {
+        if (points[i].frame ().type () == GPS)
+        {
+          forward (points[i].lat (), points[i].lng (),
+            eastings[i], northings[i]);
+        }
+        else
+        {
+          Position converted = points[i].transform_to (gps);
+          forward (converted.lat (), converted.lng (),
+            eastings[i], northings[i]);
+        }
+      }
+    }
+  }
+}
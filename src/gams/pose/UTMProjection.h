@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file UTMProjection.h
+ *
+ * This file contains the UTMProjection class, a fixed-zone transverse
+ * Mercator projection for converting many GPS points at once
+ **/
+
+#ifndef _GAMS_POSE_UTM_PROJECTION_H_
+#define _GAMS_POSE_UTM_PROJECTION_H_
+
+#include <cstddef>
+#include <vector>
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace pose
+  {
+    class Position;
+
+    /**
+     * Projects WGS84 latitude/longitude into UTM easting/northing, and back,
+     * within a single zone and hemisphere fixed at construction.
+     *
+     * Uses the Krüger series for the transverse Mercator projection, carried
+     * to sixth order in the third flattening, as described by Karney (2011),
+     * "Transverse Mercator with an accuracy of a few nanometers". All series
+     * coefficients, the central meridian, and the false northing are computed
+     * once per projection, so per-point cost is a handful of transcendental
+     * calls. Per Karney, truncation error of this series is below 5 nm within
+     * 4000 km of the central meridian; this implementation is accurate to
+     * better than 1 mm for any point within, or near, its UTM zone.
+     *
+     * Points far outside the zone are still projected (UTM "zone forcing"),
+     * but accuracy degrades with distance from the central meridian. UPS
+     * (polar, beyond 84N/80S) is not supported.
+     *
+     * Instances are immutable, and thus safe to share between threads.
+     **/
+    class GAMS_EXPORT UTMProjection
+    {
+    public:
+      /// UTM central scale factor
+      static constexpr double K0 = 0.9996;
+
+      /// False easting applied to all zones, in meters
+      static constexpr double FALSE_EASTING = 500000;
+
+      /// False northing applied in the southern hemisphere, in meters
+      static constexpr double FALSE_NORTHING = 10000000;
+
+      /**
+       * Constructor
+       *
+       * @param zone  the UTM zone, 1 to 60
+       * @param north true for the northern hemisphere
+       * @throw exceptions::ReferenceFrameException if zone is out of range
+       **/
+      UTMProjection (int zone, bool north);
+
+      /**
+       * Creates a projection for the standard zone and hemisphere of a point,
+       * e.g., the first of a list of waypoints.
+       *
+       * @param lat latitude in degrees
+       * @param lng longitude in degrees
+       * @return the projection for that point's standard zone
+       **/
+      static UTMProjection for_point (double lat, double lng);
+
+      /**
+       * Computes the standard UTM zone of a point, including the Norway
+       * and Svalbard exceptions.
+       *
+       * @param lat latitude in degrees
+       * @param lng longitude in degrees
+       * @return the zone, 1 to 60
+       **/
+      static int standard_zone (double lat, double lng);
+
+      /**
+       * Computes the NATO latitude band letter of a latitude
+       *
+       * @param lat latitude in degrees
+       * @return 'C' through 'X' (skipping 'I' and 'O'), or 'Z' if
+       *         the latitude is outside UTM's -80 to 84 range
+       **/
+      static char nato_band (double lat);
+
+      /**
+       * Gets the zone of this projection
+       * @return the zone, 1 to 60
+       **/
+      int zone (void) const;
+
+      /**
+       * Gets the hemisphere of this projection
+       * @return true if northern
+       **/
+      bool north (void) const;
+
+      /**
+       * Gets the central meridian of this projection's zone
+       * @return the central meridian longitude, in degrees
+       **/
+      double central_meridian (void) const;
+
+      /**
+       * Projects a single point
+       *
+       * @param lat       latitude in degrees
+       * @param lng       longitude in degrees
+       * @param easting   output easting, in meters
+       * @param northing  output northing, in meters
+       **/
+      void forward (double lat, double lng,
+        double & easting, double & northing) const;
+
+      /**
+       * Inverse projects a single point
+       *
+       * @param easting   easting, in meters
+       * @param northing  northing, in meters
+       * @param lat       output latitude in degrees
+       * @param lng       output longitude in degrees
+       **/
+      void reverse (double easting, double northing,
+        double & lat, double & lng) const;
+
+      /**
+       * Projects an array of points. Input and output arrays may alias.
+       *
+       * @param count     number of points
+       * @param lats      latitudes in degrees
+       * @param lngs      longitudes in degrees
+       * @param eastings  output eastings, in meters
+       * @param northings output northings, in meters
+       **/
+      void forward (size_t count, const double * lats, const double * lngs,
+        double * eastings, double * northings) const;
+
+      /**
+       * Inverse projects an array of points. Input and output arrays
+       * may alias.
+       *
+       * @param count     number of points
+       * @param eastings  eastings, in meters
+       * @param northings northings, in meters
+       * @param lats      output latitudes in degrees
+       * @param lngs      output longitudes in degrees
+       **/
+      void reverse (size_t count, const double * eastings,
+        const double * northings, double * lats, double * lngs) const;
+
+      /**
+       * Projects a list of Positions. Positions not in a GPS frame are
+       * transformed to gps_frame () first.
+       *
+       * @param points    the points to project
+       * @param eastings  output eastings, in meters; resized to fit
+       * @param northings output northings, in meters; resized to fit
+       **/
+      void forward (const std::vector<Position> & points,
+        std::vector<double> & eastings,
+        std::vector<double> & northings) const;
+
+    private:
+      int zone_;
+      bool north_;
+
+      /// central meridian, in radians
+      double lng0_;
+
+      /// false northing for this hemisphere, in meters
+      double false_northing_;
+
+      /// k0 times the rectifying radius
+      double k0_a_;
+
+      /// forward (alpha) and reverse (beta) Krüger series coefficients
+      double alpha_[6];
+      double beta_[6];
+    };
+  }
+}
+
+#endif // _GAMS_POSE_UTM_PROJECTION_H_
@@ -53,6 +53,7 @@
 
 #include "madara/knowledge/KnowledgeBase.h"
 #include "gams/controllers/BaseController.h"
+#include "gams/utility/EventBarrier.h"
 #include "gams/loggers/GlobalLogger.h"
 #include "gams/loggers/GlobalLogger.h"
 
@@ -125,6 +126,7 @@ void print_usage (char * prog_name)
 " [-P |--period period]         time, in seconds, between control loop executions\n" \
 " [-q |--queue-length length]   length of transport queue in bytes\n" \
 " [-r |--reduced]               use the reduced message header\n" \
+" [--packed-telemetry]          send agent telemetry as one packed record\n" \
 " [-s |--send-hertz hertz]      send hertz rate for modifications\n" \
 " [-t |--target path]           file system location to save received files (NYI)\n" \
 " [-u |--udp ip:port]           a udp ip to send to (first is self to bind to)\n" \
@@ -394,6 +396,10 @@ void handle_arguments (int argc, char ** argv)
     {
       settings.send_reduced_message_header = true;
     }
+    else if (arg1 == "--packed-telemetry")
+    {
+      controller_settings.packed_telemetry = true;
+    }
     else if (arg1 == "-s" || arg1 == "--send-hertz")
     {
       if (i + 1 < argc)
@@ -458,6 +464,9 @@ int main (int argc, char ** argv)
     madara::logger::global_logger->set_level (madara_debug_level);
   }
 
+  // deliver barrier rounds as they arrive, rather than once per loop
+  settings.add_receive_filter (&gams::utility::BarrierEvents::instance ());
+
   // create knowledge base and a control loop
   madara::knowledge::KnowledgeBase knowledge (host, settings);
 
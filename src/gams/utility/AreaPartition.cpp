@@ -0,0 +1,426 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file AreaPartition.cpp
+ *
+ * This file contains the implementation of a partition of a search area
+ * into balanced cells
+ **/
+
+#include "gams/utility/AreaPartition.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#include "gams/loggers/GlobalLogger.h"
+#include "gams/pose/GPSFrame.h"
+#include "gams/pose/ReferenceFrame.h"
+
+#include "madara/knowledge/containers/Integer.h"
+#include "madara/knowledge/containers/NativeDoubleVector.h"
+
+typedef madara::knowledge::KnowledgeRecord::Integer  Integer;
+
+namespace
+{
+  /// a point in the local frame
+  typedef std::pair<double, double> Point;
+
+  /// a polygon in the local frame
+  typedef std::vector<Point> Polygon;
+
+  /// a region of the search area and its weight per square meter
+  struct Weighted
+  {
+    Polygon polygon;
+    double weight;
+  };
+
+  /// bisection stops once the cut is known to this many meters
+  const double TOLERANCE = 1e-4;
+
+  /// coordinate of a point along an axis (0 = x, 1 = y)
+  inline double along (const Point & point, int axis)
+  {
+    return axis == 0 ? point.first : point.second;
+  }
+
+  /**
+   * Clips a polygon to one side of a line across an axis. For a half-plane,
+   * the result has the right area even if the polygon is not convex.
+   **/
+  Polygon clip (const Polygon & polygon, int axis, double value, bool below)
+  {
+    Polygon result;
+    const size_t size = polygon.size ();
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      const Point & current = polygon[i];
+      const Point & next = polygon[(i + 1) % size];
+      const double a = along (current, axis) - value;
+      const double b = along (next, axis) - value;
+      const bool a_in = below ? a <= 0 : a >= 0;
+      const bool b_in = below ? b <= 0 : b >= 0;
+
+      if (a_in)
+        result.push_back (current);
+
+      if (a_in != b_in && a != b)
+      {
+        const double t = a / (a - b);
+        result.push_back (Point (
+          current.first + t * (next.first - current.first),
+          current.second + t * (next.second - current.second)));
+      }
+    }
+
+    return result;
+  }
+
+  /// area of a polygon, by the shoelace formula
+  double area (const Polygon & polygon)
+  {
+    double sum = 0;
+    const size_t size = polygon.size ();
+    for (size_t i = 0; i < size; ++i)
+    {
+      const Point & a = polygon[i];
+      const Point & b = polygon[(i + 1) % size];
+      sum += a.first * b.second - b.first * a.second;
+    }
+    return std::fabs (sum) / 2;
+  }
+
+  /// weight of the regions at or below a cut
+  double weight_below (const std::vector<Weighted> & regions,
+    int axis, double cut)
+  {
+    double result = 0;
+    for (size_t i = 0; i < regions.size (); ++i)
+      result += regions[i].weight *
+        area (clip (regions[i].polygon, axis, cut, true));
+    return result;
+  }
+}
+
+gams::utility::AreaPartition::AreaPartition ()
+{
+}
+
+gams::utility::AreaPartition::~AreaPartition ()
+{
+}
+
+void
+gams::utility::AreaPartition::partition (
+  const pose::SearchArea & search_area, size_t count,
+  bool weighted, size_t threads)
+{
+  cells_.clear ();
+  weights_.clear ();
+
+  pose::Region hull = search_area.get_convex_hull ();
+
+  if (count == 0 || hull.vertices.size () < 3)
+    return;
+
+  // all geometry is done in meters, in a frame at the first hull vertex
+  pose::ReferenceFrame frame (
+    hull.vertices[0].transform_to (pose::gps_frame ()));
+
+  Polygon outline;
+  for (size_t i = 0; i < hull.vertices.size (); ++i)
+  {
+    pose::Position local = hull.vertices[i].transform_to (frame);
+    outline.push_back (Point (local.x (), local.y ()));
+  }
+
+  std::vector<Weighted> regions;
+  const std::vector<pose::PrioritizedRegion> & source =
+    search_area.get_regions ();
+  for (size_t i = 0; i < source.size (); ++i)
+  {
+    Weighted region;
+    region.weight = weighted ? (double)source[i].priority : 1.0;
+
+    if (region.weight <= 0)
+      continue;
+
+    for (size_t j = 0; j < source[i].vertices.size (); ++j)
+    {
+      pose::Position local = source[i].vertices[j].transform_to (frame);
+      region.polygon.push_back (Point (local.x (), local.y ()));
+    }
+    regions.push_back (region);
+  }
+
+  // cut across the longer side, so the cells are not needlessly thin
+  double min_x = outline[0].first, max_x = min_x;
+  double min_y = outline[0].second, max_y = min_y;
+  for (size_t i = 1; i < outline.size (); ++i)
+  {
+    min_x = std::min (min_x, outline[i].first);
+    max_x = std::max (max_x, outline[i].first);
+    min_y = std::min (min_y, outline[i].second);
+    max_y = std::max (max_y, outline[i].second);
+  }
+
+  const int axis = max_x - min_x >= max_y - min_y ? 0 : 1;
+  const double low = axis == 0 ? min_x : min_y;
+  const double high = axis == 0 ? max_x : max_y;
+
+  double total = weight_below (regions, axis, high);
+  if (total <= 0)
+  {
+    // nothing is weighted, so balance the area of the hull
+    regions.clear ();
+    Weighted region;
+    region.polygon = outline;
+    region.weight = 1.0;
+    regions.push_back (region);
+    total = weight_below (regions, axis, high);
+  }
+
+  std::vector<double> cuts (count + 1, low);
+  cuts[count] = high;
+
+  // each cut only depends on its share of the total, so cuts are parallel
+  auto find_cuts = [&] (size_t first, size_t step)
+  {
+    for (size_t k = first; k < count; k += step)
+    {
+      const double target = total * k / count;
+      double lower = low, upper = high;
+
+      while (upper - lower > TOLERANCE)
+      {
+        const double middle = (lower + upper) / 2;
+        if (weight_below (regions, axis, middle) < target)
+          lower = middle;
+        else
+          upper = middle;
+      }
+
+      cuts[k] = (lower + upper) / 2;
+    }
+  };
+
+  if (threads == 0)
+    threads = std::max (1u, std::thread::hardware_concurrency ());
+  threads = std::min (threads, count - 1);
+
+  if (threads <= 1)
+  {
+    find_cuts (1, 1);
+  }
+  else
+  {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+      workers.push_back (std::thread (find_cuts, t + 1, threads));
+    for (size_t t = 0; t < threads; ++t)
+      workers[t].join ();
+  }
+
+  for (size_t k = 1; k <= count; ++k)
+    cuts[k] = std::max (cuts[k], cuts[k - 1]);
+
+  double below = 0;
+  for (size_t k = 0; k < count; ++k)
+  {
+    Polygon cell = clip (clip (outline, axis, cuts[k], false),
+      axis, cuts[k + 1], true);
+
+    std::vector<pose::Position> vertices;
+    for (size_t i = 0; i < cell.size (); ++i)
+    {
+      vertices.push_back (pose::Position (frame,
+        cell[i].first, cell[i].second).transform_to (pose::gps_frame ()));
+    }
+    cells_.push_back (pose::Region (vertices));
+
+    const double above = k + 1 == count ?
+      total : weight_below (regions, axis, cuts[k + 1]);
+    weights_.push_back (above - below);
+    below = above;
+  }
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MINOR,
+    "gams::utility::AreaPartition::partition:" \
+    " split %f weight into %d cells with %d threads\n",
+    total, (int)count, (int)threads);
+}
+
+size_t
+gams::utility::AreaPartition::size (void) const
+{
+  return cells_.size ();
+}
+
+const std::vector<gams::pose::Region> &
+gams::utility::AreaPartition::get_cells (void) const
+{
+  return cells_;
+}
+
+const gams::pose::Region &
+gams::utility::AreaPartition::get_cell (size_t index) const
+{
+  return cells_[index];
+}
+
+double
+gams::utility::AreaPartition::get_weight (size_t index) const
+{
+  return index < weights_.size () ? weights_[index] : 0;
+}
+
+std::string
+gams::utility::AreaPartition::get_prefix (
+  const std::string & area_id, size_t count, bool weighted)
+{
+  std::stringstream buffer;
+  buffer << area_id << (weighted ? ".partition." : ".partition.area.") <<
+    count;
+  return buffer.str ();
+}
+
+void
+gams::utility::AreaPartition::to_container (
+  madara::knowledge::KnowledgeBase & knowledge,
+  const std::string & prefix) const
+{
+  madara::knowledge::containers::NativeDoubleVector weights (
+    prefix + ".weights", knowledge);
+  weights.resize ((int)cells_.size ());
+
+  for (size_t i = 0; i < cells_.size (); ++i)
+  {
+    std::stringstream name;
+    name << prefix << "." << i;
+
+    pose::Region cell (cells_[i]);
+    cell.to_container (knowledge, name.str ());
+    weights.set (i, weights_[i]);
+  }
+
+  // size goes last, so a reader that sees it sees every cell
+  madara::knowledge::containers::Integer size (prefix + ".size", knowledge);
+  size = (Integer)cells_.size ();
+}
+
+bool
+gams::utility::AreaPartition::from_container (
+  madara::knowledge::KnowledgeBase & knowledge,
+  const std::string & prefix)
+{
+  cells_.clear ();
+  weights_.clear ();
+
+  const Integer count = knowledge.get (prefix + ".size").to_integer ();
+  if (count <= 0)
+    return false;
+
+  std::vector<double> weights =
+    knowledge.get (prefix + ".weights").to_doubles ();
+
+  for (Integer i = 0; i < count; ++i)
+  {
+    std::stringstream name;
+    name << prefix << "." << i;
+
+    pose::Region cell;
+    if (!cell.from_container (knowledge, name.str ()))
+    {
+      cells_.clear ();
+      weights_.clear ();
+      return false;
+    }
+
+    cells_.push_back (cell);
+    weights_.push_back ((size_t)i < weights.size () ? weights[(size_t)i] : 0);
+  }
+
+  return true;
+}
+
+gams::pose::Region
+gams::utility::AreaPartition::get_agent_cell (
+  madara::knowledge::KnowledgeBase & knowledge,
+  const std::string & area_id, size_t index, size_t count, bool weighted)
+{
+  pose::SearchArea search_area;
+
+  if (count == 0)
+  {
+    search_area.from_container (knowledge, area_id);
+    return search_area.get_convex_hull ();
+  }
+
+  const std::string prefix = get_prefix (area_id, count, weighted);
+
+  AreaPartition partition;
+  if (!partition.from_container (knowledge, prefix) ||
+    partition.size () != count)
+  {
+    search_area.from_container (knowledge, area_id);
+    partition.partition (search_area, count, weighted);
+
+    if (partition.size () != count)
+      return search_area.get_convex_hull ();
+
+    partition.to_container (knowledge, prefix);
+  }
+
+  return partition.get_cell (std::min (index, count - 1));
+}
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file AreaPartition.h
+ *
+ * This file contains the definition of a partition of a search area into
+ * balanced cells, one per agent
+ **/
+
+#ifndef   _GAMS_UTILITY_AREA_PARTITION_H_
+#define   _GAMS_UTILITY_AREA_PARTITION_H_
+
+#include <string>
+#include <vector>
+
+#include "gams/GamsExport.h"
+#include "gams/pose/Region.h"
+#include "gams/pose/SearchArea.h"
+
+#include "madara/knowledge/KnowledgeBase.h"
+
+namespace gams
+{
+  namespace utility
+  {
+    /**
+    * Splits the convex hull of a search area into parallel strips, one per
+    * agent, so that each strip holds the same share of the area, or of the
+    * area weighted by region priority. This is a boustrophedon
+    * decomposition: every cell is convex, so coverage algorithms that
+    * expect a convex region can work on a cell unchanged. The strips run
+    * across the longer side of the area.
+    *
+    * Each cut is found by bisection on the weight behind it, independently
+    * of the others, so the cuts are computed in parallel. The regions of
+    * the search area are assumed not to overlap.
+    *
+    * The cells are stored in the knowledge base under a key that includes
+    * the number of cells, so agents share one partition per group size and
+    * a change in group size selects a new partition.
+    **/
+    class GAMS_EXPORT AreaPartition
+    {
+    public:
+      /**
+       * Constructor
+       **/
+      AreaPartition ();
+
+      /**
+       * Destructor
+       **/
+      ~AreaPartition ();
+
+      /**
+       * Partitions a search area
+       * @param  area      the search area to partition
+       * @param  count     the number of cells
+       * @param  weighted  if true, balance priority times area. If false,
+       *                   balance area alone.
+       * @param  threads   threads to compute the cuts with. 0 uses one per
+       *                   hardware thread.
+       **/
+      void partition (const pose::SearchArea & area, size_t count,
+        bool weighted = true, size_t threads = 0);
+
+      /**
+       * Gets the number of cells
+       * @return the number of cells
+       **/
+      size_t size (void) const;
+
+      /**
+       * Gets all cells
+       * @return the cells, in order across the area
+       **/
+      const std::vector<pose::Region> & get_cells (void) const;
+
+      /**
+       * Gets a cell
+       * @param  index  index of the cell
+       * @return the cell, in the GPS frame
+       **/
+      const pose::Region & get_cell (size_t index) const;
+
+      /**
+       * Gets the weight of a cell, i.e., its area in square meters, scaled
+       * by priority if the partition is weighted
+       * @param  index  index of the cell
+       * @return the weight of the cell
+       **/
+      double get_weight (size_t index) const;
+
+      /**
+       * Gets the knowledge base prefix of a partition
+       * @param  area_id   name of the search area in the knowledge base
+       * @param  count     the number of cells
+       * @param  weighted  if the partition is weighted by priority
+       * @return the prefix, e.g., "search_area.0.partition.4", or
+       *         "search_area.0.partition.area.4" if not weighted
+       **/
+      static std::string get_prefix (const std::string & area_id,
+        size_t count, bool weighted = true);
+
+      /**
+       * Saves the cells to a knowledge base. Cell i is saved as a Region
+       * under {prefix}.{i}, the weights under {prefix}.weights, and the
+       * number of cells, last, under {prefix}.size.
+       * @param  knowledge   the knowledge base to save to
+       * @param  prefix      the prefix of the partition
+       **/
+      void to_container (madara::knowledge::KnowledgeBase & knowledge,
+        const std::string & prefix) const;
+
+      /**
+       * Loads the cells from a knowledge base
+       * @param  knowledge   the knowledge base to load from
+       * @param  prefix      the prefix of the partition
+       * @return true if a complete partition was found
+       **/
+      bool from_container (madara::knowledge::KnowledgeBase & knowledge,
+        const std::string & prefix);
+
+      /**
+       * Gets an agent's cell of a search area, loading the partition from
+       * the knowledge base, or computing and saving it if it is missing
+       * @param  knowledge   the knowledge base
+       * @param  area_id     name of the search area in the knowledge base
+       * @param  index       index of the agent, e.g., in its group
+       * @param  count       the number of agents
+       * @param  weighted    if true, balance priority times area
+       * @return the agent's cell, or the hull of the area if count is 0
+       **/
+      static pose::Region get_agent_cell (
+        madara::knowledge::KnowledgeBase & knowledge,
+        const std::string & area_id, size_t index, size_t count,
+        bool weighted = true);
+
+    private:
+      /// the cells, in order across the area
+      std::vector<pose::Region> cells_;
+
+      /// the weight of each cell
+      std::vector<double> weights_;
+    };
+  }
+}
+
+#endif // _GAMS_UTILITY_AREA_PARTITION_H_
@@ -0,0 +1,475 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file EventBarrier.cpp
+ *
+ * This file contains the implementation of a barrier that counts arrivals
+ * as round changes come in
+ **/
+
+#include "EventBarrier.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include "gams/loggers/GlobalLogger.h"
+
+namespace knowledge = madara::knowledge;
+
+typedef gams::utility::EventBarrier::Integer Integer;
+
+gams::utility::EventBarrier::EventBarrier ()
+  : knowledge_ (0), id_ (0), round_ (0), arrived_ (0), done_ (false),
+    latency_ (0), max_latency_ (0), total_latency_ (0), completed_ (0)
+{
+}
+
+gams::utility::EventBarrier::EventBarrier (const EventBarrier & rhs)
+  : knowledge_ (0), id_ (0), round_ (0), arrived_ (0), done_ (false),
+    latency_ (0), max_latency_ (0), total_latency_ (0), completed_ (0)
+{
+  *this = rhs;
+}
+
+gams::utility::EventBarrier::~EventBarrier ()
+{
+  if (knowledge_)
+  {
+    BarrierEvents::instance ().remove (this);
+  }
+}
+
+void
+gams::utility::EventBarrier::operator= (const EventBarrier & rhs)
+{
+  if (this == &rhs)
+    return;
+
+  if (knowledge_)
+  {
+    BarrierEvents::instance ().remove (this);
+  }
+
+  {
+    std::lock_guard<std::mutex> guard (mutex_);
+    std::lock_guard<std::mutex> rhs_guard (rhs.mutex_);
+
+    name_ = rhs.name_;
+    knowledge_ = rhs.knowledge_;
+    id_ = rhs.id_;
+    round_ = rhs.round_;
+    rounds_ = rhs.rounds_;
+    refs_ = rhs.refs_;
+    arrived_ = rhs.arrived_;
+    done_ = rhs.done_;
+    arrival_ = rhs.arrival_;
+    latency_ = rhs.latency_;
+    max_latency_ = rhs.max_latency_;
+    total_latency_ = rhs.total_latency_;
+    completed_ = rhs.completed_;
+  }
+
+  if (knowledge_)
+  {
+    BarrierEvents::instance ().add (this);
+  }
+}
+
+void
+gams::utility::EventBarrier::set_name (const std::string & name,
+  knowledge::KnowledgeBase & knowledge, int id, int participants)
+{
+  if (knowledge_)
+  {
+    BarrierEvents::instance ().remove (this);
+  }
+
+  std::vector<knowledge::VariableReference> refs;
+  std::vector<Integer> rounds;
+  refs.reserve (participants > 0 ? participants : 0);
+  rounds.reserve (refs.capacity ());
+
+  for (int i = 0; i < participants; ++i)
+  {
+    std::stringstream buffer;
+    buffer << name << "." << i;
+    refs.push_back (knowledge.get_ref (buffer.str ()));
+    rounds.push_back (knowledge.get (refs.back ()).to_integer ());
+  }
+
+  {
+    std::lock_guard<std::mutex> guard (mutex_);
+
+    name_ = name;
+    knowledge_ = &knowledge;
+    id_ = id >= 0 ? (size_t)id : 0;
+    refs_.swap (refs);
+    rounds_.swap (rounds);
+    round_ = id_ < rounds_.size () ? rounds_[id_] : 0;
+    arrival_ = Clock::now ();
+    latency_ = max_latency_ = total_latency_ = 0;
+    completed_ = 0;
+    recount ();
+    done_ = arrived_ >= rounds_.size ();
+  }
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MAJOR,
+    "gams::utility::EventBarrier::set_name:" \
+    " %s: participant %d of %d at round %d\n",
+    name.c_str (), id, participants, (int)round_);
+
+  BarrierEvents::instance ().add (this);
+}
+
+const std::string &
+gams::utility::EventBarrier::get_name (void) const
+{
+  return name_;
+}
+
+Integer
+gams::utility::EventBarrier::get_round (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return round_;
+}
+
+void
+gams::utility::EventBarrier::set (Integer round)
+{
+  {
+    std::lock_guard<std::mutex> guard (mutex_);
+
+    if (id_ >= rounds_.size ())
+      return;
+
+    round_ = round;
+    rounds_[id_] = round;
+    arrival_ = Clock::now ();
+    recount ();
+    done_ = false;
+    if (check_completion ())
+    {
+      BarrierEvents::instance ().notify ();
+    }
+  }
+
+  publish ();
+}
+
+void
+gams::utility::EventBarrier::next (void)
+{
+  set (get_round () + 1);
+}
+
+void
+gams::utility::EventBarrier::modify (void)
+{
+  if (knowledge_ && id_ < refs_.size ())
+  {
+    knowledge_->mark_modified (refs_[id_]);
+  }
+}
+
+bool
+gams::utility::EventBarrier::is_done (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return done_;
+}
+
+size_t
+gams::utility::EventBarrier::get_arrived (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return arrived_;
+}
+
+size_t
+gams::utility::EventBarrier::get_participants (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return rounds_.size ();
+}
+
+void
+gams::utility::EventBarrier::arrive (size_t id, Integer round)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (id >= rounds_.size () || round <= rounds_[id])
+    return;
+
+  // count the participant once, when it first reaches the current round
+  if (rounds_[id] < round_ && round >= round_)
+  {
+    ++arrived_;
+  }
+  rounds_[id] = round;
+
+  if (check_completion ())
+  {
+    BarrierEvents::instance ().notify ();
+  }
+}
+
+size_t
+gams::utility::EventBarrier::update (void)
+{
+  std::vector<size_t> pending;
+  {
+    std::lock_guard<std::mutex> guard (mutex_);
+
+    if (done_)
+      return 0;
+
+    for (size_t i = 0; i < rounds_.size (); ++i)
+    {
+      if (rounds_[i] < round_)
+        pending.push_back (i);
+    }
+  }
+
+  // read outside of mutex_, which the transport thread takes while it
+  // may hold the knowledge base lock
+  std::vector<Integer> rounds (pending.size ());
+  for (size_t i = 0; i < pending.size (); ++i)
+  {
+    rounds[i] = knowledge_->get (refs_[pending[i]]).to_integer ();
+  }
+
+  size_t before = get_arrived ();
+  for (size_t i = 0; i < pending.size (); ++i)
+  {
+    arrive (pending[i], rounds[i]);
+  }
+
+  return get_arrived () - before;
+}
+
+double
+gams::utility::EventBarrier::get_latency (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return latency_;
+}
+
+double
+gams::utility::EventBarrier::get_max_latency (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return max_latency_;
+}
+
+double
+gams::utility::EventBarrier::get_mean_latency (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return completed_ > 0 ? total_latency_ / completed_ : 0;
+}
+
+size_t
+gams::utility::EventBarrier::get_completed_rounds (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  return completed_;
+}
+
+std::string
+gams::utility::EventBarrier::get_debug_info (void) const
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  std::stringstream buffer;
+  buffer << "Barrier " << name_ << ": round " << round_ << ", " <<
+    arrived_ << " of " << rounds_.size () << " arrived [";
+
+  for (size_t i = 0; i < rounds_.size (); ++i)
+  {
+    if (i > 0)
+      buffer << ", ";
+    buffer << rounds_[i];
+  }
+  buffer << "]\n";
+
+  return buffer.str ();
+}
+
+void
+gams::utility::EventBarrier::recount (void)
+{
+  arrived_ = (size_t)std::count_if (rounds_.begin (), rounds_.end (),
+    [this] (Integer round) { return round >= round_; });
+}
+
+bool
+gams::utility::EventBarrier::check_completion (void)
+{
+  if (done_ || arrived_ < rounds_.size ())
+    return false;
+
+  done_ = true;
+  latency_ = std::chrono::duration<double> (
+    Clock::now () - arrival_).count ();
+  max_latency_ = std::max (max_latency_, latency_);
+  total_latency_ += latency_;
+  ++completed_;
+
+  madara_logger_ptr_log (gams::loggers::global_logger.get (),
+    gams::loggers::LOG_MINOR,
+    "gams::utility::EventBarrier::check_completion:" \
+    " %s: round %d complete after %.3f ms\n",
+    name_.c_str (), (int)round_, latency_ * 1000);
+
+  return true;
+}
+
+void
+gams::utility::EventBarrier::publish (void)
+{
+  if (knowledge_ && id_ < refs_.size ())
+  {
+    knowledge_->set (refs_[id_], get_round ());
+  }
+}
+
+gams::utility::BarrierEvents &
+gams::utility::BarrierEvents::instance (void)
+{
+  static BarrierEvents events;
+  return events;
+}
+
+gams::utility::BarrierEvents::BarrierEvents ()
+  : generation_ (0)
+{
+}
+
+gams::utility::BarrierEvents::~BarrierEvents ()
+{
+}
+
+void
+gams::utility::BarrierEvents::filter (knowledge::KnowledgeMap & records,
+  const madara::transport::TransportContext &, knowledge::Variables &)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  if (barriers_.empty ())
+    return;
+
+  for (knowledge::KnowledgeMap::const_iterator i = records.begin ();
+       i != records.end (); ++i)
+  {
+    const std::string & key = i->first;
+    const size_t dot = key.rfind ('.');
+
+    if (dot == std::string::npos || dot + 1 >= key.size ())
+      continue;
+
+    char * end = 0;
+    unsigned long id = strtoul (key.c_str () + dot + 1, &end, 10);
+    if (*end != 0)
+      continue;
+
+    auto found = barriers_.find (key.substr (0, dot));
+    if (found == barriers_.end ())
+      continue;
+
+    const Integer round = i->second.to_integer ();
+    for (size_t j = 0; j < found->second.size (); ++j)
+    {
+      found->second[j]->arrive ((size_t)id, round);
+    }
+  }
+}
+
+void
+gams::utility::BarrierEvents::add (EventBarrier * barrier)
+{
+  std::lock_guard<std::mutex> guard (mutex_);
+  barriers_[barrier->get_name ()].push_back (barrier);
+}
+
+void
+gams::utility::BarrierEvents::remove (EventBarrier * barrier)
+{
+  // waits for a filter in progress, so barrier is not used after removal
+  std::lock_guard<std::mutex> guard (mutex_);
+
+  auto found = barriers_.find (barrier->get_name ());
+  if (found == barriers_.end ())
+    return;
+
+  std::vector<EventBarrier *> & list = found->second;
+  list.erase (std::remove (list.begin (), list.end (), barrier), list.end ());
+  if (list.empty ())
+  {
+    barriers_.erase (found);
+  }
+}
+
+void
+gams::utility::BarrierEvents::notify (void)
+{
+  {
+    std::lock_guard<std::mutex> guard (wake_mutex_);
+    ++generation_;
+  }
+  wake_.notify_all ();
+}
+
+uint64_t
+gams::utility::BarrierEvents::get_generation (void)
+{
+  std::lock_guard<std::mutex> guard (wake_mutex_);
+  return generation_;
+}
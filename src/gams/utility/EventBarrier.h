@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file EventBarrier.h
+ *
+ * This file contains the definition of a barrier that counts arrivals as
+ * round changes come in
+ **/
+
+#ifndef   _GAMS_UTILITY_EVENT_BARRIER_H_
+#define   _GAMS_UTILITY_EVENT_BARRIER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gams/GamsExport.h"
+#include "madara/knowledge/KnowledgeBase.h"
+#include "madara/filters/AggregateFilter.h"
+
+namespace gams
+{
+  namespace utility
+  {
+    /**
+    * A barrier over participant variables {name}.{id}, each holding the
+    * round that participant has reached, as with
+    * madara::knowledge::containers::Barrier. Instead of comparing every
+    * participant's round on each check, the barrier keeps a count of the
+    * participants that have arrived at the current round. The count is
+    * updated when round changes come in through BarrierEvents, or through
+    * update, which only reads participants that have not arrived. is_done
+    * is constant time.
+    *
+    * The barrier also measures, per round, the time from this
+    * participant's arrival to the arrival of the last participant.
+    **/
+    class GAMS_EXPORT EventBarrier
+    {
+    public:
+      /// the type of a round
+      typedef madara::knowledge::KnowledgeRecord::Integer Integer;
+
+      /// the clock latencies are measured with
+      typedef std::chrono::steady_clock Clock;
+
+      /**
+       * Constructor
+       **/
+      EventBarrier ();
+
+      /**
+       * Copy constructor
+       * @param  rhs   the barrier to copy
+       **/
+      EventBarrier (const EventBarrier & rhs);
+
+      /**
+       * Destructor
+       **/
+      ~EventBarrier ();
+
+      /**
+       * Assignment operator
+       * @param  rhs   the barrier to copy
+       **/
+      void operator= (const EventBarrier & rhs);
+
+      /**
+       * Binds the barrier and reads the rounds participants have reached
+       * @param  name          the prefix of the participant variables
+       * @param  knowledge     the knowledge base of the variables
+       * @param  id            this participant's id, in [0, participants)
+       * @param  participants  the number of participants
+       **/
+      void set_name (const std::string & name,
+        madara::knowledge::KnowledgeBase & knowledge,
+        int id, int participants);
+
+      /**
+       * Gets the prefix of the participant variables
+       * @return the barrier name
+       **/
+      const std::string & get_name (void) const;
+
+      /**
+       * Gets the round this participant is at
+       * @return the current round
+       **/
+      Integer get_round (void) const;
+
+      /**
+       * Sets this participant's round, without waiting on others
+       * @param  round   the round to move to
+       **/
+      void set (Integer round);
+
+      /**
+       * Moves this participant to the next round
+       **/
+      void next (void);
+
+      /**
+       * Marks this participant's round as modified, to be resent
+       **/
+      void modify (void);
+
+      /**
+       * Checks if all participants have reached the current round
+       * @return true if the barrier is done for this round
+       **/
+      bool is_done (void) const;
+
+      /**
+       * Gets the number of participants at or beyond the current round
+       * @return the arrived count
+       **/
+      size_t get_arrived (void) const;
+
+      /**
+       * Gets the number of participants
+       * @return the participant count
+       **/
+      size_t get_participants (void) const;
+
+      /**
+       * Records that a participant has reached a round. Called by
+       * BarrierEvents for incoming changes, and safe to call from
+       * the transport's thread.
+       * @param  id      the participant
+       * @param  round   the round the participant has reached
+       **/
+      void arrive (size_t id, Integer round);
+
+      /**
+       * Reads the rounds of participants that have not arrived. Needed only
+       * when changes do not come through BarrierEvents, e.g., with no
+       * transport filter or changes made directly to the knowledge base.
+       * @return the number of participants that arrived since the last call
+       **/
+      size_t update (void);
+
+      /**
+       * Gets the latency of the last completed round
+       * @return seconds from this participant's arrival to the last arrival
+       **/
+      double get_latency (void) const;
+
+      /**
+       * Gets the largest latency of any completed round
+       * @return the largest latency in seconds
+       **/
+      double get_max_latency (void) const;
+
+      /**
+       * Gets the mean latency of completed rounds
+       * @return the mean latency in seconds
+       **/
+      double get_mean_latency (void) const;
+
+      /**
+       * Gets the number of rounds this participant has seen complete
+       * @return the number of completed rounds
+       **/
+      size_t get_completed_rounds (void) const;
+
+      /**
+       * Prints the arrival state of the barrier
+       * @return participant rounds and the arrived count
+       **/
+      std::string get_debug_info (void) const;
+
+    private:
+      /**
+       * Recounts arrivals for the current round. Called with mutex_ held.
+       **/
+      void recount (void);
+
+      /**
+       * Checks for, and records, completion of the current round. Called
+       * with mutex_ held.
+       * @return true if the round was just completed
+       **/
+      bool check_completion (void);
+
+      /**
+       * Writes this participant's round to the knowledge base
+       **/
+      void publish (void);
+
+      /// protects the arrival state, which the transport thread updates
+      mutable std::mutex mutex_;
+
+      /// the prefix of the participant variables
+      std::string name_;
+
+      /// the knowledge base of the variables, or 0 if not bound
+      madara::knowledge::KnowledgeBase * knowledge_;
+
+      /// this participant's id
+      size_t id_;
+
+      /// this participant's current round
+      Integer round_;
+
+      /// the latest round known for each participant
+      std::vector<Integer> rounds_;
+
+      /// each participant's round variable
+      std::vector<madara::knowledge::VariableReference> refs_;
+
+      /// participants at or beyond round_
+      size_t arrived_;
+
+      /// true once round_ has completed
+      bool done_;
+
+      /// when this participant arrived at round_
+      Clock::time_point arrival_;
+
+      /// latency of the last completed round, in seconds
+      double latency_;
+
+      /// largest latency of a completed round, in seconds
+      double max_latency_;
+
+      /// total latency of completed rounds, in seconds
+      double total_latency_;
+
+      /// rounds this participant has seen complete
+      size_t completed_;
+    };
+
+    /**
+    * A receive filter that routes incoming round changes to the event
+    * barriers of the process, and wakes every waiting controller when any
+    * barrier completes a round. Each waiter keeps the generation it last
+    * saw, so one waking does not hide a completion from the others. Add
+    * the filter to the transport settings before the transport is
+    * created:
+    *
+    *   settings.add_receive_filter (&BarrierEvents::instance ());
+    **/
+    class GAMS_EXPORT BarrierEvents : public madara::filters::AggregateFilter
+    {
+    public:
+      /**
+       * Gets the filter of the process
+       * @return the process-wide filter
+       **/
+      static BarrierEvents & instance (void);
+
+      /**
+       * Destructor
+       **/
+      virtual ~BarrierEvents ();
+
+      /**
+       * Routes each incoming {barrier}.{id} record to its barrier
+       * @param   records           the aggregated packet being evaluated
+       * @param   transport_context context for querying transport state
+       * @param   vars              context for querying current program state
+       **/
+      virtual void filter (madara::knowledge::KnowledgeMap & records,
+        const madara::transport::TransportContext & transport_context,
+        madara::knowledge::Variables & vars);
+
+      /**
+       * Routes round changes for a barrier name to a barrier
+       * @param  barrier   the barrier to add
+       **/
+      void add (EventBarrier * barrier);
+
+      /**
+       * Stops routing round changes to a barrier
+       * @param  barrier   the barrier to remove
+       **/
+      void remove (EventBarrier * barrier);
+
+      /**
+       * Wakes every waiting controller
+       **/
+      void notify (void);
+
+      /**
+       * Gets the number of completed rounds, for a waiter to start from
+       * @return the current generation
+       **/
+      uint64_t get_generation (void);
+
+      /**
+       * Sleeps until the deadline or until a barrier completes a round,
+       * whichever is first. A completion since the generation the waiter
+       * last saw returns immediately.
+       * @param  deadline    the time to wake up at
+       * @param  generation  the generation the waiter last saw, updated
+       *                     to the current one
+       * @return true if woken by a completed round
+       **/
+      template <typename TimePoint>
+      bool wait_until (const TimePoint & deadline, uint64_t & generation)
+      {
+        std::unique_lock<std::mutex> lock (wake_mutex_);
+        wake_.wait_until (lock, deadline,
+          [&] { return generation_ != generation; });
+
+        bool woken = generation_ != generation;
+        generation = generation_;
+        return woken;
+      }
+
+    private:
+      /**
+       * Constructor
+       **/
+      BarrierEvents ();
+
+      /// protects barriers_
+      std::mutex mutex_;
+
+      /// barrier names to barriers, one per participant in this process
+      std::unordered_map<std::string, std::vector<EventBarrier *> > barriers_;
+
+      /// protects generation_
+      std::mutex wake_mutex_;
+
+      /// signaled when a barrier completes a round
+      std::condition_variable wake_;
+
+      /// number of notifies, so each waiter can tell what it has missed
+      uint64_t generation_;
+    };
+  }
+}
+
+#endif // _GAMS_UTILITY_EVENT_BARRIER_H_
@@ -0,0 +1,565 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file GridPlanner.cpp
+ *
+ * This file contains the implementation of an incremental path planner over
+ * an occupancy grid
+ **/
+
+#include "GridPlanner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace
+{
+  const double INF = std::numeric_limits<double>::infinity ();
+
+  const double SQRT2 = std::sqrt (2.0);
+
+  /// keys closer than this are treated as tied
+  const double TOLERANCE = 1e-9;
+
+  /// value for a cell that has not been set
+  const size_t NO_CELL = (size_t)-1;
+}
+
+bool
+gams::utility::GridPlanner::Later::operator() (
+  const Entry & lhs, const Entry & rhs) const
+{
+  return lhs.primary > rhs.primary ||
+    (lhs.primary == rhs.primary && lhs.secondary > rhs.secondary);
+}
+
+gams::utility::GridPlanner::GridPlanner (size_t cols, size_t rows)
+  : cols_ (0), rows_ (0), goal_ (NO_CELL), start_ (NO_CELL), offset_ (0),
+  searching_ (false), expanded_ (0)
+{
+  resize (cols, rows);
+}
+
+gams::utility::GridPlanner::~GridPlanner ()
+{
+}
+
+void
+gams::utility::GridPlanner::resize (size_t cols, size_t rows)
+{
+  cols_ = cols;
+  rows_ = rows;
+  blocked_.assign (cols * rows, 0);
+  distances_.clear ();
+  lookaheads_.clear ();
+  queue_.clear ();
+  changed_.clear ();
+  goal_ = NO_CELL;
+  start_ = NO_CELL;
+  searching_ = false;
+}
+
+size_t
+gams::utility::GridPlanner::cols (void) const
+{
+  return cols_;
+}
+
+size_t
+gams::utility::GridPlanner::rows (void) const
+{
+  return rows_;
+}
+
+bool
+gams::utility::GridPlanner::is_blocked (size_t col, size_t row) const
+{
+  return col >= cols_ || row >= rows_ || blocked_[row * cols_ + col] != 0;
+}
+
+void
+gams::utility::GridPlanner::set_blocked (size_t col, size_t row,
+  bool blocked)
+{
+  if (col >= cols_ || row >= rows_)
+    return;
+
+  size_t cell = row * cols_ + col;
+  if ((blocked_[cell] != 0) != blocked)
+  {
+    blocked_[cell] = blocked ? 1 : 0;
+
+    if (searching_)
+      changed_.push_back (cell);
+  }
+}
+
+gams::utility::GridPlanner::Cells
+gams::utility::GridPlanner::rasterize (
+  const std::vector<Point> & polygon) const
+{
+  Cells result;
+
+  if (polygon.size () < 3 || cols_ == 0 || rows_ == 0)
+    return result;
+
+  double min_y = polygon[0][1], max_y = polygon[0][1];
+  for (size_t i = 1; i < polygon.size (); ++i)
+  {
+    min_y = std::min (min_y, polygon[i][1]);
+    max_y = std::max (max_y, polygon[i][1]);
+  }
+
+  // rows whose centers (row + 0.5) are within the polygon's extent
+  double first = std::max (0.0, std::ceil (min_y - 0.5));
+  double last = std::min ((double)rows_ - 1, std::floor (max_y - 0.5));
+
+  std::vector<double> crossings;
+
+  for (double y = first; y <= last; ++y)
+  {
+    double center = y + 0.5;
+
+    // even-odd crossings of the row's center line
+    crossings.clear ();
+    for (size_t i = 0, j = polygon.size () - 1; i < polygon.size (); j = i++)
+    {
+      const Point & a = polygon[j];
+      const Point & b = polygon[i];
+
+      if ((a[1] <= center) != (b[1] <= center))
+      {
+        crossings.push_back (
+          a[0] + (center - a[1]) * (b[0] - a[0]) / (b[1] - a[1]));
+      }
+    }
+
+    std::sort (crossings.begin (), crossings.end ());
+
+    for (size_t k = 0; k + 1 < crossings.size (); k += 2)
+    {
+      double begin = std::max (0.0, std::ceil (crossings[k] - 0.5));
+      double end = std::min ((double)cols_ - 1,
+        std::floor (crossings[k + 1] - 0.5));
+
+      for (double x = begin; x <= end; ++x)
+      {
+        Cell cell = {(size_t)x, (size_t)y};
+        result.push_back (cell);
+      }
+    }
+  }
+
+  return result;
+}
+
+void
+gams::utility::GridPlanner::set_goal (size_t col, size_t row)
+{
+  size_t goal = col < cols_ && row < rows_ ? row * cols_ + col : NO_CELL;
+
+  if (goal != goal_)
+  {
+    goal_ = goal;
+    searching_ = false;
+  }
+}
+
+bool
+gams::utility::GridPlanner::plan (size_t col, size_t row)
+{
+  expanded_ = 0;
+
+  if (goal_ == NO_CELL || col >= cols_ || row >= rows_)
+    return false;
+
+  size_t start = row * cols_ + col;
+
+  if (!searching_)
+  {
+    distances_.assign (cols_ * rows_, INF);
+    lookaheads_.assign (cols_ * rows_, INF);
+    queue_.clear ();
+    changed_.clear ();
+    offset_ = 0;
+    start_ = start;
+    searching_ = true;
+
+    lookaheads_[goal_] = 0;
+    queue_.push_back (key (goal_));
+  }
+  else
+  {
+    // keys already queued stay lower bounds if they grow by how far the
+    // start moved
+    if (start != start_)
+    {
+      offset_ += heuristic (start_, start);
+      start_ = start;
+    }
+
+    size_t adjacent[8];
+    for (size_t i = 0; i < changed_.size (); ++i)
+    {
+      update (changed_[i]);
+
+      size_t count = neighbors (changed_[i], adjacent);
+      for (size_t j = 0; j < count; ++j)
+        update (adjacent[j]);
+    }
+    changed_.clear ();
+  }
+
+  compute ();
+
+  return distances_[start_] < INF;
+}
+
+gams::utility::GridPlanner::Cells
+gams::utility::GridPlanner::get_path (void) const
+{
+  Cells result;
+
+  if (!searching_ || distances_[start_] == INF)
+    return result;
+
+  size_t adjacent[8];
+  size_t current = start_;
+
+  Cell first = {current % cols_, current / cols_};
+  result.push_back (first);
+
+  std::vector<char> visited (blocked_.size (), 0);
+  visited[current] = 1;
+
+  // descend the distances, which lead to the goal
+  while (current != goal_)
+  {
+    double best = INF;
+    size_t next = NO_CELL;
+
+    size_t count = neighbors (current, adjacent);
+    for (size_t j = 0; j < count; ++j)
+    {
+      double cost = edge (current, adjacent[j]) + distances_[adjacent[j]];
+      if (cost < best)
+      {
+        best = cost;
+        next = adjacent[j];
+      }
+    }
+
+    // a dead end or a cycle means the distances are not a path
+    if (next == NO_CELL || visited[next])
+    {
+      result.clear ();
+      break;
+    }
+
+    current = next;
+    visited[current] = 1;
+    Cell cell = {current % cols_, current / cols_};
+    result.push_back (cell);
+  }
+
+  return result;
+}
+
+gams::utility::GridPlanner::Cells
+gams::utility::GridPlanner::get_waypoints (void) const
+{
+  Cells path = get_path ();
+
+  if (path.size () <= 2)
+    return path;
+
+  Cells result;
+  result.push_back (path[0]);
+
+  // keep a cell only when the next one is not visible from the last kept
+  size_t anchor = 0;
+  for (size_t i = 2; i < path.size (); ++i)
+  {
+    if (!line_of_sight (path[anchor], path[i]))
+    {
+      anchor = i - 1;
+      result.push_back (path[anchor]);
+    }
+  }
+
+  result.push_back (path.back ());
+
+  return result;
+}
+
+double
+gams::utility::GridPlanner::get_cost (void) const
+{
+  return searching_ ? distances_[start_] : INF;
+}
+
+size_t
+gams::utility::GridPlanner::get_expanded (void) const
+{
+  return expanded_;
+}
+
+bool
+gams::utility::GridPlanner::line_of_sight (
+  const Cell & from, const Cell & to) const
+{
+  if (is_blocked (from.col, from.row))
+    return false;
+
+  long dx = (long)to.col - (long)from.col;
+  long dy = (long)to.row - (long)from.row;
+  long steps_x = std::labs (dx), steps_y = std::labs (dy);
+  long sign_x = dx < 0 ? -1 : 1, sign_y = dy < 0 ? -1 : 1;
+
+  size_t col = from.col, row = from.row;
+
+  // visit every cell the segment between the centers touches
+  for (long i = 0, j = 0; i < steps_x || j < steps_y;)
+  {
+    long decision = (1 + 2 * i) * steps_y - (1 + 2 * j) * steps_x;
+
+    if (decision == 0)
+    {
+      // passing exactly through a corner touches both side cells
+      if (is_blocked (col + sign_x, row) || is_blocked (col, row + sign_y))
+        return false;
+
+      col += sign_x;
+      row += sign_y;
+      ++i;
+      ++j;
+    }
+    else if (decision < 0)
+    {
+      col += sign_x;
+      ++i;
+    }
+    else
+    {
+      row += sign_y;
+      ++j;
+    }
+
+    if (is_blocked (col, row))
+      return false;
+  }
+
+  return true;
+}
+
+double
+gams::utility::GridPlanner::heuristic (size_t from, size_t to) const
+{
+  double dx = std::abs ((double)(from % cols_) - (double)(to % cols_));
+  double dy = std::abs ((double)(from / cols_) - (double)(to / cols_));
+
+  return std::max (dx, dy) + (SQRT2 - 1) * std::min (dx, dy);
+}
+
+double
+gams::utility::GridPlanner::edge (size_t from, size_t to) const
+{
+  if (blocked_[from] || blocked_[to])
+    return INF;
+
+  size_t from_col = from % cols_, to_col = to % cols_;
+  size_t from_row = from / cols_, to_row = to / cols_;
+
+  if (from_col == to_col || from_row == to_row)
+    return 1.0;
+
+  // a diagonal may not cut the corner of a blocked cell
+  if (blocked_[from_row * cols_ + to_col] || blocked_[to_row * cols_ + from_col])
+    return INF;
+
+  return SQRT2;
+}
+
+gams::utility::GridPlanner::Entry
+gams::utility::GridPlanner::key (size_t cell) const
+{
+  double best = std::min (distances_[cell], lookaheads_[cell]);
+
+  Entry result = {best + heuristic (start_, cell) + offset_, best, cell};
+  return result;
+}
+
+void
+gams::utility::GridPlanner::update (size_t cell)
+{
+  if (cell != goal_)
+  {
+    double best = INF;
+
+    if (!blocked_[cell])
+    {
+      size_t adjacent[8];
+      size_t count = neighbors (cell, adjacent);
+      for (size_t j = 0; j < count; ++j)
+      {
+        best = std::min (best,
+          edge (cell, adjacent[j]) + distances_[adjacent[j]]);
+      }
+    }
+
+    lookaheads_[cell] = best;
+  }
+
+  if (distances_[cell] != lookaheads_[cell])
+  {
+    queue_.push_back (key (cell));
+    std::push_heap (queue_.begin (), queue_.end (), Later ());
+  }
+}
+
+void
+gams::utility::GridPlanner::compute (void)
+{
+  Later later;
+  size_t adjacent[8];
+
+  for (;;)
+  {
+    // drop entries for cells that became consistent. Keys are not compared
+    // here: rounding can make a key a hair less than the one it was queued
+    // with, and the cell must not be lost.
+    while (!queue_.empty ())
+    {
+      const Entry & top = queue_.front ();
+      if (distances_[top.cell] != lookaheads_[top.cell])
+        break;
+
+      std::pop_heap (queue_.begin (), queue_.end (), later);
+      queue_.pop_back ();
+    }
+
+    if (queue_.empty ())
+      break;
+
+    Entry top = queue_.front ();
+
+    // keys are sums of path lengths and heuristics that reach the same
+    // value by different routes, so a key within the tolerance of the
+    // start's may really be ahead of it even if the heap, which compares
+    // exactly, orders it later. Expanding such ties is only extra work,
+    // while stopping on one can leave g values too low.
+    Entry goal = key (start_);
+    bool ahead = top.primary < goal.primary + TOLERANCE;
+
+    if (!ahead && distances_[start_] == lookaheads_[start_])
+    {
+      break;
+    }
+
+    std::pop_heap (queue_.begin (), queue_.end (), later);
+    queue_.pop_back ();
+
+    size_t cell = top.cell;
+    Entry current = key (cell);
+
+    if (later (current, top))
+    {
+      // the start moved since the cell was queued
+      queue_.push_back (current);
+      std::push_heap (queue_.begin (), queue_.end (), later);
+    }
+    else if (distances_[cell] > lookaheads_[cell])
+    {
+      distances_[cell] = lookaheads_[cell];
+      ++expanded_;
+
+      size_t count = neighbors (cell, adjacent);
+      for (size_t j = 0; j < count; ++j)
+        update (adjacent[j]);
+    }
+    else
+    {
+      distances_[cell] = INF;
+      ++expanded_;
+
+      update (cell);
+
+      size_t count = neighbors (cell, adjacent);
+      for (size_t j = 0; j < count; ++j)
+        update (adjacent[j]);
+    }
+  }
+}
+
+size_t
+gams::utility::GridPlanner::neighbors (size_t cell, size_t * result) const
+{
+  size_t col = cell % cols_, row = cell / cols_;
+  size_t count = 0;
+
+  for (int dy = -1; dy <= 1; ++dy)
+  {
+    if ((dy < 0 && row == 0) || (dy > 0 && row + 1 >= rows_))
+      continue;
+
+    for (int dx = -1; dx <= 1; ++dx)
+    {
+      if ((dx == 0 && dy == 0) ||
+        (dx < 0 && col == 0) || (dx > 0 && col + 1 >= cols_))
+      {
+        continue;
+      }
+
+      result[count++] = (row + dy) * cols_ + (col + dx);
+    }
+  }
+
+  return count;
+}
@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file GridPlanner.h
+ *
+ * This file contains the definition of an incremental path planner over an
+ * occupancy grid
+ **/
+
+#ifndef   _GAMS_UTILITY_GRID_PLANNER_H_
+#define   _GAMS_UTILITY_GRID_PLANNER_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace utility
+  {
+    /**
+    * Plans shortest paths over an 8-connected occupancy grid with D* Lite.
+    * The search runs backward from the goal, so the first plan is an A*
+    * search and later plans only repair the part of the search that
+    * changed cells or a moved start affect. Diagonal moves may not cut
+    * the corner of a blocked cell. Paths can be shortened to line-of-sight
+    * waypoints, which approximates an any-angle (Theta*) path.
+    *
+    * Cell (col, row) covers [col, col + 1) x [row, row + 1) in grid units.
+    **/
+    class GAMS_EXPORT GridPlanner
+    {
+    public:
+      /**
+       * A cell of the grid
+       **/
+      struct Cell
+      {
+        /// column, along x
+        size_t col;
+
+        /// row, along y
+        size_t row;
+      };
+
+      /// a list of cells
+      typedef std::vector<Cell> Cells;
+
+      /// a point in grid units (x, y)
+      typedef std::array<double, 2> Point;
+
+      /**
+       * Constructor
+       * @param  cols    number of columns
+       * @param  rows    number of rows
+       **/
+      GridPlanner (size_t cols = 0, size_t rows = 0);
+
+      /**
+       * Destructor
+       **/
+      ~GridPlanner ();
+
+      /**
+       * Resizes the grid. All cells become free and the search restarts.
+       * @param  cols    number of columns
+       * @param  rows    number of rows
+       **/
+      void resize (size_t cols, size_t rows);
+
+      /**
+       * Gets the number of columns
+       * @return the number of columns
+       **/
+      size_t cols (void) const;
+
+      /**
+       * Gets the number of rows
+       * @return the number of rows
+       **/
+      size_t rows (void) const;
+
+      /**
+       * Checks if a cell is blocked. Cells off the grid are blocked.
+       * @param  col     column of the cell
+       * @param  row     row of the cell
+       * @return true if the cell cannot be entered
+       **/
+      bool is_blocked (size_t col, size_t row) const;
+
+      /**
+       * Blocks or frees a cell. The next plan repairs the search around it.
+       * @param  col     column of the cell
+       * @param  row     row of the cell
+       * @param  blocked true to block the cell, false to free it
+       **/
+      void set_blocked (size_t col, size_t row, bool blocked);
+
+      /**
+       * Finds the cells whose centers are inside a polygon
+       * @param  polygon vertices in grid units, in order
+       * @return the cells, clipped to the grid
+       **/
+      Cells rasterize (const std::vector<Point> & polygon) const;
+
+      /**
+       * Sets the goal. Restarts the search if the goal changed.
+       * @param  col     column of the goal
+       * @param  row     row of the goal
+       **/
+      void set_goal (size_t col, size_t row);
+
+      /**
+       * Plans, or repairs the plan, from a start cell to the goal
+       * @param  col     column of the start
+       * @param  row     row of the start
+       * @return true if the goal can be reached
+       **/
+      bool plan (size_t col, size_t row);
+
+      /**
+       * Gets the path found by the last plan
+       * @return cells from the start to the goal, or empty if there is
+       *         no path or the distances do not lead to the goal
+       **/
+      Cells get_path (void) const;
+
+      /**
+       * Gets the path found by the last plan, keeping only the cells
+       * where it must turn to stay out of blocked cells
+       * @return cells from the start to the goal, or empty if there is
+       *         no path
+       **/
+      Cells get_waypoints (void) const;
+
+      /**
+       * Gets the length of the path found by the last plan
+       * @return the length in grid units, or infinity if there is no path
+       **/
+      double get_cost (void) const;
+
+      /**
+       * Gets the number of cells expanded by the last plan
+       * @return the number of expansions
+       **/
+      size_t get_expanded (void) const;
+
+      /**
+       * Checks if a straight line between two cell centers touches only
+       * free cells
+       * @param  from    the first cell
+       * @param  to      the second cell
+       * @return true if the line is clear
+       **/
+      bool line_of_sight (const Cell & from, const Cell & to) const;
+
+    private:
+      /// a search queue entry. Stale entries are skipped when popped.
+      struct Entry
+      {
+        double primary;
+        double secondary;
+        size_t cell;
+      };
+
+      /**
+       * Orders entries so the heap's front has the least key
+       **/
+      struct Later
+      {
+        bool operator() (const Entry & lhs, const Entry & rhs) const;
+      };
+
+      /**
+       * Estimates the distance between two cells (octile distance)
+       **/
+      double heuristic (size_t from, size_t to) const;
+
+      /**
+       * Gets the cost of moving between neighboring cells
+       **/
+      double edge (size_t from, size_t to) const;
+
+      /**
+       * Computes the queue key of a cell
+       **/
+      Entry key (size_t cell) const;
+
+      /**
+       * Recomputes a cell's one-step lookahead and requeues it if it is
+       * inconsistent
+       **/
+      void update (size_t cell);
+
+      /**
+       * Expands cells until the start is consistent and no queued cell
+       * could shorten its path
+       **/
+      void compute (void);
+
+      /**
+       * Gets the neighbors of a cell
+       * @return the number of neighbors written to neighbors
+       **/
+      size_t neighbors (size_t cell, size_t * neighbors) const;
+
+      /// number of columns
+      size_t cols_;
+
+      /// number of rows
+      size_t rows_;
+
+      /// 1 for blocked cells, stored row by row
+      std::vector<unsigned char> blocked_;
+
+      /// distance to the goal of each cell
+      std::vector<double> distances_;
+
+      /// one-step lookahead of each cell's distance to the goal
+      std::vector<double> lookaheads_;
+
+      /// the search queue, a binary heap
+      std::vector<Entry> queue_;
+
+      /// cells changed since the last plan
+      std::vector<size_t> changed_;
+
+      /// goal cell
+      size_t goal_;
+
+      /// start cell of the last plan
+      size_t start_;
+
+      /// heuristic offset for starts moved since the search began
+      double offset_;
+
+      /// true if the search has been initialized for the goal
+      bool searching_;
+
+      /// cells expanded by the last plan
+      size_t expanded_;
+    };
+  }
+}
+
+#endif // _GAMS_UTILITY_GRID_PLANNER_H_
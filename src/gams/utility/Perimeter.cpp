@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file Perimeter.cpp
+ *
+ * This file contains the implementation of an arc-length parameterized
+ * perimeter of a polygon
+ **/
+
+#include "gams/utility/Perimeter.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+gams::utility::Perimeter::Perimeter (
+  const std::vector<pose::Position> & vertices)
+{
+  set_vertices (vertices);
+}
+
+gams::utility::Perimeter::~Perimeter ()
+{
+}
+
+void
+gams::utility::Perimeter::set_vertices (
+  const std::vector<pose::Position> & vertices)
+{
+  x_.clear ();
+  y_.clear ();
+  z_.clear ();
+  distances_.clear ();
+
+  if (vertices.size () == 0)
+    return;
+
+  out_frame_ = vertices[0].frame ();
+  frame_ = pose::ReferenceFrame (vertices[0]);
+
+  x_.reserve (vertices.size () + 1);
+  y_.reserve (vertices.size () + 1);
+  z_.reserve (vertices.size () + 1);
+  distances_.reserve (vertices.size () + 1);
+
+  for (size_t i = 0; i <= vertices.size (); ++i)
+  {
+    pose::Position local =
+      vertices[i % vertices.size ()].transform_to (frame_);
+    x_.push_back (local.x ());
+    y_.push_back (local.y ());
+    z_.push_back (local.z ());
+
+    if (i == 0)
+      distances_.push_back (0);
+    else
+      distances_.push_back (distances_.back () + std::sqrt (
+        (x_[i] - x_[i - 1]) * (x_[i] - x_[i - 1]) +
+        (y_[i] - y_[i - 1]) * (y_[i] - y_[i - 1])));
+  }
+}
+
+size_t
+gams::utility::Perimeter::size (void) const
+{
+  return x_.size () == 0 ? 0 : x_.size () - 1;
+}
+
+bool
+gams::utility::Perimeter::empty (void) const
+{
+  return x_.size () == 0;
+}
+
+double
+gams::utility::Perimeter::get_length (void) const
+{
+  return distances_.size () == 0 ? 0 : distances_.back ();
+}
+
+double
+gams::utility::Perimeter::get_distance (size_t index) const
+{
+  return index < distances_.size () ? distances_[index] : get_length ();
+}
+
+double
+gams::utility::Perimeter::wrap (double distance) const
+{
+  const double length = get_length ();
+
+  if (length <= 0)
+    return 0;
+
+  distance = std::fmod (distance, length);
+  if (distance < 0)
+    distance += length;
+
+  // fmod of a tiny negative can round up to exactly length
+  return distance < length ? distance : 0;
+}
+
+size_t
+gams::utility::Perimeter::edge_at (double distance) const
+{
+  if (size () < 2)
+    return 0;
+
+  distance = wrap (distance);
+
+  // first vertex past the distance ends the edge
+  std::vector<double>::const_iterator end =
+    std::upper_bound (distances_.begin (), distances_.end (), distance);
+
+  size_t edge = (size_t)(end - distances_.begin ()) - 1;
+  return std::min (edge, size () - 1);
+}
+
+gams::pose::Position
+gams::utility::Perimeter::position_at (double distance) const
+{
+  if (empty ())
+    return pose::Position ();
+
+  distance = wrap (distance);
+  const size_t edge = edge_at (distance);
+  const double edge_length = distances_[edge + 1] - distances_[edge];
+  const double t = edge_length > 0 ?
+    (distance - distances_[edge]) / edge_length : 0;
+
+  pose::Position local (frame_,
+    x_[edge] + t * (x_[edge + 1] - x_[edge]),
+    y_[edge] + t * (y_[edge + 1] - y_[edge]),
+    z_[edge] + t * (z_[edge + 1] - z_[edge]));
+
+  return local.transform_to (out_frame_);
+}
+
+double
+gams::utility::Perimeter::project (const pose::Position & position) const
+{
+  if (empty ())
+    return 0;
+
+  pose::Position local = position.transform_to (frame_);
+  const double px = local.x ();
+  const double py = local.y ();
+
+  double best = DBL_MAX;
+  double result = 0;
+
+  for (size_t i = 0; i < size (); ++i)
+  {
+    const double dx = x_[i + 1] - x_[i];
+    const double dy = y_[i + 1] - y_[i];
+    const double length2 = dx * dx + dy * dy;
+
+    double t = 0;
+    if (length2 > 0)
+      t = std::max (0.0, std::min (1.0,
+        ((px - x_[i]) * dx + (py - y_[i]) * dy) / length2));
+
+    const double cx = x_[i] + t * dx - px;
+    const double cy = y_[i] + t * dy - py;
+    const double distance2 = cx * cx + cy * cy;
+
+    if (distance2 < best)
+    {
+      best = distance2;
+      result = distances_[i] + t * (distances_[i + 1] - distances_[i]);
+    }
+  }
+
+  return wrap (result);
+}
+
+std::vector<double>
+gams::utility::Perimeter::spaced (size_t count, double start) const
+{
+  std::vector<double> result;
+  result.reserve (count);
+
+  const double step = count > 0 ? get_length () / count : 0;
+  for (size_t i = 0; i < count; ++i)
+    result.push_back (wrap (start + step * i));
+
+  return result;
+}
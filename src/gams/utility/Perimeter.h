@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file Perimeter.h
+ *
+ * This file contains the definition of an arc-length parameterized
+ * perimeter of a polygon
+ **/
+
+#ifndef   _GAMS_UTILITY_PERIMETER_H_
+#define   _GAMS_UTILITY_PERIMETER_H_
+
+#include <vector>
+
+#include "gams/GamsExport.h"
+#include "gams/pose/Position.h"
+#include "gams/pose/ReferenceFrame.h"
+
+namespace gams
+{
+  namespace utility
+  {
+    /**
+    * The closed perimeter of a polygon, parameterized by distance travelled
+    * from the first vertex. The vertices are projected once into a local
+    * Cartesian frame, and the cumulative length at each vertex is stored,
+    * so finding the position at a distance is a binary search, O(log V),
+    * plus one transform. Distances wrap around the perimeter, and negative
+    * distances go backwards, so spacing agents evenly or looking a fixed
+    * distance ahead needs no scans over the vertices.
+    **/
+    class GAMS_EXPORT Perimeter
+    {
+    public:
+      /**
+       * Constructor
+       * @param  vertices  the vertices of the polygon, in order. The last
+       *                   vertex connects back to the first.
+       **/
+      Perimeter (const std::vector<pose::Position> & vertices =
+        std::vector<pose::Position> ());
+
+      /**
+       * Destructor
+       **/
+      ~Perimeter ();
+
+      /**
+       * Replaces the vertices of the perimeter
+       * @param  vertices  the vertices of the polygon, in order
+       **/
+      void set_vertices (const std::vector<pose::Position> & vertices);
+
+      /**
+       * Gets the number of vertices
+       * @return the number of vertices
+       **/
+      size_t size (void) const;
+
+      /**
+       * Checks if the perimeter has no vertices
+       * @return true if there are no vertices
+       **/
+      bool empty (void) const;
+
+      /**
+       * Gets the total length of the perimeter
+       * @return the length in meters
+       **/
+      double get_length (void) const;
+
+      /**
+       * Gets the distance along the perimeter to a vertex
+       * @param  index   index of the vertex
+       * @return the distance from the first vertex, in meters
+       **/
+      double get_distance (size_t index) const;
+
+      /**
+       * Wraps a distance into [0, length)
+       * @param  distance   the distance in meters, which may be negative
+       * @return the equivalent distance along the perimeter
+       **/
+      double wrap (double distance) const;
+
+      /**
+       * Gets the position at a distance along the perimeter. O(log V).
+       * @param  distance   the distance from the first vertex in meters.
+       *                    Wraps around, and may be negative.
+       * @return the position, in the frame of the first vertex
+       **/
+      pose::Position position_at (double distance) const;
+
+      /**
+       * Gets the index of the edge a distance falls on. Edge i goes from
+       * vertex i to vertex i + 1. O(log V).
+       * @param  distance   the distance from the first vertex in meters
+       * @return the index of the edge
+       **/
+      size_t edge_at (double distance) const;
+
+      /**
+       * Finds the distance along the perimeter of the closest point to a
+       * position. O(V).
+       * @param  position   the position to project
+       * @return the distance from the first vertex in meters
+       **/
+      double project (const pose::Position & position) const;
+
+      /**
+       * Gets the distances of evenly spaced points along the perimeter
+       * @param  count    the number of points
+       * @param  start    the distance of the first point
+       * @return the distances of the points, in order
+       **/
+      std::vector<double> spaced (size_t count, double start = 0) const;
+
+    private:
+      /// local frame the edges are measured in
+      pose::ReferenceFrame frame_;
+
+      /// frame positions are returned in
+      pose::ReferenceFrame out_frame_;
+
+      /// vertex x coordinates in frame_, with the first repeated at the end
+      std::vector<double> x_;
+
+      /// vertex y coordinates in frame_, with the first repeated at the end
+      std::vector<double> y_;
+
+      /// vertex z coordinates in frame_, with the first repeated at the end
+      std::vector<double> z_;
+
+      /// distance from the first vertex to each vertex, then the length
+      std::vector<double> distances_;
+    };
+  }
+}
+
+#endif // _GAMS_UTILITY_PERIMETER_H_
@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file PheromoneField.cpp
+ *
+ * This file contains the implementation of a dense grid of virtual
+ * pheromone concentrations
+ **/
+
+#include "PheromoneField.h"
+
+#include <algorithm>
+
+gams::utility::PheromoneField::PheromoneField (size_t cols, size_t rows)
+  : cols_ (0), rows_ (0), evaporation_ (0), diffusion_ (0)
+{
+  resize (cols, rows);
+}
+
+gams::utility::PheromoneField::~PheromoneField ()
+{
+}
+
+void
+gams::utility::PheromoneField::resize (size_t cols, size_t rows)
+{
+  cols_ = cols;
+  rows_ = rows;
+
+  size_t padded = (cols + 2) * (rows + 2);
+  values_.assign (padded, 0.0);
+  next_.assign (padded, 0.0);
+  valid_.assign (padded, 0.0);
+
+  for (size_t row = 0; row < rows; ++row)
+  {
+    std::fill_n (valid_.begin () + index (0, row), cols, 1.0);
+  }
+}
+
+size_t
+gams::utility::PheromoneField::cols (void) const
+{
+  return cols_;
+}
+
+size_t
+gams::utility::PheromoneField::rows (void) const
+{
+  return rows_;
+}
+
+void
+gams::utility::PheromoneField::set_evaporation (double evaporation)
+{
+  evaporation_ = std::min (std::max (evaporation, 0.0), 1.0);
+}
+
+double
+gams::utility::PheromoneField::get_evaporation (void) const
+{
+  return evaporation_;
+}
+
+void
+gams::utility::PheromoneField::set_diffusion (double diffusion)
+{
+  diffusion_ = std::min (std::max (diffusion, 0.0), 1.0);
+}
+
+double
+gams::utility::PheromoneField::get_diffusion (void) const
+{
+  return diffusion_;
+}
+
+size_t
+gams::utility::PheromoneField::index (size_t col, size_t row) const
+{
+  return (row + 1) * (cols_ + 2) + col + 1;
+}
+
+bool
+gams::utility::PheromoneField::is_valid (size_t col, size_t row) const
+{
+  return col < cols_ && row < rows_ && valid_[index (col, row)] != 0;
+}
+
+void
+gams::utility::PheromoneField::set_valid (size_t col, size_t row, bool valid)
+{
+  if (col < cols_ && row < rows_)
+  {
+    size_t cell = index (col, row);
+    valid_[cell] = valid ? 1.0 : 0.0;
+
+    if (!valid)
+      values_[cell] = 0.0;
+  }
+}
+
+double
+gams::utility::PheromoneField::get (size_t col, size_t row) const
+{
+  return col < cols_ && row < rows_ ? values_[index (col, row)] : 0.0;
+}
+
+void
+gams::utility::PheromoneField::deposit (size_t col, size_t row, double amount)
+{
+  if (col < cols_ && row < rows_)
+  {
+    size_t cell = index (col, row);
+    values_[cell] += amount * valid_[cell];
+  }
+}
+
+void
+gams::utility::PheromoneField::step (void)
+{
+  const size_t stride = cols_ + 2;
+  const double keep = 1.0 - evaporation_;
+  const double share = diffusion_ / 4;
+
+  const double * values = values_.data ();
+  const double * valid = valid_.data ();
+  double * next = next_.data ();
+
+  for (size_t row = 0; row < rows_; ++row)
+  {
+    const size_t first = index (0, row);
+    const size_t last = first + cols_;
+
+    /**
+     * each cell trades pheromone with its valid neighbors. Invalid cells
+     * and the padding have a weight of 0, so no edge needs a branch.
+     **/
+    for (size_t i = first; i < last; ++i)
+    {
+      const double value = values[i];
+      const double flow =
+        valid[i - 1] * (values[i - 1] - value) +
+        valid[i + 1] * (values[i + 1] - value) +
+        valid[i - stride] * (values[i - stride] - value) +
+        valid[i + stride] * (values[i + stride] - value);
+
+      next[i] = valid[i] * keep * (value + share * flow);
+    }
+  }
+
+  values_.swap (next_);
+}
+
+void
+gams::utility::PheromoneField::step (size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    step ();
+  }
+}
+
+double
+gams::utility::PheromoneField::get_total (void) const
+{
+  double total (0);
+
+  for (size_t i = 0; i < values_.size (); ++i)
+  {
+    total += values_[i];
+  }
+
+  return total;
+}
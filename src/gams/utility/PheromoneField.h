@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file PheromoneField.h
+ *
+ * This file contains the definition of a dense grid of virtual pheromone
+ * concentrations
+ **/
+
+#ifndef   _GAMS_UTILITY_PHEROMONE_FIELD_H_
+#define   _GAMS_UTILITY_PHEROMONE_FIELD_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "gams/GamsExport.h"
+
+namespace gams
+{
+  namespace utility
+  {
+    /**
+    * A dense grid of virtual pheromone concentrations. Each step, the
+    * pheromone evaporates by a fraction and diffuses to the 4 adjacent
+    * cells. Only cells marked as part of the field hold pheromone, and
+    * nothing diffuses into or out of the other cells.
+    *
+    * The grid is stored row-major with a border of unused cells, so one
+    * step is a single branch-free pass over contiguous memory that the
+    * compiler can vectorize.
+    **/
+    class GAMS_EXPORT PheromoneField
+    {
+    public:
+      /**
+       * Constructor
+       * @param  cols    number of columns
+       * @param  rows    number of rows
+       **/
+      PheromoneField (size_t cols = 0, size_t rows = 0);
+
+      /**
+       * Destructor
+       **/
+      ~PheromoneField ();
+
+      /**
+       * Resizes the field. All cells are cleared and marked as part of
+       * the field.
+       * @param  cols    number of columns
+       * @param  rows    number of rows
+       **/
+      void resize (size_t cols, size_t rows);
+
+      /**
+       * Gets the number of columns
+       * @return the number of columns
+       **/
+      size_t cols (void) const;
+
+      /**
+       * Gets the number of rows
+       * @return the number of rows
+       **/
+      size_t rows (void) const;
+
+      /**
+       * Sets the fraction of pheromone that evaporates each step
+       * @param  evaporation   fraction in [0, 1]
+       **/
+      void set_evaporation (double evaporation);
+
+      /**
+       * Gets the fraction of pheromone that evaporates each step
+       * @return the fraction in [0, 1]
+       **/
+      double get_evaporation (void) const;
+
+      /**
+       * Sets the fraction of a cell's pheromone that diffuses to its
+       * neighbors each step
+       * @param  diffusion     fraction in [0, 1]
+       **/
+      void set_diffusion (double diffusion);
+
+      /**
+       * Gets the fraction of a cell's pheromone that diffuses to its
+       * neighbors each step
+       * @return the fraction in [0, 1]
+       **/
+      double get_diffusion (void) const;
+
+      /**
+       * Checks if a cell is part of the field. Cells off the grid are not.
+       * @param  col     column of the cell
+       * @param  row     row of the cell
+       * @return true if the cell holds pheromone
+       **/
+      bool is_valid (size_t col, size_t row) const;
+
+      /**
+       * Adds a cell to the field, or removes it and its pheromone
+       * @param  col     column of the cell
+       * @param  row     row of the cell
+       * @param  valid   true if the cell is part of the field
+       **/
+      void set_valid (size_t col, size_t row, bool valid);
+
+      /**
+       * Gets the concentration in a cell
+       * @param  col     column of the cell
+       * @param  row     row of the cell
+       * @return the concentration, or 0 if the cell is off the grid
+       **/
+      double get (size_t col, size_t row) const;
+
+      /**
+       * Adds pheromone to a cell. Cells outside the field are ignored.
+       * @param  col     column of the cell
+       * @param  row     row of the cell
+       * @param  amount  the pheromone to add
+       **/
+      void deposit (size_t col, size_t row, double amount);
+
+      /**
+       * Evaporates and diffuses the pheromone once
+       **/
+      void step (void);
+
+      /**
+       * Evaporates and diffuses the pheromone a number of times
+       * @param  count   the number of steps
+       **/
+      void step (size_t count);
+
+      /**
+       * Gets the total pheromone in the field
+       * @return the sum of all concentrations
+       **/
+      double get_total (void) const;
+
+    private:
+      /**
+       * Gets the index of a cell in the padded storage
+       **/
+      size_t index (size_t col, size_t row) const;
+
+      /// number of columns
+      size_t cols_;
+
+      /// number of rows
+      size_t rows_;
+
+      /// fraction that evaporates each step
+      double evaporation_;
+
+      /// fraction that diffuses each step
+      double diffusion_;
+
+      /// concentrations, padded by one cell on every side
+      std::vector<double> values_;
+
+      /// the next concentrations, computed by step
+      std::vector<double> next_;
+
+      /// 1 for cells in the field, 0 for other cells and the padding
+      std::vector<double> valid_;
+    };
+  }
+}
+
+#endif // _GAMS_UTILITY_PHEROMONE_FIELD_H_
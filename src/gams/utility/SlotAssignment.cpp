@@ -0,0 +1,729 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file SlotAssignment.cpp
+ *
+ * This file contains the implementation of an optimal agent to slot
+ * assignment
+ **/
+
+#include "SlotAssignment.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+  const double INF = std::numeric_limits<double>::max ();
+
+  /**
+   * Maximum bipartite matching (Hopcroft-Karp) of agents to slots, over
+   * the pairs that cost no more than a limit
+   **/
+  class Matcher
+  {
+  public:
+    Matcher (const gams::utility::SlotAssignment::Costs & costs,
+      size_t slots, double limit)
+      : costs_ (costs), slots_ (slots), limit_ (limit),
+        agent_slots_ (costs.size (), -1), slot_agents_ (slots, -1),
+        levels_ (costs.size ())
+    {
+    }
+
+    /// seeds the matching with a pair, if it is within the limit
+    void seed (size_t agent, int slot)
+    {
+      if (slot >= 0 && (size_t)slot < slots_ &&
+        costs_[agent][slot] <= limit_ && slot_agents_[slot] < 0)
+      {
+        agent_slots_[agent] = slot;
+        slot_agents_[slot] = (int)agent;
+      }
+    }
+
+    /// grows the matching to maximum size
+    size_t match (void)
+    {
+      size_t matched = 0;
+      for (size_t i = 0; i < agent_slots_.size (); ++i)
+      {
+        if (agent_slots_[i] >= 0)
+          ++matched;
+      }
+
+      while (layer ())
+      {
+        for (size_t i = 0; i < agent_slots_.size (); ++i)
+        {
+          if (agent_slots_[i] < 0 && path (i))
+            ++matched;
+        }
+      }
+
+      return matched;
+    }
+
+  private:
+    /// layers agents by alternating distance from free agents
+    bool layer (void)
+    {
+      std::vector<size_t> queue;
+      queue.reserve (agent_slots_.size ());
+
+      for (size_t i = 0; i < agent_slots_.size (); ++i)
+      {
+        if (agent_slots_[i] < 0)
+        {
+          levels_[i] = 0;
+          queue.push_back (i);
+        }
+        else
+        {
+          levels_[i] = -1;
+        }
+      }
+
+      bool found = false;
+      for (size_t q = 0; q < queue.size (); ++q)
+      {
+        size_t agent = queue[q];
+        const std::vector<double> & row = costs_[agent];
+        for (size_t j = 0; j < slots_; ++j)
+        {
+          if (row[j] > limit_)
+            continue;
+
+          int next = slot_agents_[j];
+          if (next < 0)
+          {
+            found = true;
+          }
+          else if (levels_[next] < 0)
+          {
+            levels_[next] = levels_[agent] + 1;
+            queue.push_back ((size_t)next);
+          }
+        }
+      }
+
+      return found;
+    }
+
+    /// finds an augmenting path from an agent along the layers
+    bool path (size_t agent)
+    {
+      const std::vector<double> & row = costs_[agent];
+      for (size_t j = 0; j < slots_; ++j)
+      {
+        if (row[j] > limit_)
+          continue;
+
+        int next = slot_agents_[j];
+        if (next < 0 ||
+          (levels_[next] == levels_[agent] + 1 && path ((size_t)next)))
+        {
+          agent_slots_[agent] = (int)j;
+          slot_agents_[j] = (int)agent;
+          return true;
+        }
+      }
+
+      // dead end, so don't search from this agent again this phase
+      levels_[agent] = -1;
+      return false;
+    }
+
+    const gams::utility::SlotAssignment::Costs & costs_;
+    size_t slots_;
+    double limit_;
+    std::vector<int> agent_slots_;
+    std::vector<int> slot_agents_;
+    std::vector<int> levels_;
+  };
+}
+
+const int gams::utility::SlotAssignment::UNASSIGNED;
+
+gams::utility::SlotAssignment::SlotAssignment (Objective objective)
+  : objective_ (objective), slots_ (0), size_ (0),
+  threshold_ (INF), penalty_ (0)
+{
+}
+
+gams::utility::SlotAssignment::~SlotAssignment ()
+{
+}
+
+void
+gams::utility::SlotAssignment::set_objective (Objective objective)
+{
+  objective_ = objective;
+  threshold_ = INF;
+  reset ();
+}
+
+gams::utility::SlotAssignment::Objective
+gams::utility::SlotAssignment::get_objective (void) const
+{
+  return objective_;
+}
+
+void
+gams::utility::SlotAssignment::clear (void)
+{
+  costs_.clear ();
+  slots_ = 0;
+  size_ = 0;
+  agent_prices_.clear ();
+  slot_prices_.clear ();
+  agent_slots_.clear ();
+  slot_agents_.clear ();
+  result_.clear ();
+  threshold_ = INF;
+}
+
+void
+gams::utility::SlotAssignment::set_costs (const Costs & costs)
+{
+  costs_ = costs;
+  slots_ = costs.size () > 0 ? costs[0].size () : 0;
+
+  size_t size = std::max (costs_.size (), slots_);
+
+  for (size_t i = 0; i < costs_.size (); ++i)
+  {
+    costs_[i].resize (slots_, 0.0);
+  }
+
+  threshold_ = INF;
+
+  if (size == size_)
+  {
+    // same size, so keep the slot prices as a starting point
+    reset ();
+  }
+  else
+  {
+    size_ = size;
+    agent_prices_.assign (size_, 0.0);
+    slot_prices_.assign (size_, 0.0);
+    agent_slots_.assign (size_, UNASSIGNED);
+    slot_agents_.assign (size_, UNASSIGNED);
+  }
+}
+
+void
+gams::utility::SlotAssignment::set_agent (size_t agent,
+  const std::vector<double> & costs)
+{
+  if (agent > costs_.size ())
+    return;
+
+  if (agent == costs_.size ())
+  {
+    if (costs_.size () == size_)
+      grow ();
+
+    costs_.push_back (costs);
+  }
+  else
+  {
+    costs_[agent] = costs;
+  }
+
+  costs_[agent].resize (slots_, 0.0);
+
+  // the agent, or the dummy it replaced, will take a new path
+  unassign (agent);
+}
+
+void
+gams::utility::SlotAssignment::remove_agent (size_t agent)
+{
+  if (agent >= costs_.size ())
+    return;
+
+  unassign (agent);
+  costs_.erase (costs_.begin () + agent);
+  agent_prices_.erase (agent_prices_.begin () + agent);
+  agent_slots_.erase (agent_slots_.begin () + agent);
+
+  for (size_t j = 0; j < size_; ++j)
+  {
+    if (slot_agents_[j] > (int)agent)
+      --slot_agents_[j];
+  }
+
+  // a dummy agent keeps the problem square
+  agent_prices_.push_back (0.0);
+  agent_slots_.push_back (UNASSIGNED);
+
+  shrink ();
+}
+
+void
+gams::utility::SlotAssignment::set_slot (size_t slot,
+  const std::vector<double> & costs)
+{
+  if (slot > slots_)
+    return;
+
+  if (slot == slots_)
+  {
+    if (slots_ == size_)
+      grow ();
+
+    ++slots_;
+
+    for (size_t i = 0; i < costs_.size (); ++i)
+    {
+      costs_[i].push_back (0.0);
+    }
+  }
+
+  for (size_t i = 0; i < costs_.size (); ++i)
+  {
+    costs_[i][slot] = i < costs.size () ? costs[i] : 0.0;
+  }
+
+  if (slot_agents_[slot] >= 0)
+    unassign ((size_t)slot_agents_[slot]);
+
+  reprice (slot);
+}
+
+void
+gams::utility::SlotAssignment::remove_slot (size_t slot)
+{
+  if (slot >= slots_)
+    return;
+
+  if (slot_agents_[slot] >= 0)
+    unassign ((size_t)slot_agents_[slot]);
+
+  for (size_t i = 0; i < costs_.size (); ++i)
+  {
+    costs_[i].erase (costs_[i].begin () + slot);
+  }
+  --slots_;
+
+  slot_prices_.erase (slot_prices_.begin () + slot);
+  slot_agents_.erase (slot_agents_.begin () + slot);
+
+  for (size_t i = 0; i < size_; ++i)
+  {
+    if (agent_slots_[i] > (int)slot)
+      --agent_slots_[i];
+  }
+
+  // a dummy slot keeps the problem square
+  slot_prices_.push_back (0.0);
+  slot_agents_.push_back (UNASSIGNED);
+  reprice (size_ - 1);
+
+  shrink ();
+}
+
+const std::vector<int> &
+gams::utility::SlotAssignment::solve (void)
+{
+  if (objective_ == MAKESPAN && threshold_ != INF)
+  {
+    // the last threshold no longer applies to changed costs
+    threshold_ = INF;
+    reset ();
+  }
+
+  for (size_t i = 0; i < size_; ++i)
+  {
+    if (agent_slots_[i] < 0)
+      augment (i);
+  }
+
+  if (objective_ == MAKESPAN && costs_.size () > 0 && slots_ > 0)
+  {
+    double makespan = 0;
+    for (size_t i = 0; i < costs_.size (); ++i)
+    {
+      if ((size_t)agent_slots_[i] < slots_)
+        makespan = std::max (makespan, costs_[i][agent_slots_[i]]);
+    }
+
+    double limit = find_makespan ();
+
+    if (limit < makespan)
+    {
+      // any assignment within the limit must beat any assignment over it
+      double largest = 0;
+      for (size_t i = 0; i < costs_.size (); ++i)
+      {
+        for (size_t j = 0; j < slots_; ++j)
+          largest = std::max (largest, costs_[i][j]);
+      }
+
+      threshold_ = limit;
+      penalty_ = (largest + 1) * size_;
+
+      reset ();
+      for (size_t i = 0; i < size_; ++i)
+        augment (i);
+    }
+  }
+
+  result_.resize (costs_.size ());
+  for (size_t i = 0; i < costs_.size (); ++i)
+  {
+    result_[i] = (size_t)agent_slots_[i] < slots_ ?
+      agent_slots_[i] : UNASSIGNED;
+  }
+
+  return result_;
+}
+
+const std::vector<int> &
+gams::utility::SlotAssignment::solve (
+  const std::vector<pose::Position> & agents,
+  const std::vector<pose::Position> & slots)
+{
+  Costs costs (agents.size (), std::vector<double> (slots.size ()));
+
+  for (size_t i = 0; i < agents.size (); ++i)
+  {
+    for (size_t j = 0; j < slots.size (); ++j)
+    {
+      costs[i][j] = agents[i].distance_to (slots[j]);
+    }
+  }
+
+  if (agents.size () == 0)
+  {
+    // keep the slot count, which an empty cost matrix cannot carry
+    clear ();
+    for (size_t j = 0; j < slots.size (); ++j)
+      set_slot (j, std::vector<double> ());
+  }
+  else
+  {
+    set_costs (costs);
+  }
+
+  return solve ();
+}
+
+size_t
+gams::utility::SlotAssignment::agents (void) const
+{
+  return costs_.size ();
+}
+
+size_t
+gams::utility::SlotAssignment::slots (void) const
+{
+  return slots_;
+}
+
+int
+gams::utility::SlotAssignment::get_slot (size_t agent) const
+{
+  return agent < result_.size () ? result_[agent] : UNASSIGNED;
+}
+
+int
+gams::utility::SlotAssignment::get_agent (size_t slot) const
+{
+  if (slot < slots_ && slot < slot_agents_.size () &&
+    slot_agents_[slot] >= 0 && (size_t)slot_agents_[slot] < result_.size ())
+  {
+    return slot_agents_[slot];
+  }
+
+  return UNASSIGNED;
+}
+
+double
+gams::utility::SlotAssignment::get_total (void) const
+{
+  double total = 0;
+  for (size_t i = 0; i < result_.size (); ++i)
+  {
+    if (result_[i] >= 0)
+      total += costs_[i][result_[i]];
+  }
+
+  return total;
+}
+
+double
+gams::utility::SlotAssignment::get_makespan (void) const
+{
+  double makespan = 0;
+  for (size_t i = 0; i < result_.size (); ++i)
+  {
+    if (result_[i] >= 0)
+      makespan = std::max (makespan, costs_[i][result_[i]]);
+  }
+
+  return makespan;
+}
+
+double
+gams::utility::SlotAssignment::cost (size_t agent, size_t slot) const
+{
+  if (agent < costs_.size () && slot < slots_)
+  {
+    double result = costs_[agent][slot];
+    return result > threshold_ ? result + penalty_ : result;
+  }
+
+  return 0;
+}
+
+void
+gams::utility::SlotAssignment::grow (void)
+{
+  ++size_;
+  agent_prices_.push_back (0.0);
+  agent_slots_.push_back (UNASSIGNED);
+  slot_prices_.push_back (0.0);
+  slot_agents_.push_back (UNASSIGNED);
+  reprice (size_ - 1);
+}
+
+void
+gams::utility::SlotAssignment::shrink (void)
+{
+  while (size_ > std::max (costs_.size (), slots_))
+  {
+    size_t last = size_ - 1;
+
+    unassign (last);
+    if (slot_agents_[last] >= 0)
+      unassign ((size_t)slot_agents_[last]);
+
+    agent_prices_.pop_back ();
+    agent_slots_.pop_back ();
+    slot_prices_.pop_back ();
+    slot_agents_.pop_back ();
+    --size_;
+  }
+}
+
+void
+gams::utility::SlotAssignment::unassign (size_t agent)
+{
+  int slot = agent_slots_[agent];
+  if (slot >= 0)
+  {
+    slot_agents_[slot] = UNASSIGNED;
+    agent_slots_[agent] = UNASSIGNED;
+  }
+}
+
+void
+gams::utility::SlotAssignment::reprice (size_t slot)
+{
+  double price = INF;
+  for (size_t i = 0; i < size_; ++i)
+  {
+    if (agent_slots_[i] >= 0)
+      price = std::min (price, cost (i, slot) - agent_prices_[i]);
+  }
+
+  slot_prices_[slot] = price == INF ? 0.0 : price;
+}
+
+void
+gams::utility::SlotAssignment::augment (size_t agent)
+{
+  min_slack_.assign (size_, INF);
+  way_.assign (size_, UNASSIGNED);
+  used_.assign (size_, 0);
+
+  // Dijkstra over reduced costs, from agent until a free slot is reached.
+  // way_ records the slot each slot was reached from (UNASSIGNED for the
+  // starting agent).
+  int slot = UNASSIGNED;
+  size_t current = agent;
+
+  for (;;)
+  {
+    double delta = INF;
+    int next = UNASSIGNED;
+
+    for (size_t j = 0; j < size_; ++j)
+    {
+      if (used_[j])
+        continue;
+
+      double slack = cost (current, j) -
+        agent_prices_[current] - slot_prices_[j];
+
+      if (slack < min_slack_[j])
+      {
+        min_slack_[j] = slack;
+        way_[j] = slot;
+      }
+
+      if (min_slack_[j] < delta)
+      {
+        delta = min_slack_[j];
+        next = (int)j;
+      }
+    }
+
+    agent_prices_[agent] += delta;
+    for (size_t j = 0; j < size_; ++j)
+    {
+      if (used_[j])
+      {
+        agent_prices_[slot_agents_[j]] += delta;
+        slot_prices_[j] -= delta;
+      }
+      else
+      {
+        min_slack_[j] -= delta;
+      }
+    }
+
+    used_[next] = 1;
+    slot = next;
+
+    if (slot_agents_[slot] < 0)
+      break;
+
+    current = (size_t)slot_agents_[slot];
+  }
+
+  // shift assignments back along the path
+  while (slot != UNASSIGNED)
+  {
+    int previous = way_[slot];
+    size_t owner = previous == UNASSIGNED ?
+      agent : (size_t)slot_agents_[previous];
+
+    slot_agents_[slot] = (int)owner;
+    agent_slots_[owner] = slot;
+    slot = previous;
+  }
+}
+
+void
+gams::utility::SlotAssignment::reset (void)
+{
+  agent_slots_.assign (size_, UNASSIGNED);
+  slot_agents_.assign (size_, UNASSIGNED);
+}
+
+double
+gams::utility::SlotAssignment::find_makespan (void)
+{
+  size_t agents = costs_.size ();
+
+  // every real agent (or slot, if fewer) must take at least its cheapest
+  double lower = 0;
+  if (agents <= slots_)
+  {
+    for (size_t i = 0; i < agents; ++i)
+    {
+      lower = std::max (lower,
+        *std::min_element (costs_[i].begin (), costs_[i].end ()));
+    }
+  }
+  if (slots_ <= agents)
+  {
+    for (size_t j = 0; j < slots_; ++j)
+    {
+      double cheapest = INF;
+      for (size_t i = 0; i < agents; ++i)
+        cheapest = std::min (cheapest, costs_[i][j]);
+      lower = std::max (lower, cheapest);
+    }
+  }
+
+  // the minimum total assignment is an upper bound
+  double upper = 0;
+  for (size_t i = 0; i < agents; ++i)
+  {
+    if ((size_t)agent_slots_[i] < slots_)
+      upper = std::max (upper, costs_[i][agent_slots_[i]]);
+  }
+
+  std::vector<double> candidates;
+  for (size_t i = 0; i < agents; ++i)
+  {
+    for (size_t j = 0; j < slots_; ++j)
+    {
+      if (costs_[i][j] >= lower && costs_[i][j] <= upper)
+        candidates.push_back (costs_[i][j]);
+    }
+  }
+
+  std::sort (candidates.begin (), candidates.end ());
+  candidates.erase (std::unique (candidates.begin (), candidates.end ()),
+    candidates.end ());
+
+  size_t needed = std::min (agents, slots_);
+  size_t low = 0, high = candidates.size () - 1;
+
+  while (low < high)
+  {
+    size_t middle = (low + high) / 2;
+
+    Matcher matcher (costs_, slots_, candidates[middle]);
+    for (size_t i = 0; i < agents; ++i)
+      matcher.seed (i, agent_slots_[i]);
+
+    if (matcher.match () == needed)
+      high = middle;
+    else
+      low = middle + 1;
+  }
+
+  return candidates[low];
+}
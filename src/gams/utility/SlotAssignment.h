@@ -0,0 +1,303 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file SlotAssignment.h
+ *
+ * This file contains the definition of an optimal agent to slot assignment
+ **/
+
+#ifndef   _GAMS_UTILITY_SLOT_ASSIGNMENT_H_
+#define   _GAMS_UTILITY_SLOT_ASSIGNMENT_H_
+
+#include <vector>
+
+#include "gams/GamsExport.h"
+#include "gams/pose/Position.h"
+
+namespace gams
+{
+  namespace utility
+  {
+    /**
+    * Assigns agents to slots, such as formation positions, so that the
+    * total cost (e.g., distance travelled) or the largest single cost is
+    * minimized. Solves with the Hungarian method, using shortest augmenting
+    * paths over an n x n problem padded with zero-cost dummy agents or
+    * slots, so agents and slots need not be equal in number.
+    *
+    * Changing one agent or slot is repaired with a single augmenting path,
+    * O(n^2), instead of a full O(n^3) solve. Re-solving over new costs of
+    * the same size starts from the previous slot prices, which are usually
+    * close, so the augmenting paths stay short.
+    *
+    * Solutions are optimal, so agents that solve over the same costs agree
+    * on the assignment unless two assignments cost exactly the same.
+    **/
+    class GAMS_EXPORT SlotAssignment
+    {
+    public:
+      /**
+       * What the assignment minimizes
+       **/
+      enum Objective
+      {
+        /// the sum of the costs of all assignments
+        TOTAL,
+        /// the largest cost of any one assignment, then the sum
+        MAKESPAN
+      };
+
+      /// cost of each agent (outer) for each slot (inner)
+      typedef std::vector<std::vector<double> > Costs;
+
+      /// value for an agent with no slot, or a slot with no agent
+      static const int UNASSIGNED = -1;
+
+      /**
+       * Constructor
+       * @param  objective  what the assignment minimizes
+       **/
+      SlotAssignment (Objective objective = TOTAL);
+
+      /**
+       * Destructor
+       **/
+      ~SlotAssignment ();
+
+      /**
+       * Sets what the assignment minimizes. Forces a full solve.
+       * @param  objective  what the assignment minimizes
+       **/
+      void set_objective (Objective objective);
+
+      /**
+       * Gets what the assignment minimizes
+       * @return the objective
+       **/
+      Objective get_objective (void) const;
+
+      /**
+       * Removes all agents and slots
+       **/
+      void clear (void);
+
+      /**
+       * Replaces all costs. The next solve reuses slot prices if the
+       * number of agents and slots is unchanged.
+       * @param  costs   costs[agent][slot], every agent with every slot
+       **/
+      void set_costs (const Costs & costs);
+
+      /**
+       * Replaces the costs of one agent, or adds an agent if agent is
+       * the number of agents
+       * @param  agent   index of the agent
+       * @param  costs   the agent's cost for each slot
+       **/
+      void set_agent (size_t agent, const std::vector<double> & costs);
+
+      /**
+       * Removes an agent. Agents after it move down one index.
+       * @param  agent   index of the agent
+       **/
+      void remove_agent (size_t agent);
+
+      /**
+       * Replaces the costs of one slot, or adds a slot if slot is the
+       * number of slots
+       * @param  slot    index of the slot
+       * @param  costs   each agent's cost for the slot
+       **/
+      void set_slot (size_t slot, const std::vector<double> & costs);
+
+      /**
+       * Removes a slot. Slots after it move down one index.
+       * @param  slot    index of the slot
+       **/
+      void remove_slot (size_t slot);
+
+      /**
+       * Assigns agents to slots, repairing only what changed since the
+       * last solve
+       * @return the slot of each agent, or UNASSIGNED
+       **/
+      const std::vector<int> & solve (void);
+
+      /**
+       * Assigns agents to slots by distance
+       * @param  agents  agent positions
+       * @param  slots   slot positions
+       * @return the slot of each agent, or UNASSIGNED
+       **/
+      const std::vector<int> & solve (
+        const std::vector<pose::Position> & agents,
+        const std::vector<pose::Position> & slots);
+
+      /**
+       * Gets the number of agents
+       * @return the number of agents
+       **/
+      size_t agents (void) const;
+
+      /**
+       * Gets the number of slots
+       * @return the number of slots
+       **/
+      size_t slots (void) const;
+
+      /**
+       * Gets the slot of an agent from the last solve
+       * @param  agent   index of the agent
+       * @return the slot, or UNASSIGNED
+       **/
+      int get_slot (size_t agent) const;
+
+      /**
+       * Gets the agent in a slot from the last solve
+       * @param  slot    index of the slot
+       * @return the agent, or UNASSIGNED
+       **/
+      int get_agent (size_t slot) const;
+
+      /**
+       * Gets the sum of the costs of the last solve
+       * @return the total cost
+       **/
+      double get_total (void) const;
+
+      /**
+       * Gets the largest cost of the last solve
+       * @return the makespan
+       **/
+      double get_makespan (void) const;
+
+    private:
+      /**
+       * Gets the solver's cost of an agent for a slot. Dummy agents and
+       * slots cost 0. Costs above threshold_ are penalized.
+       **/
+      double cost (size_t agent, size_t slot) const;
+
+      /**
+       * Grows the padded problem by one dummy agent and one dummy slot
+       **/
+      void grow (void);
+
+      /**
+       * Shrinks the padded problem while its last agent and slot are
+       * both dummies
+       **/
+      void shrink (void);
+
+      /**
+       * Unassigns an agent, freeing its slot
+       **/
+      void unassign (size_t agent);
+
+      /**
+       * Sets a slot's price so no assigned agent prefers it
+       **/
+      void reprice (size_t slot);
+
+      /**
+       * Assigns a free agent along a shortest augmenting path
+       **/
+      void augment (size_t agent);
+
+      /**
+       * Discards the assignment, keeping slot prices
+       **/
+      void reset (void);
+
+      /**
+       * Finds the least largest cost of a complete assignment
+       **/
+      double find_makespan (void);
+
+      /// what the assignment minimizes
+      Objective objective_;
+
+      /// cost of each agent for each slot
+      Costs costs_;
+
+      /// number of slots
+      size_t slots_;
+
+      /// size of the padded problem
+      size_t size_;
+
+      /// agent prices (Hungarian row potentials)
+      std::vector<double> agent_prices_;
+
+      /// slot prices (Hungarian column potentials)
+      std::vector<double> slot_prices_;
+
+      /// slot of each agent in the padded problem
+      std::vector<int> agent_slots_;
+
+      /// agent of each slot in the padded problem
+      std::vector<int> slot_agents_;
+
+      /// costs above this are penalized, for MAKESPAN
+      double threshold_;
+
+      /// added to costs above threshold_
+      double penalty_;
+
+      /// slot of each real agent, from the last solve
+      std::vector<int> result_;
+
+      /// scratch space for augment
+      std::vector<double> min_slack_;
+      std::vector<int> way_;
+      std::vector<char> used_;
+    };
+  }
+}
+
+#endif // _GAMS_UTILITY_SLOT_ASSIGNMENT_H_
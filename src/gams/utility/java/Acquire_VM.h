@@ -17,17 +17,63 @@ namespace gams
   {
     namespace java
     {
+      /**
+       * @class Detach_On_Exit
+       * @brief Detaches the calling thread from the VM when the thread
+       *        exits, for threads that Acquire_VM keeps attached
+       **/
+      class Detach_On_Exit
+      {
+      public:
+        Detach_On_Exit ()
+          : attached (false)
+        {
+        }
+
+        ~Detach_On_Exit ()
+        {
+          if (attached)
+            jni_detach ();
+        }
+
+        bool attached;
+      };
+
       /**
        * @class Acquire_VM
        * @brief This class encapsulates attaching and detaching to a VM
+       *
+       * Attaching a native thread is far more expensive than the JNI call
+       * that follows, so threads that call into Java repeatedly, e.g., a
+       * controller thread calling platform and algorithm methods every
+       * loop, should pass detach = false. The thread then stays attached
+       * after the first call and is detached when it exits. Builds without
+       * thread_local (MADARA_NO_THREAD_LOCAL) always detach.
        **/
       class Acquire_VM
       {
       public:
-        Acquire_VM ()
+        /**
+         * Constructor
+         * @param  detach  if true, detach on destruction if this attached
+         *                 the thread. If false, stay attached until the
+         *                 thread exits.
+         **/
+        Acquire_VM (bool detach = true)
         {
           needs_detach = !gams_jni_is_attached();
           env = gams_jni_get_env ();
+
+#ifndef MADARA_NO_THREAD_LOCAL
+          if (needs_detach && !detach)
+          {
+            static thread_local Detach_On_Exit on_exit;
+            on_exit.attached = env != 0;
+            needs_detach = false;
+          }
+#else
+          (void)detach;
+#endif
         }
 
         ~Acquire_VM()
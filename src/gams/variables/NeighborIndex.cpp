@@ -0,0 +1,479 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file NeighborIndex.cpp
+ *
+ * This file contains the implementation of a spatial index over agent
+ * locations
+ **/
+
+#include "NeighborIndex.h"
+
+#include <float.h>
+#include <algorithm>
+#include <cmath>
+
+#include "gams/pose/CartesianFrame.h"
+#include "gams/pose/GPSFrame.h"
+
+namespace
+{
+  /// upper bound on grid cells per indexed point
+  const size_t CELLS_PER_POINT = 2;
+
+  /// orders neighbors from nearest to furthest
+  bool nearer (
+    const gams::variables::NeighborIndex::Neighbor & lhs,
+    const gams::variables::NeighborIndex::Neighbor & rhs)
+  {
+    return lhs.distance < rhs.distance ||
+      (lhs.distance == rhs.distance && lhs.agent < rhs.agent);
+  }
+}
+
+const size_t gams::variables::NeighborIndex::NO_AGENT;
+
+gams::variables::NeighborIndex::NeighborIndex (const Agents * agents)
+  : agents_ (agents), swarm_view_ (0), frame_ (pose::gps_frame ()),
+    local_frame_ (pose::gps_frame ()), stale_ (true),
+    min_x_ (0), min_y_ (0), cell_ (1), cols_ (0), rows_ (0)
+{
+}
+
+gams::variables::NeighborIndex::~NeighborIndex ()
+{
+}
+
+void
+gams::variables::NeighborIndex::set_agents (const Agents * agents)
+{
+  agents_ = agents;
+  stale_ = true;
+}
+
+void
+gams::variables::NeighborIndex::set_swarm_view (SwarmView * swarm_view)
+{
+  swarm_view_ = swarm_view;
+  stale_ = true;
+}
+
+void
+gams::variables::NeighborIndex::set_frame (const pose::ReferenceFrame & frame)
+{
+  if (!(frame_ == frame))
+  {
+    frame_ = frame;
+    stale_ = true;
+  }
+}
+
+void
+gams::variables::NeighborIndex::invalidate (void)
+{
+  stale_ = true;
+}
+
+void
+gams::variables::NeighborIndex::update (void)
+{
+  if (!stale_)
+  {
+    return;
+  }
+
+  std::vector<pose::Position> positions;
+
+  if (swarm_view_)
+  {
+    swarm_view_->update ();
+    const SwarmView::Snapshot & snapshot = swarm_view_->get_snapshot ();
+
+    positions.reserve (swarm_view_->size ());
+
+    for (size_t i = 0; i < swarm_view_->size (); ++i)
+    {
+      pose::Position position (frame_, DBL_MAX, DBL_MAX, DBL_MAX);
+
+      if (snapshot.has_location[i])
+      {
+        position = pose::Position (frame_, snapshot.location_x[i],
+          snapshot.location_y[i], snapshot.location_z[i]);
+      }
+
+      positions.push_back (position);
+    }
+  }
+  else if (agents_)
+  {
+    positions.reserve (agents_->size ());
+
+    for (size_t i = 0; i < agents_->size (); ++i)
+    {
+      const Agent & agent = (*agents_)[i];
+      pose::Position position (frame_, DBL_MAX, DBL_MAX, DBL_MAX);
+
+      if (agent.location.size () >= 2)
+      {
+        position.from_container (agent.location);
+      }
+
+      positions.push_back (position);
+    }
+  }
+
+  build (positions);
+}
+
+void
+gams::variables::NeighborIndex::build (
+  const std::vector<pose::Position> & positions)
+{
+  points_.clear ();
+  point_agents_.clear ();
+  agent_points_.assign (positions.size (), NO_AGENT);
+
+  // GPS locations are indexed in meters, relative to the first location
+  local_frame_ = frame_;
+  for (size_t i = 0; i < positions.size (); ++i)
+  {
+    if (positions[i].x () != DBL_MAX)
+    {
+      local_frame_ = positions[i].frame ();
+      if (local_frame_.type () == pose::GPS)
+      {
+        local_frame_ = pose::ReferenceFrame (pose::Cartesian, positions[i]);
+      }
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < positions.size (); ++i)
+  {
+    if (positions[i].x () != DBL_MAX)
+    {
+      agent_points_[i] = points_.size ();
+      points_.push_back (to_local (positions[i]));
+      point_agents_.push_back (i);
+    }
+  }
+
+  build_grid ();
+  stale_ = false;
+}
+
+size_t
+gams::variables::NeighborIndex::size (void) const
+{
+  return points_.size ();
+}
+
+bool
+gams::variables::NeighborIndex::has_location (size_t agent) const
+{
+  return agent < agent_points_.size () && agent_points_[agent] != NO_AGENT;
+}
+
+gams::variables::NeighborIndex::Neighbors
+gams::variables::NeighborIndex::nearest (
+  const pose::Position & position, size_t k, size_t exclude) const
+{
+  return nearest (to_local (position), k, exclude);
+}
+
+gams::variables::NeighborIndex::Neighbors
+gams::variables::NeighborIndex::within (
+  const pose::Position & position, double radius, size_t exclude) const
+{
+  return within (to_local (position), radius, exclude);
+}
+
+gams::variables::NeighborIndex::Neighbors
+gams::variables::NeighborIndex::nearest (size_t agent, size_t k) const
+{
+  if (!has_location (agent))
+  {
+    return Neighbors ();
+  }
+
+  return nearest (points_[agent_points_[agent]], k, agent);
+}
+
+gams::variables::NeighborIndex::Neighbors
+gams::variables::NeighborIndex::within (size_t agent, double radius) const
+{
+  if (!has_location (agent))
+  {
+    return Neighbors ();
+  }
+
+  return within (points_[agent_points_[agent]], radius, agent);
+}
+
+gams::variables::NeighborIndex::Point
+gams::variables::NeighborIndex::to_local (
+  const pose::Position & position) const
+{
+  pose::Position local = position.transform_to (local_frame_);
+  Point point = {{local.x (), local.y (), local.z ()}};
+  return point;
+}
+
+void
+gams::variables::NeighborIndex::build_grid (void)
+{
+  const size_t num = points_.size ();
+
+  cols_ = rows_ = 0;
+  cell_offsets_.assign (1, 0);
+  cell_points_.clear ();
+
+  if (num == 0)
+  {
+    return;
+  }
+
+  double max_x = points_[0][0], max_y = points_[0][1];
+  min_x_ = max_x;
+  min_y_ = max_y;
+  for (size_t i = 1; i < num; ++i)
+  {
+    min_x_ = std::min (min_x_, points_[i][0]);
+    min_y_ = std::min (min_y_, points_[i][1]);
+    max_x = std::max (max_x, points_[i][0]);
+    max_y = std::max (max_y, points_[i][1]);
+  }
+
+  // square cells sized for about one point each if spread evenly,
+  // grown until the grid fits in CELLS_PER_POINT cells per point
+  const double width = std::max (max_x - min_x_, 1e-6);
+  const double height = std::max (max_y - min_y_, 1e-6);
+  cell_ = std::max (std::sqrt (width * height / num), 1e-6);
+  for (;;)
+  {
+    cols_ = (size_t)(width / cell_) + 1;
+    rows_ = (size_t)(height / cell_) + 1;
+    if (cols_ * rows_ <= CELLS_PER_POINT * num + 1)
+    {
+      break;
+    }
+    cell_ *= 1.5;
+  }
+
+  // first pass counts points per cell, second pass fills them in
+  cell_offsets_.assign (cols_ * rows_ + 1, 0);
+  for (size_t i = 0; i < num; ++i)
+  {
+    ++cell_offsets_[row (points_[i][1]) * cols_ + col (points_[i][0]) + 1];
+  }
+
+  for (size_t c = 1; c < cell_offsets_.size (); ++c)
+  {
+    cell_offsets_[c] += cell_offsets_[c - 1];
+  }
+
+  std::vector<size_t> cursor (cell_offsets_.begin (), cell_offsets_.end () - 1);
+  cell_points_.resize (num);
+  for (size_t i = 0; i < num; ++i)
+  {
+    cell_points_[cursor[row (points_[i][1]) * cols_ + col (points_[i][0])]++] = i;
+  }
+}
+
+size_t
+gams::variables::NeighborIndex::col (double x) const
+{
+  double c = std::floor ((x - min_x_) / cell_);
+  return c <= 0 ? 0 : std::min ((size_t)c, cols_ - 1);
+}
+
+size_t
+gams::variables::NeighborIndex::row (double y) const
+{
+  double r = std::floor ((y - min_y_) / cell_);
+  return r <= 0 ? 0 : std::min ((size_t)r, rows_ - 1);
+}
+
+gams::variables::NeighborIndex::Neighbors
+gams::variables::NeighborIndex::nearest (
+  const Point & point, size_t k, size_t exclude) const
+{
+  Neighbors ret_val;
+
+  if (k == 0 || points_.empty ())
+  {
+    return ret_val;
+  }
+
+  const long cx = (long)col (point[0]);
+  const long cy = (long)row (point[1]);
+  const long cols = (long)cols_;
+  const long rows = (long)rows_;
+
+  // ret_val is kept as a max-heap on distance while rings are searched
+  for (long r = 0; ; ++r)
+  {
+    const long x0 = cx - r, x1 = cx + r, y0 = cy - r, y1 = cy + r;
+
+    for (long y = std::max (y0, 0L); y <= std::min (y1, rows - 1); ++y)
+    {
+      // interior rows of the ring only have their two end cells
+      const long step = (y == y0 || y == y1) ? 1 : std::max (x1 - x0, 1L);
+
+      for (long x = x0; x <= x1; x += step)
+      {
+        if (x < 0 || x >= cols)
+        {
+          continue;
+        }
+
+        const size_t c = (size_t)(y * cols + x);
+        for (size_t p = cell_offsets_[c]; p < cell_offsets_[c + 1]; ++p)
+        {
+          const size_t i = cell_points_[p];
+          if (point_agents_[i] == exclude)
+          {
+            continue;
+          }
+
+          const double dx = points_[i][0] - point[0];
+          const double dy = points_[i][1] - point[1];
+          const double dz = points_[i][2] - point[2];
+          Neighbor neighbor = {point_agents_[i],
+            std::sqrt (dx * dx + dy * dy + dz * dz)};
+
+          if (ret_val.size () < k)
+          {
+            ret_val.push_back (neighbor);
+            std::push_heap (ret_val.begin (), ret_val.end (), nearer);
+          }
+          else if (nearer (neighbor, ret_val.front ()))
+          {
+            std::pop_heap (ret_val.begin (), ret_val.end (), nearer);
+            ret_val.back () = neighbor;
+            std::push_heap (ret_val.begin (), ret_val.end (), nearer);
+          }
+        }
+      }
+    }
+
+    // anything unsearched lies beyond a side of the ring not on the grid edge
+    const bool left = x0 > 0, right = x1 < cols - 1;
+    const bool bottom = y0 > 0, top = y1 < rows - 1;
+    if (!left && !right && !bottom && !top)
+    {
+      break;
+    }
+
+    if (ret_val.size () == k)
+    {
+      double bound = DBL_MAX;
+      if (left)
+        bound = std::min (bound, point[0] - (min_x_ + x0 * cell_));
+      if (right)
+        bound = std::min (bound, min_x_ + (x1 + 1) * cell_ - point[0]);
+      if (bottom)
+        bound = std::min (bound, point[1] - (min_y_ + y0 * cell_));
+      if (top)
+        bound = std::min (bound, min_y_ + (y1 + 1) * cell_ - point[1]);
+
+      if (ret_val.front ().distance <= bound)
+      {
+        break;
+      }
+    }
+  }
+
+  std::sort_heap (ret_val.begin (), ret_val.end (), nearer);
+  return ret_val;
+}
+
+gams::variables::NeighborIndex::Neighbors
+gams::variables::NeighborIndex::within (
+  const Point & point, double radius, size_t exclude) const
+{
+  Neighbors ret_val;
+
+  if (radius < 0 || points_.empty ())
+  {
+    return ret_val;
+  }
+
+  const size_t x0 = col (point[0] - radius), x1 = col (point[0] + radius);
+  const size_t y0 = row (point[1] - radius), y1 = row (point[1] + radius);
+
+  for (size_t y = y0; y <= y1; ++y)
+  {
+    for (size_t x = x0; x <= x1; ++x)
+    {
+      const size_t c = y * cols_ + x;
+      for (size_t p = cell_offsets_[c]; p < cell_offsets_[c + 1]; ++p)
+      {
+        const size_t i = cell_points_[p];
+        if (point_agents_[i] == exclude)
+        {
+          continue;
+        }
+
+        const double dx = points_[i][0] - point[0];
+        const double dy = points_[i][1] - point[1];
+        const double dz = points_[i][2] - point[2];
+        const double distance = std::sqrt (dx * dx + dy * dy + dz * dz);
+
+        if (distance <= radius)
+        {
+          Neighbor neighbor = {point_agents_[i], distance};
+          ret_val.push_back (neighbor);
+        }
+      }
+    }
+  }
+
+  std::sort (ret_val.begin (), ret_val.end (), nearer);
+  return ret_val;
+}
@@ -0,0 +1,277 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+
+/**
+ * @file NeighborIndex.h
+ *
+ * This file contains the definition of a spatial index over agent locations
+ **/
+
+#ifndef   _GAMS_VARIABLES_NEIGHBOR_INDEX_H_
+#define   _GAMS_VARIABLES_NEIGHBOR_INDEX_H_
+
+#include <array>
+#include <vector>
+
+#include "gams/GamsExport.h"
+#include "gams/pose/Position.h"
+#include "gams/pose/ReferenceFrame.h"
+#include "Agent.h"
+#include "SwarmView.h"
+
+namespace gams
+{
+  namespace variables
+  {
+    /**
+    * A uniform grid over the locations of a list of agents, for k-nearest
+    * and radius queries. Controllers keep one per control loop, mark it
+    * stale in monitor, and it is rebuilt at most once per loop, the first
+    * time an algorithm asks for it. Locations in a GPS frame are indexed
+    * in meters in a local Cartesian frame; other frames are used as is.
+    * Locations come from a SwarmView snapshot if one is set, which needs
+    * no agent containers, and otherwise from a list of agents.
+    **/
+    class GAMS_EXPORT NeighborIndex
+    {
+    public:
+      /**
+       * An agent found by a query
+       **/
+      struct Neighbor
+      {
+        /// index of the agent in the indexed list of agents
+        size_t agent;
+
+        /// distance from the query position, in meters
+        double distance;
+      };
+
+      /// neighbors, ordered from nearest to furthest
+      typedef std::vector<Neighbor> Neighbors;
+
+      /// value for an agent index that refers to no agent
+      static const size_t NO_AGENT = (size_t)-1;
+
+      /**
+       * Constructor
+       * @param  agents   agents to index
+       **/
+      NeighborIndex (const Agents * agents = 0);
+
+      /**
+       * Destructor
+       **/
+      ~NeighborIndex ();
+
+      /**
+       * Sets the agents to index. Marks the index stale.
+       * @param  agents   agents to index
+       **/
+      void set_agents (const Agents * agents);
+
+      /**
+       * Sets a view to read locations from instead of agent containers.
+       * Agent indices are the view's. Marks the index stale.
+       * @param  swarm_view   view of the agents to index, or 0 for none
+       **/
+      void set_swarm_view (SwarmView * swarm_view);
+
+      /**
+       * Sets the frame agent locations are stored in. Marks the index stale
+       * if the frame changed.
+       * @param  frame    frame of the agents' location containers
+       **/
+      void set_frame (const pose::ReferenceFrame & frame);
+
+      /**
+       * Marks the index stale, so the next update rebuilds it
+       **/
+      void invalidate (void);
+
+      /**
+       * Rebuilds the index from the agents' locations, if it is stale
+       **/
+      void update (void);
+
+      /**
+       * Rebuilds the index from a list of positions, where agent i is at
+       * positions[i]. Used when locations do not live in agent containers.
+       * @param  positions   agent positions, all in one frame
+       **/
+      void build (const std::vector<pose::Position> & positions);
+
+      /**
+       * Gets the number of agents with a location in the index
+       * @return number of indexed agents
+       **/
+      size_t size (void) const;
+
+      /**
+       * Checks if an agent had a location when the index was built
+       * @param  agent   index of the agent in the list of agents
+       * @return true if the agent is in the index
+       **/
+      bool has_location (size_t agent) const;
+
+      /**
+       * Finds the k agents nearest to a position
+       * @param  position  the query position, in any frame
+       * @param  k         the maximum number of agents to return
+       * @param  exclude   an agent to leave out, usually the caller
+       * @return up to k agents, nearest first
+       **/
+      Neighbors nearest (const pose::Position & position, size_t k,
+        size_t exclude = NO_AGENT) const;
+
+      /**
+       * Finds the agents within a distance of a position
+       * @param  position  the query position, in any frame
+       * @param  radius    the maximum distance, in meters
+       * @param  exclude   an agent to leave out, usually the caller
+       * @return agents within radius, nearest first
+       **/
+      Neighbors within (const pose::Position & position, double radius,
+        size_t exclude = NO_AGENT) const;
+
+      /**
+       * Finds the k agents nearest to an indexed agent, not counting itself
+       * @param  agent     index of the agent in the list of agents
+       * @param  k         the maximum number of agents to return
+       * @return up to k agents, nearest first
+       **/
+      Neighbors nearest (size_t agent, size_t k) const;
+
+      /**
+       * Finds the agents within a distance of an indexed agent, not
+       * counting itself
+       * @param  agent     index of the agent in the list of agents
+       * @param  radius    the maximum distance, in meters
+       * @return agents within radius, nearest first
+       **/
+      Neighbors within (size_t agent, double radius) const;
+
+    private:
+      /// a point in the local frame
+      typedef std::array<double, 3> Point;
+
+      /**
+       * Converts a position to a point in the local frame
+       **/
+      Point to_local (const pose::Position & position) const;
+
+      /**
+       * Indexes points_ into the grid
+       **/
+      void build_grid (void);
+
+      /**
+       * Gets the grid column of a local x, clamped to the grid
+       **/
+      size_t col (double x) const;
+
+      /**
+       * Gets the grid row of a local y, clamped to the grid
+       **/
+      size_t row (double y) const;
+
+      /**
+       * Finds the k points nearest to a local point
+       **/
+      Neighbors nearest (const Point & point, size_t k,
+        size_t exclude) const;
+
+      /**
+       * Finds the points within radius of a local point
+       **/
+      Neighbors within (const Point & point, double radius,
+        size_t exclude) const;
+
+      /// agents to index
+      const Agents * agents_;
+
+      /// view of the agents to index, used instead of agents_ if set
+      SwarmView * swarm_view_;
+
+      /// frame of the agents' locations
+      pose::ReferenceFrame frame_;
+
+      /// frame points are indexed in
+      pose::ReferenceFrame local_frame_;
+
+      /// true if the index must be rebuilt before use
+      bool stale_;
+
+      /// indexed points in the local frame
+      std::vector<Point> points_;
+
+      /// agent index of each point
+      std::vector<size_t> point_agents_;
+
+      /// point index of each agent, or NO_AGENT without a location
+      std::vector<size_t> agent_points_;
+
+      /// lower corner of the grid, in the local frame
+      double min_x_, min_y_;
+
+      /// side of a grid cell
+      double cell_;
+
+      /// grid dimensions
+      size_t cols_, rows_;
+
+      /// points of cell c are cell_points_[cell_offsets_[c]] up to
+      /// cell_points_[cell_offsets_[c+1]], cells stored row by row
+      std::vector<size_t> cell_offsets_;
+
+      /// point indices, grouped by cell
+      std::vector<size_t> cell_points_;
+    };
+  }
+}
+
+#endif // _GAMS_VARIABLES_NEIGHBOR_INDEX_H_
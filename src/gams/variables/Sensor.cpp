@@ -47,6 +47,10 @@
 #include "gams/variables/Sensor.h"
 
 #include <float.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <vector>
 #include <string>
@@ -59,14 +63,16 @@ using std::vector;
 typedef  madara::knowledge::KnowledgeRecord::Integer  Integer;
 
 gams::variables::Sensor::Sensor () :
-  knowledge_ (0), name_ ("")
+  knowledge_ (0), name_ (""), syncing_ (false), sync_period_ (0),
+  sync_quantum_ (1.0), sync_merge_ (MERGE_MAX), sync_sequence_ (0)
 {
 }
 
 gams::variables::Sensor::Sensor (const string & name,
   madara::knowledge::KnowledgeBase * knowledge,
   const double & range, const pose::Position & origin) :
-  knowledge_ (knowledge), name_ (name)
+  knowledge_ (knowledge), name_ (name), syncing_ (false), sync_period_ (0),
+  sync_quantum_ (1.0), sync_merge_ (MERGE_MAX), sync_sequence_ (0)
 {
   init_vars ();
 
@@ -90,6 +96,194 @@ gams::variables::Sensor::operator= (const Sensor & rhs)
     this->origin_ = rhs.origin_;
     this->knowledge_ = rhs.knowledge_;
     this->name_ = rhs.name_;
+    this->syncing_ = rhs.syncing_;
+    this->sync_key_ = rhs.sync_key_;
+    this->sync_period_ = rhs.sync_period_;
+    this->sync_quantum_ = rhs.sync_quantum_;
+    this->sync_merge_ = rhs.sync_merge_;
+    this->sync_sequence_ = rhs.sync_sequence_;
+    this->next_publish_ = rhs.next_publish_;
+    this->pending_ = rhs.pending_;
+    this->merged_ = rhs.merged_;
+  }
+}
+
+namespace
+{
+  /**
+   * An edge of a region as a line in lat/lng space, built the same way as
+   * the edges Region::contains tests against
+   **/
+  struct RasterEdge
+  {
+    double min_lng;
+    double max_lng;
+    double min_lat;
+    double max_lat;
+    double lng;
+    double lat;
+    double slope;
+  };
+
+  /// margin, in degrees, past which rounding cannot flip an edge test
+  const double RASTER_MARGIN = 1e-9;
+
+  /**
+   * A delta record is an integer array of SYNC_HEADER values (sequence,
+   * quantum as the bits of a double, cell count and byte count) followed
+   * by a byte stream packed 8 bytes to an integer. A run is a set of
+   * cells with the same index x and consecutive index y. The stream holds
+   * each run as its x relative to the last run's, its first y relative to
+   * where the last run with the same x ended (or to 0 for a new x), and
+   * its length, then each value as the difference from the last one.
+   * Every number is a zigzag varint, so small differences take a byte.
+   **/
+  const size_t SYNC_HEADER = 4;
+
+  inline uint64_t
+  zigzag (int64_t value)
+  {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+  }
+
+  inline int64_t
+  unzigzag (uint64_t value)
+  {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+  }
+
+  void
+  put_varint (std::vector<unsigned char> & bytes, uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      bytes.push_back ((unsigned char)(value | 0x80));
+      value >>= 7;
+    }
+    bytes.push_back ((unsigned char)value);
+  }
+
+  bool
+  get_varint (const std::vector<unsigned char> & bytes, size_t & pos,
+    uint64_t & value)
+  {
+    value = 0;
+    for (int shift = 0; pos < bytes.size () && shift < 64; shift += 7)
+    {
+      unsigned char byte = bytes[pos++];
+      value |= (uint64_t)(byte & 0x7f) << shift;
+
+      if ((byte & 0x80) == 0)
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * Marks which cells of one row lie inside a region, with the same
+   * result as calling Region::contains on each cell.
+   *
+   * pnpoly toggles a point's parity for each edge whose longitude span
+   * holds the point and whose line passes north of it. An edge wholly
+   * north of the row toggles a contiguous range of cells, and an edge
+   * wholly south of it toggles none, so only edges crossing the row's
+   * latitude band are tested cell by cell.
+   **/
+  void rasterize_row (
+    const std::vector<RasterEdge> & edges,
+    const std::vector<std::array<double, 3>> & vertices,
+    const double bounds[4],
+    const std::vector<double> & lats,
+    const std::vector<double> & lngs,
+    const std::vector<double> & alts,
+    std::vector<unsigned char> & inside)
+  {
+    const size_t count = lats.size ();
+    inside.assign (count + 1, 0);
+
+    if (count == 0)
+    {
+      return;
+    }
+
+    // cells are swept by longitude, which only holds if it rises along the row
+    const bool sorted = std::is_sorted (lngs.begin (), lngs.end ());
+
+    const double row_min_lat = *std::min_element (lats.begin (), lats.end ());
+    const double row_max_lat = *std::max_element (lats.begin (), lats.end ());
+
+    // inside holds parity toggles here, and parity after the prefix xor
+    for (size_t e = 0; e < edges.size (); ++e)
+    {
+      const RasterEdge & edge = edges[e];
+
+      if (edge.max_lat < row_min_lat - RASTER_MARGIN)
+      {
+        continue;
+      }
+
+      if (!sorted)
+      {
+        for (size_t c = 0; c < count; ++c)
+        {
+          if (edge.min_lng <= lngs[c] && lngs[c] < edge.max_lng &&
+            lats[c] < edge.slope * (lngs[c] - edge.lng) + edge.lat)
+          {
+            inside[c] ^= 1;
+            inside[c + 1] ^= 1;
+          }
+        }
+        continue;
+      }
+
+      const size_t first = std::lower_bound (
+        lngs.begin (), lngs.end (), edge.min_lng) - lngs.begin ();
+      const size_t last = std::lower_bound (
+        lngs.begin () + first, lngs.end (), edge.max_lng) - lngs.begin ();
+
+      if (first == last)
+      {
+        continue;
+      }
+
+      if (edge.min_lat > row_max_lat + RASTER_MARGIN)
+      {
+        inside[first] ^= 1;
+        inside[last] ^= 1;
+        continue;
+      }
+
+      for (size_t c = first; c < last; ++c)
+      {
+        if (lats[c] < edge.slope * (lngs[c] - edge.lng) + edge.lat)
+        {
+          inside[c] ^= 1;
+          inside[c + 1] ^= 1;
+        }
+      }
+    }
+
+    unsigned char parity = 0;
+    for (size_t c = 0; c < count; ++c)
+    {
+      parity ^= inside[c];
+      inside[c] = parity &&
+        lats[c] >= bounds[0] && lats[c] <= bounds[1] &&
+        lngs[c] >= bounds[2] && lngs[c] <= bounds[3];
+    }
+
+    // a cell landing exactly on a vertex is inside, as in Region::contains
+    for (size_t c = 0; c < count; ++c)
+    {
+      if (!inside[c] &&
+        lats[c] >= bounds[0] && lats[c] <= bounds[1] &&
+        lngs[c] >= bounds[2] && lngs[c] <= bounds[3])
+      {
+        const std::array<double, 3> point = {{lngs[c], lats[c], alts[c]}};
+        inside[c] = std::binary_search (
+          vertices.begin (), vertices.end (), point);
+      }
+    }
   }
 }
 
@@ -99,6 +293,42 @@ gams::variables::Sensor::discretize (
 {
   set<pose::Position> ret_val;
 
+  pose::Position start_index;
+  const IndexRuns runs = rasterize (region, start_index);
+
+  for (size_t i = 0; i < runs.size (); ++i)
+  {
+    pose::Position pos = start_index;
+    pos.x(runs[i].x);
+    for (int y = runs[i].y_begin; y < runs[i].y_end; ++y)
+    {
+      pos.y(y);
+      ret_val.insert (pos);
+    }
+  }
+
+  return ret_val;
+}
+
+gams::variables::Sensor::IndexRuns
+gams::variables::Sensor::rasterize (
+  const pose::Region & region)
+{
+  pose::Position start_index;
+  return rasterize (region, start_index);
+}
+
+gams::variables::Sensor::IndexRuns
+gams::variables::Sensor::rasterize (
+  const pose::Region & region, pose::Position & start_index)
+{
+  IndexRuns ret_val;
+
+  if (region.vertices.empty ())
+  {
+    return ret_val;
+  }
+
   // find northern most point
   pose::Position northern = region.vertices[0];
   for (size_t i = 1; i < region.vertices.size (); ++i)
@@ -121,7 +351,7 @@ gams::variables::Sensor::discretize (
       start = region.vertices[i];
 
   // find valid corresponding position
-  pose::Position start_index = get_index_from_gps (start);
+  start_index = get_index_from_gps (start);
   if (!region.contains (get_gps_from_index (start_index)))
   {
     start_index.y(start_index.y() + 1); // go one east...
@@ -155,20 +385,105 @@ gams::variables::Sensor::discretize (
       eastern = region.vertices[i];
   const int max_y = (int)get_index_from_gps (eastern).y();
 
-  // move east each iteration
-  while (start_index.y() < max_y)
+  // rows are swept north and south from the start row, columns from the
+  // start column east up to (but not including) the eastern most point
+  const int start_x = (int)start_index.x();
+  const int start_y = (int)start_index.y();
+  const bool north = start_x <= max_x;
+  const bool south = start_x >= min_x;
+  if ((!north && !south) || start_y >= max_y)
   {
-    // check north
-    for (pose::Position pos = start_index; pos.x() <= max_x; pos.x(pos.x() + 1))
-      if (region.contains (get_gps_from_index (pos)))
-        ret_val.insert (pos);
-  
-    // check south
-    for (pose::Position pos = start_index; pos.x() >= min_x; pos.x(pos.x() - 1))
-      if (region.contains (get_gps_from_index (pos)))
-        ret_val.insert (pos);
-
-    start_index.y(start_index.y() + 1);
+    return ret_val;
+  }
+  const int row_begin = south ? min_x : start_x;
+  const int row_end = north ? max_x : start_x;
+
+  // edges, bounding box and vertices exactly as Region::contains sees them
+  const vector<pose::Position> & vertices = region.vertices;
+  const size_t num = vertices.size ();
+  vector<RasterEdge> edges;
+  edges.reserve (num);
+  for (size_t i = 0, j = num - 1; i < num; j = i++)
+  {
+    const double lng_i = vertices[i].longitude ();
+    const double lng_j = vertices[j].longitude ();
+    if (lng_i == lng_j)
+    {
+      continue;
+    }
+
+    const double lat_i = vertices[i].latitude ();
+    const double lat_j = vertices[j].latitude ();
+
+    RasterEdge edge;
+    edge.min_lng = std::min (lng_i, lng_j);
+    edge.max_lng = std::max (lng_i, lng_j);
+    edge.min_lat = std::min (lat_i, lat_j);
+    edge.max_lat = std::max (lat_i, lat_j);
+    edge.lng = lng_i;
+    edge.lat = lat_i;
+    edge.slope = (lat_j - lat_i) / (lng_j - lng_i);
+    edges.push_back (edge);
+  }
+
+  const pose::Region bounding_box = region.get_bounding_box ();
+  const double bounds[4] = {
+    bounding_box.vertices[0].latitude (), bounding_box.vertices[2].latitude (),
+    bounding_box.vertices[0].longitude (), bounding_box.vertices[2].longitude ()
+  };
+
+  const pose::ReferenceFrame & gps = pose::gps_frame ();
+  vector<std::array<double, 3>> gps_vertices;
+  for (size_t i = 0; i < num; ++i)
+  {
+    if (vertices[i].frame () == gps)
+    {
+      gps_vertices.push_back (std::array<double, 3> {{
+        vertices[i].longitude (), vertices[i].latitude (), vertices[i].z ()}});
+    }
+  }
+  std::sort (gps_vertices.begin (), gps_vertices.end ());
+
+  // the local frame only depends on the origin, so build it once
+  const double discretize = get_discretization ();
+  regenerate_local_frame ();
+  const int z = int(start_index.z());
+
+  const size_t count = (size_t)(max_y - start_y);
+  vector<double> lats (count), lngs (count), alts (count);
+  vector<unsigned char> inside;
+
+  for (int x = row_begin; x <= row_end; ++x)
+  {
+    for (size_t c = 0; c < count; ++c)
+    {
+      pose::Position meters (local_frame_,
+        x * discretize, (start_y + (int)c) * discretize, z);
+      pose::Position cell = meters.transform_to (gps);
+      lats[c] = cell.latitude ();
+      lngs[c] = cell.longitude ();
+      alts[c] = cell.z ();
+    }
+
+    rasterize_row (edges, gps_vertices, bounds, lats, lngs, alts, inside);
+
+    for (size_t c = 0; c < count; ++c)
+    {
+      if (inside[c])
+      {
+        const size_t begin = c;
+        while (c < count && inside[c])
+        {
+          ++c;
+        }
+
+        IndexRun run;
+        run.x = x;
+        run.y_begin = start_y + (int)begin;
+        run.y_end = start_y + (int)c;
+        ret_val.push_back (run);
+      }
+    }
   }
 
   return ret_val;
@@ -272,8 +587,228 @@ gams::variables::Sensor::set_value (const pose::Position & pos,
   const double & val,
   const madara::knowledge::KnowledgeUpdateSettings & settings)
 {
-  string idx = index_pos_to_index (get_index_from_gps(pos));
-  value_.set (idx, val, settings);
+  pose::Position index = get_index_from_gps(pos);
+  string idx = index_pos_to_index (index);
+
+  if (syncing_ && !settings.treat_globals_as_locals)
+  {
+    // the change goes out with the next batch, not as its own record
+    madara::knowledge::KnowledgeUpdateSettings local (settings);
+    local.treat_globals_as_locals = true;
+
+    value_.set (idx, val, local);
+    pending_[Cell ((int)index.x (), (int)index.y ())] = val;
+  }
+  else
+  {
+    value_.set (idx, val, settings);
+  }
+}
+
+void
+gams::variables::Sensor::enable_sync (const std::string & id, double period,
+  double quantum, int merge)
+{
+  syncing_ = true;
+  sync_key_ = "sensor." + name_ + ".delta." + id;
+  sync_period_ = period;
+  sync_quantum_ = quantum > 0 ? quantum : 1.0;
+  sync_merge_ = merge;
+  next_publish_ = std::chrono::steady_clock::now ();
+}
+
+void
+gams::variables::Sensor::disable_sync (void)
+{
+  if (syncing_)
+  {
+    publish ();
+    syncing_ = false;
+  }
+}
+
+bool
+gams::variables::Sensor::is_syncing (void) const
+{
+  return syncing_;
+}
+
+size_t
+gams::variables::Sensor::get_pending (void) const
+{
+  return pending_.size ();
+}
+
+size_t
+gams::variables::Sensor::sync (bool force)
+{
+  if (!syncing_)
+    return 0;
+
+  std::chrono::steady_clock::time_point now =
+    std::chrono::steady_clock::now ();
+
+  if (force || now >= next_publish_)
+  {
+    publish ();
+    next_publish_ = now +
+      std::chrono::duration_cast<std::chrono::steady_clock::duration> (
+        std::chrono::duration<double> (sync_period_));
+  }
+
+  return merge ();
+}
+
+size_t
+gams::variables::Sensor::publish (
+  const madara::knowledge::KnowledgeUpdateSettings & settings)
+{
+  if (!knowledge_ || !syncing_ || pending_.empty ())
+    return 0;
+
+  std::vector<unsigned char> bytes;
+  int last_x = 0;
+  int last_end = 0;
+  int64_t last_value = 0;
+
+  std::map<Cell, double>::const_iterator i = pending_.begin ();
+  while (i != pending_.end ())
+  {
+    // a run is consecutive y at one x
+    int x = i->first.first;
+    int y = i->first.second;
+    int length = 0;
+
+    std::map<Cell, double>::const_iterator run_end = i;
+    do
+    {
+      ++run_end;
+      ++length;
+    } while (run_end != pending_.end () && run_end->first.first == x &&
+      run_end->first.second == y + length);
+
+    if (x != last_x)
+      last_end = 0;
+
+    put_varint (bytes, zigzag ((int64_t)x - last_x));
+    put_varint (bytes, zigzag ((int64_t)y - last_end));
+    put_varint (bytes, (uint64_t)length);
+
+    for (; i != run_end; ++i)
+    {
+      int64_t value = (int64_t)std::llround (i->second / sync_quantum_);
+      put_varint (bytes, zigzag (value - last_value));
+      last_value = value;
+    }
+
+    last_x = x;
+    last_end = y + length;
+  }
+
+  std::vector<uint64_t> words (SYNC_HEADER + (bytes.size () + 7) / 8, 0);
+  words[0] = (uint64_t)++sync_sequence_;
+  std::memcpy (&words[1], &sync_quantum_, sizeof (double));
+  words[2] = pending_.size ();
+  words[3] = bytes.size ();
+
+  for (size_t b = 0; b < bytes.size (); ++b)
+  {
+    words[SYNC_HEADER + b / 8] |= (uint64_t)bytes[b] << (8 * (b % 8));
+  }
+
+  std::vector<Integer> record (words.begin (), words.end ());
+  knowledge_->set (sync_key_, record, settings);
+
+  pending_.clear ();
+
+  return record.size () * sizeof (Integer);
+}
+
+size_t
+gams::variables::Sensor::merge (void)
+{
+  if (!knowledge_ || !syncing_)
+    return 0;
+
+  static const madara::knowledge::KnowledgeUpdateSettings LOCAL (true);
+
+  size_t changed (0);
+  madara::knowledge::KnowledgeMap records =
+    knowledge_->to_map ("sensor." + name_ + ".delta.");
+
+  for (madara::knowledge::KnowledgeMap::const_iterator record =
+    records.begin (); record != records.end (); ++record)
+  {
+    if (record->first == sync_key_)
+      continue;
+
+    std::vector<Integer> words (record->second.to_integers ());
+    if (words.size () < SYNC_HEADER)
+      continue;
+
+    // a record is merged once, no matter how often it is read
+    Integer & last = merged_[record->first];
+    if (words[0] == last)
+      continue;
+    last = words[0];
+
+    double quantum;
+    std::memcpy (&quantum, &words[1], sizeof (double));
+    size_t cells = (size_t)words[2];
+    size_t size = (size_t)words[3];
+
+    if (size > (words.size () - SYNC_HEADER) * 8)
+      continue;
+
+    std::vector<unsigned char> bytes (size);
+    for (size_t b = 0; b < size; ++b)
+    {
+      bytes[b] = (unsigned char)(
+        (uint64_t)words[SYNC_HEADER + b / 8] >> (8 * (b % 8)));
+    }
+
+    size_t pos = 0;
+    int64_t x = 0;
+    int64_t last_end = 0;
+    int64_t value = 0;
+    uint64_t dx, dy, length, dv;
+
+    while (cells > 0 && get_varint (bytes, pos, dx) &&
+      get_varint (bytes, pos, dy) && get_varint (bytes, pos, length))
+    {
+      if (unzigzag (dx) != 0)
+        last_end = 0;
+      x += unzigzag (dx);
+      int64_t y = last_end + unzigzag (dy);
+
+      for (uint64_t j = 0; j < length && cells > 0; ++j, --cells)
+      {
+        if (!get_varint (bytes, pos, dv))
+        {
+          cells = 0;
+          break;
+        }
+        value += unzigzag (dv);
+
+        std::stringstream buffer;
+        buffer << x << "x" << (y + (int64_t)j);
+        const std::string idx = buffer.str ();
+
+        double received = value * quantum;
+        if (!value_.exists (idx) || (sync_merge_ == MERGE_MIN ?
+          received < value_[idx].to_double () :
+          received > value_[idx].to_double ()))
+        {
+          value_.set (idx, received, LOCAL);
+          ++changed;
+        }
+      }
+
+      last_end = y + (int64_t)length;
+    }
+  }
+
+  return changed;
 }
 
 string
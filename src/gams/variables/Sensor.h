@@ -57,6 +57,8 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <chrono>
+#include <utility>
 
 #include "gams/GamsExport.h"
 #include "madara/knowledge/containers/Double.h"
@@ -80,6 +82,36 @@ namespace gams
     class GAMS_EXPORT Sensor
     {
     public:
+      /**
+       * A run of consecutive index positions in one row of the sensor map
+       **/
+      struct IndexRun
+      {
+        /// row (index x) of the run
+        int x;
+
+        /// first column (index y) of the run
+        int y_begin;
+
+        /// one past the last column of the run
+        int y_end;
+      };
+
+      /// runs of index positions, ordered by row and then by column
+      typedef std::vector<IndexRun> IndexRuns;
+
+      /**
+       * How a cell received from another agent combines with the local
+       * value of the cell
+       **/
+      enum MergeTypes
+      {
+        /// keep the larger value, e.g., the time a cell was last seen
+        MERGE_MAX = 0,
+        /// keep the smaller value, e.g., the time since a cell was seen
+        MERGE_MIN = 1
+      };
+
       /**
        * Constructor
        **/
@@ -119,6 +151,17 @@ namespace gams
        **/
       set<pose::Position> discretize (
         const pose::SearchArea & area);
+
+      /**
+       * Rasterizes a region into runs of index positions inside it. This
+       * visits the same cells as discretize and gives the same result, but
+       * sweeps each row once for edge crossings instead of testing every
+       * cell against the whole polygon. Rows do not depend on each other.
+       * @param region  region to rasterize
+       * @return runs of index positions considered inside region
+       **/
+      IndexRuns rasterize (
+        const pose::Region & region);
       
       /**
        * Get the length of the side of each discretized cell
@@ -188,6 +231,67 @@ namespace gams
       void set_value (const pose::Position& pos, const double& val,
         const madara::knowledge::KnowledgeUpdateSettings& settings =
           madara::knowledge::KnowledgeUpdateSettings());
+
+      /**
+       * Shares changed cells in batches instead of one record per cell.
+       * While syncing, set_value only changes the local map and remembers
+       * the cell. Each period, sync publishes the changed cells as one
+       * record, sensor.{name}.delta.{id}, with runs of cells and values
+       * quantized to integers. It also merges the records of other agents
+       * into the local map.
+       *
+       * A cell is only sent in the period it changed, so an agent that
+       * misses a record or joins late does not see the cells in it until
+       * they change again.
+       * @param id        unique identifier of this agent, e.g., its id
+       * @param period    seconds between publications
+       * @param quantum   resolution of the values that are sent
+       * @param merge     how received values combine. @see MergeTypes
+       **/
+      void enable_sync (const std::string & id, double period,
+        double quantum = 1.0, int merge = MERGE_MAX);
+
+      /**
+       * Stops batching. Cells are again shared one record per cell.
+       **/
+      void disable_sync (void);
+
+      /**
+       * Checks if changed cells are shared in batches
+       * @return true if enable_sync has been called
+       **/
+      bool is_syncing (void) const;
+
+      /**
+       * Gets the number of changed cells that have not been published
+       * @return the number of pending cells
+       **/
+      size_t get_pending (void) const;
+
+      /**
+       * Publishes the pending cells once the period has elapsed, and
+       * merges the cells other agents have published
+       * @param force     if true, publish even if the period has not
+       *                  elapsed
+       * @return the number of local cells changed by the merge
+       **/
+      size_t sync (bool force = false);
+
+      /**
+       * Publishes the pending cells as one record
+       * @param settings  settings to use for mutating the record
+       * @return the size of the record's value in bytes
+       **/
+      size_t publish (
+        const madara::knowledge::KnowledgeUpdateSettings& settings =
+          madara::knowledge::KnowledgeUpdateSettings());
+
+      /**
+       * Merges the cells published by other agents into the local map
+       * @return the number of local cells changed
+       **/
+      size_t merge (void);
+
       /**
        * Initializes the variables
        * @param name      name of the sensor
@@ -208,6 +312,16 @@ namespace gams
        **/
       std::string index_pos_to_index (const pose::Position& pos) const;
 
+      /**
+       * Rasterizes a region into runs of index positions inside it
+       * @param region       region to rasterize
+       * @param start_index  set to the index position the sweep starts
+       *                     from; its frame and z are shared by every cell
+       * @return runs of index positions considered inside region
+       **/
+      IndexRuns rasterize (const pose::Region & region,
+        pose::Position & start_index);
+
       void regenerate_local_frame (void);
 
       /**
@@ -232,6 +346,37 @@ namespace gams
 
       /// local cartesian frame
       pose::ReferenceFrame local_frame_;
+
+      /// a cell of the sensor map as (index x, index y)
+      typedef std::pair<int, int> Cell;
+
+      /// if true, changes are batched. @see enable_sync
+      bool syncing_;
+
+      /// the key this agent publishes its changes to
+      std::string sync_key_;
+
+      /// seconds between publications
+      double sync_period_;
+
+      /// resolution of published values
+      double sync_quantum_;
+
+      /// how received values combine with local ones
+      int sync_merge_;
+
+      /// the number of records this agent has published
+      madara::knowledge::KnowledgeRecord::Integer sync_sequence_;
+
+      /// when the next publication is due
+      std::chrono::steady_clock::time_point next_publish_;
+
+      /// cells changed since the last publication, in run order
+      std::map<Cell, double> pending_;
+
+      /// the last sequence merged from each other agent's key
+      std::map<std::string,
+        madara::knowledge::KnowledgeRecord::Integer> merged_;
     };
 
     /// a map of sensor names to the sensor information
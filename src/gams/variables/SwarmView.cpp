@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file SwarmView.cpp
+ *
+ * This file contains the implementation of a lazily bound view of swarm
+ * state
+ **/
+
+#include "SwarmView.h"
+
+#include <sstream>
+
+namespace knowledge = madara::knowledge;
+
+namespace
+{
+  /**
+   * Reads up to three components of an array record
+   * @return true if the record held at least two components
+   **/
+  bool read_triple (const knowledge::KnowledgeRecord & record,
+    double & x, double & y, double & z)
+  {
+    const size_t size = record.size ();
+
+    if (record.is_array_type () && size >= 2)
+    {
+      x = record.retrieve_index (0).to_double ();
+      y = record.retrieve_index (1).to_double ();
+      z = size >= 3 ? record.retrieve_index (2).to_double () : 0.0;
+      return true;
+    }
+
+    x = y = z = 0.0;
+    return false;
+  }
+}
+
+gams::variables::SwarmView::SwarmView ()
+  : knowledge_ (0), fields_bound_ (false), stale_ (true)
+{
+}
+
+gams::variables::SwarmView::~SwarmView ()
+{
+}
+
+void
+gams::variables::SwarmView::set_agents (
+  knowledge::KnowledgeBase & knowledge,
+  const std::vector<std::string> & prefixes)
+{
+  knowledge_ = &knowledge;
+  prefixes_ = prefixes;
+
+  agents_.clear ();
+  agents_.resize (prefixes_.size ());
+
+  fields_bound_ = false;
+  stale_ = true;
+}
+
+void
+gams::variables::SwarmView::set_agents (
+  knowledge::KnowledgeBase & knowledge, size_t processes)
+{
+  std::vector<std::string> prefixes (processes);
+
+  for (size_t i = 0; i < processes; ++i)
+  {
+    std::stringstream buffer;
+    buffer << "agent." << i;
+    prefixes[i] = buffer.str ();
+  }
+
+  set_agents (knowledge, prefixes);
+}
+
+size_t
+gams::variables::SwarmView::size (void) const
+{
+  return prefixes_.size ();
+}
+
+const std::string &
+gams::variables::SwarmView::get_prefix (size_t agent) const
+{
+  return prefixes_[agent];
+}
+
+gams::variables::Agent &
+gams::variables::SwarmView::get_agent (size_t agent)
+{
+  if (!agents_[agent])
+  {
+    agents_[agent].reset (new Agent ());
+
+    if (knowledge_)
+    {
+      agents_[agent]->init_vars (*knowledge_, prefixes_[agent]);
+    }
+  }
+
+  return *agents_[agent];
+}
+
+bool
+gams::variables::SwarmView::is_bound (size_t agent) const
+{
+  return agent < agents_.size () && agents_[agent];
+}
+
+void
+gams::variables::SwarmView::invalidate (void)
+{
+  stale_ = true;
+}
+
+void
+gams::variables::SwarmView::update (void)
+{
+  if (stale_)
+  {
+    refresh ();
+  }
+}
+
+void
+gams::variables::SwarmView::bind_fields (void)
+{
+  const size_t num = prefixes_.size ();
+
+  location_refs_.resize (num);
+  velocity_refs_.resize (num);
+  battery_refs_.resize (num);
+  mobile_refs_.resize (num);
+
+  // the same variables Agent::init_vars binds
+  for (size_t i = 0; i < num; ++i)
+  {
+    location_refs_[i] = knowledge_->get_ref (prefixes_[i] + ".location");
+    velocity_refs_[i] = knowledge_->get_ref (prefixes_[i] + ".velocity");
+    battery_refs_[i] = knowledge_->get_ref (prefixes_[i] + ".battery");
+    mobile_refs_[i] = knowledge_->get_ref (prefixes_[i] + ".mobile");
+  }
+
+  fields_bound_ = true;
+}
+
+void
+gams::variables::SwarmView::refresh (void)
+{
+  const size_t num = prefixes_.size ();
+
+  snapshot_.location_x.resize (num);
+  snapshot_.location_y.resize (num);
+  snapshot_.location_z.resize (num);
+  snapshot_.velocity_x.resize (num);
+  snapshot_.velocity_y.resize (num);
+  snapshot_.velocity_z.resize (num);
+  snapshot_.battery.resize (num);
+  snapshot_.mobile.resize (num);
+  snapshot_.has_location.resize (num);
+  snapshot_.has_velocity.resize (num);
+
+  if (knowledge_)
+  {
+    knowledge::ContextGuard guard (*knowledge_);
+
+    if (!fields_bound_)
+    {
+      bind_fields ();
+    }
+
+    for (size_t i = 0; i < num; ++i)
+    {
+      snapshot_.has_location[i] = read_triple (
+        knowledge_->get (location_refs_[i]), snapshot_.location_x[i],
+        snapshot_.location_y[i], snapshot_.location_z[i]) ? 1 : 0;
+
+      snapshot_.has_velocity[i] = read_triple (
+        knowledge_->get (velocity_refs_[i]), snapshot_.velocity_x[i],
+        snapshot_.velocity_y[i], snapshot_.velocity_z[i]) ? 1 : 0;
+
+      snapshot_.battery[i] = knowledge_->get (battery_refs_[i]).to_integer ();
+      snapshot_.mobile[i] =
+        knowledge_->get (mobile_refs_[i]).to_integer () != 0 ? 1 : 0;
+    }
+  }
+
+  stale_ = false;
+}
+
+const gams::variables::SwarmView::Snapshot &
+gams::variables::SwarmView::get_snapshot (void) const
+{
+  return snapshot_;
+}
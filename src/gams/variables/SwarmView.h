@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file SwarmView.h
+ *
+ * This file contains the definition of a lazily bound view of swarm state
+ **/
+
+#ifndef   _GAMS_VARIABLES_SWARM_VIEW_H_
+#define   _GAMS_VARIABLES_SWARM_VIEW_H_
+
+#include <vector>
+#include <string>
+#include <memory>
+
+#include "gams/GamsExport.h"
+#include "madara/knowledge/KnowledgeBase.h"
+#include "Agent.h"
+
+namespace gams
+{
+  namespace variables
+  {
+    /**
+    * A view of the agents in a swarm that binds knowledge base variables
+    * only when they are used. Full Agent containers are bound the first
+    * time an agent is asked for. Hot fields (location, velocity, battery
+    * and mobile) are read into contiguous arrays, one per field, so loops
+    * over the swarm touch memory in order. Controllers keep one per
+    * control loop, mark it stale in monitor, and it is refreshed at most
+    * once per loop, the first time an algorithm asks for it.
+    **/
+    class GAMS_EXPORT SwarmView
+    {
+    public:
+      /// the type of an integer field
+      typedef madara::knowledge::KnowledgeRecord::Integer Integer;
+
+      /**
+       * Hot fields of every agent, one array per field, indexed by agent
+       **/
+      struct Snapshot
+      {
+        /// location, in the frame the agents publish in
+        std::vector<double> location_x, location_y, location_z;
+
+        /// velocity, in the frame the agents publish in
+        std::vector<double> velocity_x, velocity_y, velocity_z;
+
+        /// battery remaining
+        std::vector<Integer> battery;
+
+        /// 1 if the agent is mobile
+        std::vector<unsigned char> mobile;
+
+        /// 1 if the agent has published a location
+        std::vector<unsigned char> has_location;
+
+        /// 1 if the agent has published a velocity
+        std::vector<unsigned char> has_velocity;
+      };
+
+      /**
+       * Constructor
+       **/
+      SwarmView ();
+
+      /**
+       * Destructor
+       **/
+      ~SwarmView ();
+
+      /**
+       * Sets the agents in the view. Nothing is bound until used.
+       * @param  knowledge   the knowledge base the agents live in
+       * @param  prefixes    the agent prefixes (e.g., agent.0)
+       **/
+      void set_agents (madara::knowledge::KnowledgeBase & knowledge,
+        const std::vector<std::string> & prefixes);
+
+      /**
+       * Sets the agents in the view to agent.0 through agent.{processes-1}
+       * @param  knowledge   the knowledge base the agents live in
+       * @param  processes   the number of agents
+       **/
+      void set_agents (madara::knowledge::KnowledgeBase & knowledge,
+        size_t processes);
+
+      /**
+       * Gets the number of agents in the view
+       * @return the number of agents
+       **/
+      size_t size (void) const;
+
+      /**
+       * Gets the prefix of an agent
+       * @param  agent   index of the agent
+       * @return the agent prefix (e.g., agent.0)
+       **/
+      const std::string & get_prefix (size_t agent) const;
+
+      /**
+       * Gets the containers of an agent, binding them on first use
+       * @param  agent   index of the agent
+       * @return the agent's containers
+       **/
+      Agent & get_agent (size_t agent);
+
+      /**
+       * Checks if an agent's containers have been bound
+       * @param  agent   index of the agent
+       * @return true if get_agent has been called for the agent
+       **/
+      bool is_bound (size_t agent) const;
+
+      /**
+       * Marks the snapshot stale, so the next update refreshes it
+       **/
+      void invalidate (void);
+
+      /**
+       * Refreshes the snapshot, if it is stale
+       **/
+      void update (void);
+
+      /**
+       * Reads the hot fields of every agent into the snapshot
+       **/
+      void refresh (void);
+
+      /**
+       * Gets the hot fields read by the last refresh
+       * @return the snapshot
+       **/
+      const Snapshot & get_snapshot (void) const;
+
+    private:
+      /**
+       * Resolves the hot field references, on the first refresh
+       **/
+      void bind_fields (void);
+
+      /// the knowledge base the agents live in
+      madara::knowledge::KnowledgeBase * knowledge_;
+
+      /// the agent prefixes
+      std::vector<std::string> prefixes_;
+
+      /// agent containers, bound on first use
+      std::vector<std::shared_ptr<Agent> > agents_;
+
+      /// true once the hot field references are resolved
+      bool fields_bound_;
+
+      /// hot field references, indexed by agent
+      std::vector<madara::knowledge::VariableReference> location_refs_,
+        velocity_refs_, battery_refs_, mobile_refs_;
+
+      /// true if the snapshot must be refreshed before use
+      bool stale_;
+
+      /// hot fields read by the last refresh
+      Snapshot snapshot_;
+    };
+  }
+}
+
+#endif // _GAMS_VARIABLES_SWARM_VIEW_H_
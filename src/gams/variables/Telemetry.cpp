@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file Telemetry.cpp
+ *
+ * This file contains the implementation of packed per-agent telemetry
+ **/
+
+#include "Telemetry.h"
+
+#include <cmath>
+#include <limits>
+#include <string.h>
+
+namespace knowledge = madara::knowledge;
+namespace containers = knowledge::containers;
+
+typedef knowledge::KnowledgeRecord::Integer Integer;
+
+namespace
+{
+  /// offset of the first three-component field
+  const size_t TRIPLES_OFFSET = 16;
+
+  void write_u64 (unsigned char * buffer, uint64_t value)
+  {
+    for (size_t i = 0; i < 8; ++i)
+    {
+      buffer[i] = (unsigned char)(value >> (8 * i));
+    }
+  }
+
+  uint64_t read_u64 (const unsigned char * buffer)
+  {
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+      value |= (uint64_t)buffer[i] << (8 * i);
+    }
+    return value;
+  }
+
+  void write_double (unsigned char * buffer, double value)
+  {
+    uint64_t bits;
+    memcpy (&bits, &value, sizeof (bits));
+    write_u64 (buffer, bits);
+  }
+
+  double read_double (const unsigned char * buffer)
+  {
+    uint64_t bits = read_u64 (buffer);
+    double value;
+    memcpy (&value, &bits, sizeof (value));
+    return value;
+  }
+
+  void pack_triple (const containers::NativeDoubleArray & container,
+    double * values)
+  {
+    const size_t size = container.size ();
+
+    // NaN marks a field the agent has not set, such as an unknown velocity
+    const double missing = size == 0 ?
+      std::numeric_limits<double>::quiet_NaN () : 0.0;
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+      values[i] = i < size ? container[i] : missing;
+    }
+  }
+
+  void unpack_triple (const double * values,
+    containers::NativeDoubleArray & container)
+  {
+    if (std::isnan (values[0]))
+    {
+      return;
+    }
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+      container.set (i, values[i]);
+    }
+  }
+}
+
+const unsigned char gams::variables::Telemetry::VERSION;
+const size_t gams::variables::Telemetry::RECORD_SIZE;
+
+gams::variables::Telemetry::Telemetry ()
+  : knowledge_ (0), self_ (0), sequence_ (0)
+{
+}
+
+gams::variables::Telemetry::~Telemetry ()
+{
+}
+
+void
+gams::variables::Telemetry::init_vars (
+  knowledge::KnowledgeBase & knowledge, Agent & self)
+{
+  knowledge_ = &knowledge;
+  self_ = &self;
+  self_ref_ = knowledge.get_ref (self.prefix + ".telemetry");
+
+  keep_local (self);
+}
+
+bool
+gams::variables::Telemetry::is_enabled (void) const
+{
+  return knowledge_ != 0;
+}
+
+void
+gams::variables::Telemetry::publish (void)
+{
+  if (!knowledge_)
+    return;
+
+  Record record;
+  pack (*self_, record);
+  record.sequence = ++sequence_;
+
+  unsigned char buffer[RECORD_SIZE];
+  encode (record, buffer);
+
+  knowledge_->set_file (self_ref_, buffer, RECORD_SIZE);
+}
+
+size_t
+gams::variables::Telemetry::receive (Agents & agents)
+{
+  size_t received = 0;
+
+  if (!knowledge_)
+    return received;
+
+  knowledge::ContextGuard guard (*knowledge_);
+
+  resize (agents.size ());
+
+  for (size_t i = 0; i < agents.size (); ++i)
+  {
+    Agent & agent = agents[i];
+
+    if (agent.prefix == self_->prefix)
+      continue;
+
+    if (bind (i, agent.prefix))
+    {
+      keep_local (agent);
+      kept_[i] = 1;
+    }
+
+    Record record;
+    if (read (i, record))
+    {
+      unpack (record, agent);
+      ++received;
+    }
+  }
+
+  return received;
+}
+
+size_t
+gams::variables::Telemetry::receive (SwarmView & swarm_view)
+{
+  size_t received = 0;
+
+  if (!knowledge_)
+    return received;
+
+  knowledge::ContextGuard guard (*knowledge_);
+
+  resize (swarm_view.size ());
+
+  for (size_t i = 0; i < swarm_view.size (); ++i)
+  {
+    const std::string & prefix = swarm_view.get_prefix (i);
+
+    if (prefix == self_->prefix)
+      continue;
+
+    bind (i, prefix);
+
+    Record record;
+    if (read (i, record))
+    {
+      // the agent's containers are bound once it has something to unpack
+      Agent & agent = swarm_view.get_agent (i);
+
+      if (!kept_[i])
+      {
+        keep_local (agent);
+        kept_[i] = 1;
+      }
+
+      unpack (record, agent);
+      ++received;
+    }
+  }
+
+  return received;
+}
+
+void
+gams::variables::Telemetry::resize (size_t agents)
+{
+  if (refs_.size () != agents)
+  {
+    refs_.resize (agents);
+    ref_prefixes_.resize (agents);
+    sequences_.resize (agents, 0);
+    kept_.resize (agents, 0);
+  }
+}
+
+bool
+gams::variables::Telemetry::bind (size_t agent, const std::string & prefix)
+{
+  // bind once per agent, and again if the agent list was reordered
+  if (ref_prefixes_[agent] == prefix)
+    return false;
+
+  refs_[agent] = knowledge_->get_ref (prefix + ".telemetry");
+  ref_prefixes_[agent] = prefix;
+  sequences_[agent] = 0;
+  kept_[agent] = 0;
+
+  return true;
+}
+
+bool
+gams::variables::Telemetry::read (size_t agent, Record & record)
+{
+  knowledge::KnowledgeRecord value = knowledge_->get (refs_[agent]);
+
+  if (!value.is_binary_file_type ())
+    return false;
+
+  size_t size = 0;
+  unsigned char * buffer = value.to_unmanaged_buffer (size);
+
+  bool valid = decode (buffer, size, record);
+  delete [] buffer;
+
+  if (!valid || record.sequence == sequences_[agent])
+    return false;
+
+  sequences_[agent] = record.sequence;
+  return true;
+}
+
+void
+gams::variables::Telemetry::pack (const Agent & agent, Record & record)
+{
+  record.battery = *agent.battery_remaining;
+  pack_triple (agent.location, record.location);
+  pack_triple (agent.orientation, record.orientation);
+  pack_triple (agent.velocity, record.velocity);
+  pack_triple (agent.acceleration, record.acceleration);
+  pack_triple (agent.dest, record.dest);
+  pack_triple (agent.source, record.source);
+}
+
+void
+gams::variables::Telemetry::unpack (const Record & record, Agent & agent)
+{
+  agent.battery_remaining = record.battery;
+  unpack_triple (record.location, agent.location);
+  unpack_triple (record.orientation, agent.orientation);
+  unpack_triple (record.velocity, agent.velocity);
+  unpack_triple (record.acceleration, agent.acceleration);
+  unpack_triple (record.dest, agent.dest);
+  unpack_triple (record.source, agent.source);
+}
+
+void
+gams::variables::Telemetry::encode (const Record & record,
+  unsigned char * buffer)
+{
+  buffer[0] = VERSION;
+  buffer[1] = 0;
+  buffer[2] = 0;
+  buffer[3] = 0;
+
+  for (size_t i = 0; i < 4; ++i)
+  {
+    buffer[4 + i] = (unsigned char)(record.sequence >> (8 * i));
+  }
+
+  write_u64 (buffer + 8, (uint64_t)record.battery);
+
+  const double * triples[] = {
+    record.location, record.orientation, record.velocity,
+    record.acceleration, record.dest, record.source };
+
+  unsigned char * cur = buffer + TRIPLES_OFFSET;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j, cur += 8)
+    {
+      write_double (cur, triples[i][j]);
+    }
+  }
+}
+
+bool
+gams::variables::Telemetry::decode (const unsigned char * buffer,
+  size_t size, Record & record)
+{
+  if (!buffer || size != RECORD_SIZE || buffer[0] != VERSION)
+  {
+    return false;
+  }
+
+  record.sequence = 0;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    record.sequence |= (uint32_t)buffer[4 + i] << (8 * i);
+  }
+
+  record.battery = (Integer)read_u64 (buffer + 8);
+
+  double * triples[] = {
+    record.location, record.orientation, record.velocity,
+    record.acceleration, record.dest, record.source };
+
+  const unsigned char * cur = buffer + TRIPLES_OFFSET;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j, cur += 8)
+    {
+      triples[i][j] = read_double (cur);
+    }
+  }
+
+  return true;
+}
+
+void
+gams::variables::Telemetry::keep_local (Agent & agent)
+{
+  knowledge::KnowledgeUpdateSettings keep_local (true);
+
+  agent.battery_remaining.set_settings (keep_local);
+  agent.location.set_settings (keep_local);
+  agent.orientation.set_settings (keep_local);
+  agent.velocity.set_settings (keep_local);
+  agent.acceleration.set_settings (keep_local);
+  agent.dest.set_settings (keep_local);
+  agent.source.set_settings (keep_local);
+}
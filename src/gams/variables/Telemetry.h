@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names "Carnegie Mellon University," "SEI" and/or "Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file Telemetry.h
+ *
+ * This file contains the definition of packed per-agent telemetry
+ **/
+
+#ifndef   _GAMS_VARIABLES_TELEMETRY_H_
+#define   _GAMS_VARIABLES_TELEMETRY_H_
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "gams/GamsExport.h"
+#include "madara/knowledge/KnowledgeBase.h"
+#include "Agent.h"
+#include "SwarmView.h"
+
+namespace gams
+{
+  namespace variables
+  {
+    /**
+    * Packs the hot fields of an agent into one fixed-layout binary
+    * record, published as {agent}.telemetry. With telemetry enabled, the
+    * packed fields of the agent are kept local, so each send carries one
+    * record instead of a dozen. Receivers unpack records into the same
+    * Agent containers, also as local changes.
+    *
+    * The record is 160 bytes, little endian:
+    *   0: version (1 byte), 1: reserved (3 bytes), 4: sequence (4),
+    *   8: battery (8), 16: location, orientation, velocity,
+    *   acceleration, dest and source (3 doubles each)
+    *
+    * A field the agent has not set is sent as NaN and stays unset at
+    * receivers, so they can tell an unknown velocity from a stop.
+    **/
+    class GAMS_EXPORT Telemetry
+    {
+    public:
+      /// the type of an integer field
+      typedef madara::knowledge::KnowledgeRecord::Integer Integer;
+
+      /// the record layout version
+      static const unsigned char VERSION = 1;
+
+      /// the size of an encoded record, in bytes
+      static const size_t RECORD_SIZE = 160;
+
+      /**
+       * The fields of a telemetry record
+       **/
+      struct Record
+      {
+        /// increases with each publish, so receivers skip old records
+        uint32_t sequence;
+
+        /// battery remaining
+        Integer battery;
+
+        /// three-component fields, as stored in the agent containers
+        double location[3], orientation[3], velocity[3],
+          acceleration[3], dest[3], source[3];
+      };
+
+      /**
+       * Constructor
+       **/
+      Telemetry ();
+
+      /**
+       * Destructor
+       **/
+      ~Telemetry ();
+
+      /**
+       * Enables packed telemetry for an agent. The packed fields of the
+       * agent are kept local from now on.
+       * @param  knowledge   the knowledge base to publish through
+       * @param  self        the containers of the publishing agent
+       **/
+      void init_vars (madara::knowledge::KnowledgeBase & knowledge,
+        Agent & self);
+
+      /**
+       * Checks if packed telemetry has been enabled
+       * @return true if init_vars has been called
+       **/
+      bool is_enabled (void) const;
+
+      /**
+       * Packs the agent's fields into {agent}.telemetry, to go out with
+       * the next send
+       **/
+      void publish (void);
+
+      /**
+       * Unpacks new records from other agents into their containers
+       * @param  agents   the agents to check, which may include self
+       * @return the number of records unpacked
+       **/
+      size_t receive (Agents & agents);
+
+      /**
+       * Unpacks new records from other agents into their containers in a
+       * view. Only agents that have sent a record are bound.
+       * @param  swarm_view   the agents to check, which may include self
+       * @return the number of records unpacked
+       **/
+      size_t receive (SwarmView & swarm_view);
+
+      /**
+       * Reads the packed fields from agent containers
+       * @param  agent    the agent to read
+       * @param  record   the record to fill (sequence is not changed)
+       **/
+      static void pack (const Agent & agent, Record & record);
+
+      /**
+       * Writes the packed fields to agent containers
+       * @param  record   the record to write
+       * @param  agent    the agent to write to
+       **/
+      static void unpack (const Record & record, Agent & agent);
+
+      /**
+       * Encodes a record into RECORD_SIZE bytes
+       * @param  record   the record to encode
+       * @param  buffer   at least RECORD_SIZE bytes
+       **/
+      static void encode (const Record & record, unsigned char * buffer);
+
+      /**
+       * Decodes a record
+       * @param  buffer   the encoded record
+       * @param  size     the number of bytes in buffer
+       * @param  record   the decoded record
+       * @return false if the buffer is not a record of this version
+       **/
+      static bool decode (const unsigned char * buffer, size_t size,
+        Record & record);
+
+    private:
+      /**
+       * Keeps changes to the packed containers of an agent local
+       **/
+      static void keep_local (Agent & agent);
+
+      /**
+       * Sizes the per-agent state for a number of agents
+       **/
+      void resize (size_t agents);
+
+      /**
+       * Binds the record of an agent, if not already bound to its prefix
+       * @return true if the record was bound by this call
+       **/
+      bool bind (size_t agent, const std::string & prefix);
+
+      /**
+       * Reads the record of a bound agent
+       * @param  agent    index of the agent
+       * @param  record   the record read
+       * @return true if the record is valid and not already unpacked
+       **/
+      bool read (size_t agent, Record & record);
+
+      /// the knowledge base to publish through, or 0 if not enabled
+      madara::knowledge::KnowledgeBase * knowledge_;
+
+      /// the publishing agent
+      Agent * self_;
+
+      /// the publishing agent's record
+      madara::knowledge::VariableReference self_ref_;
+
+      /// the sequence of the last published record
+      uint32_t sequence_;
+
+      /// the record of each received agent, bound on first receive
+      std::vector<madara::knowledge::VariableReference> refs_;
+
+      /// the prefix each reference in refs_ was bound for
+      std::vector<std::string> ref_prefixes_;
+
+      /// the sequence of the last record unpacked for each agent
+      std::vector<uint32_t> sequences_;
+
+      /// 1 if keep_local has been applied to the agent's containers
+      std::vector<unsigned char> kept_;
+    };
+  }
+}
+
+#endif // _GAMS_VARIABLES_TELEMETRY_H_
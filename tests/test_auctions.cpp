@@ -51,6 +51,10 @@
  * Tests the functionality of gams::auctions classes
  **/
 
+#include <chrono>
+#include <random>
+#include <sstream>
+
 #include "madara/knowledge/containers/Double.h"
 
 #include "gams/auctions/AuctionMaximumBid.h"
@@ -332,6 +336,176 @@ void test_minimum_distance_auction (knowledge::KnowledgeBase & knowledge)
   knowledge.print ();
 }
 
+void test_leader_benchmark (knowledge::KnowledgeBase & knowledge)
+{
+  using madara::knowledge::KnowledgeRecord;
+  typedef std::chrono::steady_clock Clock;
+
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing AuctionMinimumBid with 1000 bidders\n");
+
+  knowledge.clear (true);
+
+  const size_t bidders = 1000;
+  const size_t polls = 1000;
+  std::mt19937 generator (1);
+  std::uniform_real_distribution<double> amounts (0.0, 1000.0);
+
+  // bids arrive from elsewhere, e.g., the transport
+  std::vector<std::string> names (bidders);
+  std::vector<double> bids (bidders);
+  for (size_t i = 0; i < bidders; ++i)
+  {
+    std::stringstream name;
+    name << "agent." << i;
+    names[i] = name.str ();
+    bids[i] = amounts (generator);
+    knowledge.set ("auction.bench.0." + names[i], bids[i]);
+  }
+
+  auctions::AuctionMinimumBid auction ("auction.bench", "agent.0", &knowledge);
+
+  bool correct = true;
+  double heap_time = 0;
+  double sort_time = 0;
+
+  for (size_t poll = 0; poll < polls; ++poll)
+  {
+    // one bid changes between polls
+    const size_t changed = generator () % bidders;
+    bids[changed] = amounts (generator);
+    knowledge.set ("auction.bench.0." + names[changed], bids[changed]);
+
+    size_t expected = 0;
+    for (size_t i = 1; i < bidders; ++i)
+      if (bids[i] < bids[expected] ||
+        (bids[i] == bids[expected] && names[i] < names[expected]))
+        expected = i;
+
+    Clock::time_point start = Clock::now ();
+    std::string leader = auction.get_leader ();
+    heap_time += std::chrono::duration<double, std::milli> (
+      Clock::now () - start).count ();
+
+    // the previous approach: match the round prefix and sort every poll
+    start = Clock::now ();
+    madara::knowledge::VariableReferences refs;
+    knowledge.get_matches ("auction.bench.0", "", refs);
+    auctions::AuctionBids sorted (refs.size ());
+    for (size_t i = 0; i < refs.size (); ++i)
+    {
+      sorted[i].bidder = refs[i].get_name ();
+      sorted[i].amount = knowledge.get (refs[i]);
+    }
+    auctions::strip_prefix_fast ("auction.bench.0.", sorted);
+    auctions::sort_ascending (sorted);
+    sort_time += std::chrono::duration<double, std::milli> (
+      Clock::now () - start).count ();
+
+    if (leader != names[expected])
+      correct = false;
+  }
+
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "  get_leader: %f ms per poll, match and sort: "
+    "%f ms per poll\n", heap_time / polls, sort_time / polls);
+
+  if (correct)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader after each change: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader after each change: FAIL\n");
+    ++gams_fails;
+  }
+}
+
+void test_late_bidder (knowledge::KnowledgeBase & knowledge)
+{
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing AuctionMinimumBid with late bidders\n");
+
+  knowledge.clear (true);
+
+  // bids arrive from elsewhere, e.g., the transport
+  knowledge.set ("auction.late.0.agent.0", 5.0);
+  knowledge.set ("auction.late.0.agent.1", 3.0);
+
+  auctions::AuctionMinimumBid auction ("auction.late", "agent.0", &knowledge);
+
+  std::string leader = auction.get_leader ();
+
+  if (leader == "agent.1")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader before late bids == agent.1: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader before late bids == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+
+  // a bidder the auction has not seen posts a lower bid, which polling
+  // does not search for
+  knowledge.set ("auction.late.0.agent.7", 1.0);
+  leader = auction.get_leader ();
+
+  if (leader == "agent.1")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader before sync == agent.1: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader before sync == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+
+  auction.sync ();
+  leader = auction.get_leader ();
+
+  if (leader == "agent.7")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader after sync == agent.7: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader after sync == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+
+  // a late bidder that does not lead is still tracked for later changes
+  knowledge.set ("auction.late.0.agent.8", 10.0);
+  auction.sync ();
+  leader = auction.get_leader ();
+  knowledge.set ("auction.late.0.agent.8", 0.5);
+  leader = auction.get_leader ();
+
+  if (leader == "agent.8")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader after later change == agent.8: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Leader after later change == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+}
+
 int
 main (int, char **)
 {
@@ -340,6 +514,8 @@ main (int, char **)
   test_minimum_auction (knowledge);
   test_maximum_auction (knowledge);
   test_minimum_distance_auction (knowledge);
+  test_late_bidder (knowledge);
+  test_leader_benchmark (knowledge);
 
   if (gams_fails > 0)
   {
@@ -0,0 +1,366 @@
+/**
+ * Tests for the CollisionAvoidance accent. Drives the accent through
+ * analyze, plan and execute on a knowledge base, then stress tests ORCA
+ * with agents that have simple kinematics and cross a shared area to swap
+ * places, steering each tick with a NeighborIndex query, and reports the
+ * cost per tick along with the closest approach between any two agents.
+ *
+ * Usage: test_collision_avoidance [agents]
+ * The stress test runs 100 agents, and also the given number if larger.
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "madara/knowledge/KnowledgeBase.h"
+
+#include "gams/algorithms/CollisionAvoidance.h"
+#include "gams/platforms/BasePlatform.h"
+#include "gams/variables/NeighborIndex.h"
+#include "gams/variables/SwarmView.h"
+#include "gams/pose/ReferenceFrame.h"
+
+namespace algorithms = gams::algorithms;
+namespace knowledge = madara::knowledge;
+namespace platforms = gams::platforms;
+namespace pose = gams::pose;
+namespace variables = gams::variables;
+
+int gams_fails = 0;
+
+/**
+ * A platform that is wherever its location says, and only records moves
+ **/
+class TestPlatform : public platforms::BasePlatform
+{
+public:
+  TestPlatform (knowledge::KnowledgeBase * knowledge, variables::Self * self)
+    : BasePlatform (knowledge, 0, self)
+  {
+    status_.init_vars (*knowledge, get_id ());
+    status_.movement_available = 1;
+  }
+
+  int analyze (void) override
+  {
+    return 0;
+  }
+
+  std::string get_id () const override
+  {
+    return "test_platform";
+  }
+
+  std::string get_name () const override
+  {
+    return "Test Platform";
+  }
+
+  int sense (void) override
+  {
+    return 0;
+  }
+};
+
+/**
+ * Runs one loop of the accent with this agent heading east at 5 m/s
+ * toward another agent 6m ahead
+ * @param  publish   true if both agents publish their velocity
+ * @param  other_vx  the other agent's velocity east, in m/s
+ * @param  use_view  true to read neighbors through a SwarmView, as
+ *                   controllers do
+ * @return true if the accent diverted this agent
+ **/
+bool
+run_accent (bool publish, double other_vx, bool use_view = false)
+{
+  knowledge::KnowledgeBase knowledge;
+  variables::Self self;
+  self.init_vars (knowledge, 0);
+  variables::Agents agents;
+  variables::init_vars (agents, knowledge, 2);
+
+  TestPlatform platform (&knowledge, &self);
+  variables::NeighborIndex index (&agents);
+
+  self.agent.loop_hz = 1.0;
+  self.agent.location.set (0, 0.0);
+  self.agent.location.set (1, 0.0);
+  self.agent.location.set (2, 0.0);
+  agents[1].location.set (0, 6.0);
+  agents[1].location.set (1, 0.0);
+  agents[1].location.set (2, 0.0);
+
+  if (publish)
+  {
+    self.agent.velocity.set (0, 5.0);
+    self.agent.velocity.set (1, 0.0);
+    agents[1].velocity.set (0, other_vx);
+    agents[1].velocity.set (1, 0.0);
+  }
+
+  // the algorithm has already sent this agent east
+  self.agent.dest.set (0, 50.0);
+  self.agent.dest.set (1, 0.0);
+  self.agent.dest.set (2, 0.0);
+  platform.get_platform_status ()->moving = 1;
+
+  algorithms::CollisionAvoidance accent (2.0, 20.0, 10, 5.0, 5.0,
+    &knowledge, &platform, 0, &self, &agents);
+  accent.set_neighbor_index (&index);
+
+  variables::SwarmView view;
+  if (use_view)
+  {
+    view.set_agents (knowledge, 2);
+    index.set_swarm_view (&view);
+    accent.set_swarm_view (&view);
+  }
+
+  accent.analyze ();
+  accent.plan ();
+  accent.execute ();
+
+  pose::Position dest (platform.get_frame ());
+  dest.from_container (self.agent.dest);
+
+  return std::fabs (dest.x () - 50.0) > 1e-3 || std::fabs (dest.y ()) > 1e-3;
+}
+
+void
+test_execute (void)
+{
+  std::cout << "Testing CollisionAvoidance analyze, plan and execute...\n";
+
+  std::cout << "  Testing it diverts from an unpublished neighbor: ";
+  if (run_accent (false, 0.0))
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  std::cout << "  Testing it diverts from an oncoming neighbor: ";
+  if (run_accent (true, -5.0))
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  // the neighbor's published velocity keeps it ahead, though a neighbor
+  // seen once would be taken as standing still
+  std::cout << "  Testing it follows a neighbor moving away: ";
+  if (!run_accent (true, 5.0))
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  std::cout << "  Testing it reads neighbors through a SwarmView: ";
+  if (run_accent (false, 0.0, true) && run_accent (true, -5.0, true) &&
+    !run_accent (true, 5.0, true))
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+}
+
+void
+test_swap (int num)
+{
+  std::cout << "Testing " << num << " agents swapping places...\n";
+
+  const double radius = 2.0;
+  const double range = 20.0;
+  const size_t max_neighbors = 10;
+  const double time_horizon = 5.0;
+  const double max_speed = 5.0;
+  const double time_step = 0.25;
+  const int ticks = 300;
+
+  // scatter agents at least 5m apart, each heading to another's start
+  std::mt19937 rng (5);
+  const double side = std::sqrt ((double)num) * 15.0;
+  std::uniform_real_distribution<double> coord (0.0, side);
+
+  std::vector<Eigen::Vector2d> positions;
+  while ((int)positions.size () < num)
+  {
+    Eigen::Vector2d candidate (coord (rng), coord (rng));
+    bool clear = true;
+    for (size_t i = 0; i < positions.size () && clear; ++i)
+    {
+      clear = (positions[i] - candidate).norm () >= 5.0;
+    }
+    if (clear)
+    {
+      positions.push_back (candidate);
+    }
+  }
+
+  std::vector<Eigen::Vector2d> goals (num);
+  for (int i = 0; i < num; ++i)
+  {
+    goals[i] = positions[(i + num / 2) % num];
+  }
+
+  std::vector<Eigen::Vector2d> velocities (num, Eigen::Vector2d::Zero ());
+  std::vector<Eigen::Vector2d> chosen (num);
+  std::vector<pose::Position> locations (num);
+  variables::NeighborIndex index;
+
+  double min_separation = side;
+  double elapsed = 0;
+
+  for (int tick = 0; tick < ticks; ++tick)
+  {
+    auto start = std::chrono::steady_clock::now ();
+
+    for (int i = 0; i < num; ++i)
+    {
+      locations[i] = pose::Position (pose::default_frame (),
+        positions[i].x (), positions[i].y ());
+    }
+    index.build (locations);
+
+    for (int i = 0; i < num; ++i)
+    {
+      variables::NeighborIndex::Neighbors nearby =
+        index.within ((size_t)i, range);
+      if (nearby.size () > max_neighbors)
+      {
+        nearby.resize (max_neighbors);
+      }
+
+      std::vector<algorithms::CollisionAvoidance::Neighbor> neighbors;
+      for (size_t n = 0; n < nearby.size (); ++n)
+      {
+        algorithms::CollisionAvoidance::Neighbor neighbor;
+        neighbor.position = positions[nearby[n].agent];
+        neighbor.velocity = velocities[nearby[n].agent];
+        neighbor.radius = radius;
+        neighbors.push_back (neighbor);
+      }
+
+      Eigen::Vector2d preferred = goals[i] - positions[i];
+      const double distance = preferred.norm ();
+      if (distance > 1e-9)
+      {
+        preferred *= std::min (max_speed, distance / time_step) / distance;
+      }
+
+      chosen[i] = algorithms::CollisionAvoidance::compute_velocity (
+        positions[i], velocities[i], preferred, radius, max_speed,
+        time_horizon, time_step, neighbors);
+    }
+
+    elapsed += std::chrono::duration<double> (
+      std::chrono::steady_clock::now () - start).count ();
+
+    for (int i = 0; i < num; ++i)
+    {
+      velocities[i] = chosen[i];
+      positions[i] += chosen[i] * time_step;
+    }
+
+    for (int i = 0; i < num; ++i)
+    {
+      for (int j = i + 1; j < num; ++j)
+      {
+        min_separation = std::min (min_separation,
+          (positions[j] - positions[i]).norm ());
+      }
+    }
+  }
+
+  int arrived = 0;
+  for (int i = 0; i < num; ++i)
+  {
+    if ((positions[i] - goals[i]).norm () < 1.0)
+    {
+      ++arrived;
+    }
+  }
+
+  std::cout << "  " << num << " agents: " <<
+    elapsed / ticks * 1e6 << " us per tick, " <<
+    elapsed / ticks / num * 1e6 << " us per agent, " <<
+    arrived << " arrived, closest approach " << min_separation << "m\n";
+
+  // ORCA only guarantees separation in continuous time, so allow the
+  // small overlaps that discrete ticks cause
+  std::cout << "  Testing agents keep apart: ";
+  if (min_separation > 1.5 * radius)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  std::cout << "  Testing agents make progress: ";
+  if (arrived >= num / 2)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+}
+
+int
+main (int argc, char ** argv)
+{
+  int num = 100;
+
+  if (argc > 1)
+  {
+    std::stringstream buffer (argv[1]);
+    buffer >> num;
+  }
+
+  test_execute ();
+  test_swap (100);
+
+  // larger swarms are slow, so they only run when asked for
+  if (num > 100)
+  {
+    test_swap (num);
+  }
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
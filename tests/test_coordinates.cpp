@@ -2,10 +2,15 @@
 #include <fstream>
 #include <streambuf>
 #include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include "gams/pose/Position.h"
 #include "gams/pose/CartesianFrame.h"
 #include "gams/pose/ReferenceFrame.h"
 #include "gams/pose/GPSFrame.h"
+#include "gams/pose/Region.h"
+#include "gams/pose/SearchArea.h"
 #include "madara/knowledge/KnowledgeBase.h"
 #include "gams/exceptions/ReferenceFrameException.h"
 
@@ -80,6 +85,15 @@ double round_nearest(double in)
     } \
   } while(0)
 
+/**
+ * Exposes regions_, as a subclass that edits its regions would
+ **/
+class EditableSearchArea : public SearchArea
+{
+public:
+  std::vector<PrioritizedRegion> & regions() { return regions_; }
+};
+
 int main(int, char *[])
 {
   static_assert(!supports_transform_to<PositionVector>::value, "");
@@ -595,6 +609,215 @@ int main(int, char *[])
     TEST_EQ(stamped_pose.frame() == gps_frame(), 0);
   }
 
+  std::cout << std::endl << "Testing chained transform timing:" << std::endl;
+  {
+    // five nested, rotated Cartesian frames; each transform reuses the
+    // quaternion cached by the frame instead of re-deriving it
+    ReferenceFrame f0(Pose(default_frame(), 1, 2, 3, 0, 0, M_PI/4));
+    ReferenceFrame f1(Pose(f0, 4, 5, 6, M_PI/8, 0, 0));
+    ReferenceFrame f2(Pose(f1, 7, 8, 9, 0, M_PI/6, 0));
+    ReferenceFrame f3(Pose(f2, 1, 1, 1, 0, 0, -M_PI/3));
+    ReferenceFrame f4(Pose(f3, 2, 2, 2, M_PI/5, M_PI/7, 0));
+
+    ReferenceFrame frame90(Pose(default_frame(), 3, 4, 0, 0, 0, M_PI/2));
+    Position p90(frame90, 1, 0, 0);
+    Position p90_base = p90.transform_to(default_frame());
+    TEST(p90_base.x(), 3);
+    TEST(p90_base.y(), 5);
+    TEST(p90_base.z(), 0);
+
+    // expected values from composing the five origins by hand
+    Pose chained(f4, 1, 2, 3, 0, 0, M_PI/2);
+    Pose chained_base = chained.transform_to(default_frame());
+    TEST(chained_base.x(), 9.4398);
+    TEST(chained_base.y(), 19.3663);
+    TEST(chained_base.z(), 22.1038);
+    TEST(chained_base.rx(), 0.4382);
+    TEST(chained_base.ry(), 1.2626);
+    TEST(chained_base.rz(), 0.8455);
+
+    const int iterations = 100000;
+    double sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+      Pose cur(f4, i, 2, 3, 0, 0, M_PI/2);
+      sink += cur.transform_to(default_frame()).x();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "  5-level chained Pose transform: " <<
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        elapsed).count() / (double)iterations << " ns/op" << std::endl;
+
+    // x grows by 0.500443 per unit of the input's x, from 8.939348 at 0
+    TEST(sink, 2503084501.5677);
+
+    // writes through mut_origin must not leave a stale cached quaternion
+    auto version = std::make_shared<ReferenceFrameVersion>(
+      Pose(default_frame(), 0, 0, 0, 0, 0, M_PI/2));
+    ReferenceFrame mutated(version);
+    Position before(mutated, 1, 0, 0);
+    TEST(before.transform_to(default_frame()).y(), 1);
+    version->mut_origin().rz(M_PI);
+    Position after(mutated, 1, 0, 0);
+    TEST(after.transform_to(default_frame()).x(), -1);
+    TEST(mutated.origin_quat().w(), 0);
+  }
+
+  std::cout << std::endl << "Testing Region::contains:" << std::endl;
+  {
+    // concave "L" shaped region, in lng/lat
+    std::vector<Position> verts = {
+      Position(gps_frame(), -80.00, 40.00),
+      Position(gps_frame(), -79.98, 40.00),
+      Position(gps_frame(), -79.98, 40.01),
+      Position(gps_frame(), -79.99, 40.01),
+      Position(gps_frame(), -79.99, 40.02),
+      Position(gps_frame(), -80.00, 40.02),
+    };
+    Region region(verts);
+
+    TEST_EQ(region.contains(Position(gps_frame(), -79.995, 40.005)), true);
+    TEST_EQ(region.contains(Position(gps_frame(), -79.985, 40.005)), true);
+    TEST_EQ(region.contains(Position(gps_frame(), -79.995, 40.015)), true);
+    TEST_EQ(region.contains(Position(gps_frame(), -79.985, 40.015)), false);
+    TEST_EQ(region.contains(Position(gps_frame(), -80.005, 40.005)), false);
+    TEST_EQ(region.contains(verts[3]), true);
+
+    // batch results must match individual queries
+    std::vector<Position> queries;
+    for (int i = 0; i < 100; ++i)
+    {
+      for (int j = 0; j < 100; ++j)
+      {
+        queries.push_back(Position(gps_frame(),
+          -80.001 + i * 0.00023, 39.999 + j * 0.00023));
+      }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<bool> results = region.contains(queries);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    int mismatches = 0;
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+      if (results[i] != region.contains(queries[i]))
+        ++mismatches;
+    }
+    TEST_EQ(mismatches, 0);
+
+    std::cout << "  batch contains: " <<
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        elapsed).count() / (double)queries.size() << " ns/point" << std::endl;
+
+    // index must follow vertex changes
+    region.vertices.pop_back();
+    region.vertices.pop_back();
+    region.refresh();
+    TEST_EQ(region.contains(Position(gps_frame(), -79.995, 40.015)), false);
+
+    // and in-place edits that keep the vertex count, even without refresh
+    TEST_EQ(region.contains(Position(gps_frame(), -79.999, 40.009)), false);
+    region.vertices[3] = Position(gps_frame(), -80.00, 40.01);
+    TEST_EQ(region.contains(Position(gps_frame(), -79.999, 40.009)), true);
+    region.vertices[1] = Position(gps_frame(), -79.97, 40.00);
+    TEST_EQ(region.contains(Position(gps_frame(), -79.975, 40.001)), true);
+  }
+
+  std::cout << std::endl << "Testing SearchArea region index:" << std::endl;
+  for (int num_regions : {10, 100, 1000})
+  {
+    // square zones on a jittered lattice, with overlaps
+    SearchArea area;
+    int side = (int)std::ceil(std::sqrt((double)num_regions));
+    for (int i = 0; i < num_regions; ++i)
+    {
+      double lng = -80 + (i % side) * 0.001 + (i % 7) * 0.0001;
+      double lat = 40 + (i / side) * 0.001 + (i % 5) * 0.0001;
+      std::vector<Position> square = {
+        Position(gps_frame(), lng, lat),
+        Position(gps_frame(), lng + 0.0015, lat),
+        Position(gps_frame(), lng + 0.0015, lat + 0.0015),
+        Position(gps_frame(), lng, lat + 0.0015),
+      };
+      area.add_prioritized_region(PrioritizedRegion(square, i % 13));
+    }
+
+    std::vector<Position> queries;
+    for (int i = 0; i < 2000; ++i)
+    {
+      queries.push_back(Position(gps_frame(),
+        -80.0005 + (i % 50) * side * 0.000022,
+        39.9995 + (i / 50) * side * 0.000027));
+    }
+
+    // compare against a linear scan over every region
+    int mismatches = 0;
+    for (const Position & q : queries)
+    {
+      madara::knowledge::KnowledgeRecord::Integer expected = 0;
+      bool expected_contains = false;
+      for (const PrioritizedRegion & region : area.get_regions())
+      {
+        if (region.contains(q))
+        {
+          expected = std::max(expected, region.priority);
+          expected_contains = true;
+        }
+      }
+      if (area.get_priority(q) != expected ||
+          area.contains(q) != expected_contains)
+        ++mismatches;
+    }
+    TEST_EQ(mismatches, 0);
+
+    auto start = std::chrono::steady_clock::now();
+    madara::knowledge::KnowledgeRecord::Integer total = 0;
+    for (const Position & q : queries)
+      total += area.get_priority(q);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "  get_priority with " << num_regions << " regions: " <<
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        elapsed).count() / (double)queries.size() << " ns/query (" <<
+      total << ")" << std::endl;
+  }
+
+  {
+    // the index must follow regions replaced or edited in place
+    auto square = [](double lng, double lat) {
+      return std::vector<Position>{
+        Position(gps_frame(), lng, lat),
+        Position(gps_frame(), lng + 0.001, lat),
+        Position(gps_frame(), lng + 0.001, lat + 0.001),
+        Position(gps_frame(), lng, lat + 0.001),
+      };
+    };
+    EditableSearchArea area;
+    area.add_prioritized_region(PrioritizedRegion(square(-80, 40), 3));
+    area.add_prioritized_region(PrioritizedRegion(square(-79.99, 40), 5));
+
+    Position first(gps_frame(), -79.9995, 40.0005);
+    Position moved(gps_frame(), -79.9795, 40.0005);
+    TEST_EQ(area.get_priority(first), 3);
+    TEST_EQ(area.get_priority(moved), 0);
+
+    area.regions()[0] = PrioritizedRegion(square(-79.98, 40), 7);
+    TEST_EQ(area.get_priority(first), 0);
+    TEST_EQ(area.get_priority(moved), 7);
+    TEST_EQ(area.contains(moved), true);
+
+    area.regions()[0].priority = 2;
+    TEST_EQ(area.get_priority(moved), 2);
+
+    area.regions()[0].vertices = square(-80, 40);
+    area.regions()[0].refresh();
+    TEST_EQ(area.get_priority(first), 2);
+    TEST_EQ(area.contains(moved), false);
+  }
+
 #if 0
   // TODO find out why this crashes in CI
   {
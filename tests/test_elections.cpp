@@ -51,6 +51,10 @@
  * Tests the functionality of gams::voting classes
  **/
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "madara/knowledge/containers/Integer.h"
 
 #include "gams/elections/ElectionPlurality.h"
@@ -293,11 +297,225 @@ void test_plurality (void)
   }
 }
 
+void test_changing_ballots (void)
+{
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing tallies of changing ballots\n");
+
+  knowledge::KnowledgeBase knowledge;
+
+  const int voters = 500;
+  const int candidates = 20;
+
+  elections::ElectionCumulative cumulative (
+    "election.mayor", "agent.0", &knowledge);
+  elections::ElectionPlurality plurality (
+    "election.mayor", "agent.0", &knowledge);
+
+  // each voter casts one or two ballots, which later change value
+  std::vector<std::string> ballots;
+  for (int i = 0; i < voters; ++i)
+  {
+    std::stringstream ballot;
+    ballot << "election.mayor.0.agent." << i << "->candidate.";
+    ballots.push_back (ballot.str () + std::to_string (i * 7 % candidates));
+    knowledge.set (ballots.back (), knowledge::KnowledgeRecord::Integer (1));
+
+    if (i % 3 == 0)
+    {
+      ballots.push_back (ballot.str () + std::to_string (i % candidates));
+      knowledge.set (ballots.back (), knowledge::KnowledgeRecord::Integer (1));
+    }
+  }
+
+  bool cumulative_correct = true;
+  bool plurality_correct = true;
+
+  for (int poll = 0; poll < 100; ++poll)
+  {
+    // a tenth of the ballots change between polls
+    for (size_t i = poll % 10; i < ballots.size (); i += 10)
+    {
+      knowledge.set (ballots[i],
+        knowledge::KnowledgeRecord::Integer ((i + poll) % 5));
+    }
+
+    // tally the ballots from scratch
+    knowledge::VariableReferences ballots;
+    knowledge.get_matches ("election.mayor.0.", "", ballots);
+
+    elections::CandidateVotes sums, firsts;
+    std::string last_voter;
+    for (size_t i = 0; i < ballots.size (); ++i)
+    {
+      std::string ballot = ballots[i].get_name ();
+      std::string::size_type delimiter_pos = ballot.find ("->");
+      std::string voter = ballot.substr (0, delimiter_pos);
+      std::string candidate = ballot.substr (delimiter_pos + 2);
+
+      sums[candidate] += knowledge.get (ballots[i]).to_integer ();
+      if (voter != last_voter)
+      {
+        firsts[candidate] += 1;
+        last_voter = voter;
+      }
+    }
+
+    elections::CandidateVotes votes;
+    cumulative.get_votes (votes);
+
+    elections::CandidateList leaders = cumulative.get_leaders (1);
+    if (votes != sums || leaders.empty () ||
+      sums[leaders[0]] != votes[leaders[0]])
+    {
+      cumulative_correct = false;
+    }
+    for (elections::CandidateVotes::iterator i = sums.begin ();
+      i != sums.end (); ++i)
+    {
+      if (!leaders.empty () && i->second > sums[leaders[0]])
+        cumulative_correct = false;
+    }
+
+    leaders = plurality.get_leaders (1);
+    for (elections::CandidateVotes::iterator i = firsts.begin ();
+      i != firsts.end (); ++i)
+    {
+      if (leaders.empty () || i->second > firsts[leaders[0]])
+        plurality_correct = false;
+    }
+  }
+
+  if (cumulative_correct)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Cumulative tally after each poll: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Cumulative tally after each poll: FAIL\n");
+    ++gams_fails;
+  }
+
+  if (plurality_correct)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Plurality tally after each poll: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Plurality tally after each poll: FAIL\n");
+    ++gams_fails;
+  }
+}
+
+void test_late_voter (void)
+{
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing ballots from late voters\n");
+
+  knowledge::KnowledgeBase knowledge;
+
+  // ballots arrive from elsewhere, e.g., the transport
+  knowledge.set ("election.late.0.agent.0->candidate.a",
+    knowledge::KnowledgeRecord::Integer (3));
+  knowledge.set ("election.late.0.agent.1->candidate.b",
+    knowledge::KnowledgeRecord::Integer (2));
+
+  elections::ElectionCumulative cumulative (
+    "election.late", "agent.0", &knowledge);
+  elections::ElectionPlurality plurality (
+    "election.late", "agent.0", &knowledge);
+
+  std::string leader = cumulative.get_leader ();
+  plurality.get_leader ();
+
+  if (leader == "candidate.a")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Cumulative leader before late voters == candidate.a: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Cumulative leader before late voters == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+
+  // voters the elections have not seen cast ballots
+  knowledge.set ("election.late.0.agent.2->candidate.b",
+    knowledge::KnowledgeRecord::Integer (4));
+  knowledge.set ("election.late.0.agent.3->candidate.b",
+    knowledge::KnowledgeRecord::Integer (1));
+
+  // polling does not search for them
+  leader = cumulative.get_leader ();
+
+  if (leader == "candidate.a")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Cumulative leader before sync == candidate.a: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Cumulative leader before sync == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+
+  cumulative.sync ();
+  plurality.sync ();
+
+  leader = cumulative.get_leader ();
+
+  if (leader == "candidate.b")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Cumulative leader after late voters == candidate.b: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Cumulative leader after late voters == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+
+  leader = plurality.get_leader ();
+
+  if (leader == "candidate.b")
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Plurality leader after late voters == candidate.b: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  Plurality leader after late voters == %s: FAIL\n",
+      leader.c_str ());
+    ++gams_fails;
+  }
+}
+
 int
 main (int, char **)
 {
   test_cumulative ();
   test_plurality ();
+  test_changing_ballots ();
+  test_late_voter ();
   
   if (gams_fails > 0)
   {
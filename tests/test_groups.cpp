@@ -252,6 +252,139 @@ void test_repository (knowledge::KnowledgeBase & knowledge)
   }
 }
 
+void test_versions (knowledge::KnowledgeBase & knowledge)
+{
+  loggers::global_logger->log (
+    0, "Testing group membership versions\n");
+
+  groups::GroupTransient group ("group.versioned", &knowledge);
+  containers::Map members ("group.versioned.members", knowledge);
+
+  members.set ("agent.0", 1);
+  members.set ("agent.1", 1);
+  group.sync ();
+
+  uint64_t version = group.get_version ();
+  const groups::AgentVector & list = group.get_member_list ();
+
+  // a sync with no changes should keep the version and cached list
+  members.set ("agent.1", 2);
+  group.sync ();
+
+  if (group.get_version () == version &&
+    &group.get_member_list () == &list && list.size () == 2)
+  {
+    loggers::global_logger->log (
+      0, "  SUCCESS: unchanged membership kept its version\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      0, "  FAIL: unchanged membership changed version %d to %d\n",
+      (int)version, (int)group.get_version ());
+    ++gams_fails;
+  }
+
+  // a new key in the knowledge base should be applied on sync
+  knowledge.set ("group.versioned.members.agent.2", 1);
+  group.sync ();
+
+  if (group.get_version () != version && list.size () == 3 &&
+    list[2] == "agent.2" && group.is_member ("agent.2"))
+  {
+    loggers::global_logger->log (
+      0, "  SUCCESS: added member changed version\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      0, "  FAIL: added member was not applied (%d members)\n",
+      (int)group.get_member_list ().size ());
+    ++gams_fails;
+  }
+
+  version = group.get_version ();
+  knowledge.delete_variable ("group.versioned.members.agent.0");
+  group.sync ();
+
+  if (group.get_version () != version && list.size () == 2 &&
+    list[0] == "agent.1" && !group.is_member ("agent.0"))
+  {
+    loggers::global_logger->log (
+      0, "  SUCCESS: removed member changed version\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      0, "  FAIL: removed member was not applied (%d members)\n",
+      (int)group.get_member_list ().size ());
+    ++gams_fails;
+  }
+}
+
+void test_agent_ids (void)
+{
+  loggers::global_logger->log (
+    0, "Testing interned agent ids\n");
+
+  groups::AgentVector members;
+  members.push_back ("agent.5");
+  members.push_back ("agent.2");
+  members.push_back ("agent.9");
+
+  groups::GroupFixedList group;
+  group.add_members (members);
+
+  groups::AgentId id = groups::get_agent_id ("agent.2");
+
+  if (groups::get_agent_id ("agent.2") == id &&
+    groups::get_agent_prefix (id) == "agent.2")
+  {
+    loggers::global_logger->log (
+      0, "  SUCCESS: agent ids are stable and map back to prefixes\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      0, "  FAIL: agent id %d did not map back to agent.2\n", (int)id);
+    ++gams_fails;
+  }
+
+  if (group.is_member_id (id) &&
+    !group.is_member_id (groups::get_agent_id ("agent.3")) &&
+    group.get_member_index (id) == 1 &&
+    group.get_member_index ("agent.9") == 2 &&
+    group.get_member_index ("agent.7") == -1 &&
+    group.get_member_ids ().size () == 3)
+  {
+    loggers::global_logger->log (
+      0, "  SUCCESS: group id membership and indices are correct\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      0, "  FAIL: group id membership or indices were incorrect\n");
+    ++gams_fails;
+  }
+
+  members.clear ();
+  members.push_back ("agent.3");
+  group.add_members (members);
+
+  if (group.is_member_id (groups::get_agent_id ("agent.3")) &&
+    group.get_member_index ("agent.3") == 3)
+  {
+    loggers::global_logger->log (
+      0, "  SUCCESS: id membership follows added members\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      0, "  FAIL: id membership did not follow added members\n");
+    ++gams_fails;
+  }
+}
+
 int main(int , char **)
 {
   knowledge::KnowledgeRecord::set_precision (6);
@@ -262,6 +395,8 @@ int main(int , char **)
   test_fixed_list (knowledge);
   test_transient (knowledge);
   test_repository (knowledge);
+  test_versions (knowledge);
+  test_agent_ids ();
 
   knowledge.print ();
 
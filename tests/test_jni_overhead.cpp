@@ -0,0 +1,237 @@
+/**
+ * Measures the cost of a native controller calling into a Java platform
+ * and algorithm. The test starts a JVM and has
+ * ai.gams.tests.TestJniOverhead create a controller with its empty
+ * platform and algorithm. It then runs the controller's MAPE loop from the
+ * main thread, which created the JVM and is attached to it, and from a new
+ * native thread, which is not. The Java methods count their calls, so the
+ * time per call is the JNI overhead, including any cost of attaching the
+ * native thread.
+ *
+ * Usage: test_jni_overhead [loops] [classpath]
+ * The classpath defaults to $GAMS_ROOT/lib/gams.jar:$MADARA_ROOT/lib/madara.jar
+ * and the native libraries are loaded from $GAMS_ROOT/lib and
+ * $MADARA_ROOT/lib.
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gams/controllers/BaseController.h"
+#include "gams/loggers/GlobalLogger.h"
+
+#ifdef _GAMS_JAVA_
+#include "gams_jni.h"
+#endif
+
+namespace controllers = gams::controllers;
+namespace loggers = gams::loggers;
+
+int gams_fails = 0;
+
+#ifdef _GAMS_JAVA_
+
+/**
+ * Returns an environment variable, or an empty string if it is not set
+ **/
+std::string get_env (const char * name)
+{
+  const char * value = std::getenv (name);
+  return value ? value : "";
+}
+
+/**
+ * Runs loops iterations of the controller's MAPE loop
+ * @return the elapsed time in nanoseconds
+ **/
+long long run_loops (controllers::BaseController & controller, int loops)
+{
+  auto start = std::chrono::steady_clock::now ();
+
+  for (int i = 0; i < loops; ++i)
+  {
+    controller.monitor ();
+    controller.analyze ();
+    controller.plan ();
+    controller.execute ();
+  }
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds> (
+    std::chrono::steady_clock::now () - start).count ();
+}
+
+/**
+ * Runs and reports loops of the MAPE loop, counting the calls into Java
+ * @return the calls per loop
+ **/
+double measure (JNIEnv * env, jclass test_class, jfieldID calls,
+  controllers::BaseController & controller, int loops, bool native_thread,
+  const std::string & label)
+{
+  env->SetStaticLongField (test_class, calls, 0);
+
+  long long elapsed = 0;
+
+  if (native_thread)
+  {
+    // the thread attaches on its first call into Java
+    std::thread runner ([&] { elapsed = run_loops (controller, loops); });
+    runner.join ();
+  }
+  else
+  {
+    elapsed = run_loops (controller, loops);
+  }
+
+  long long count = env->GetStaticLongField (test_class, calls);
+
+  std::cout << label << ":\n";
+  std::cout << "  " << elapsed / 1000000 << " ms total\n";
+  std::cout << "  " << count << " calls into Java, " <<
+    (double)count / loops << " per loop\n";
+
+  if (count > 0)
+  {
+    std::cout << "  " << (double)elapsed / count / 1000.0 <<
+      " us per call into Java\n";
+  }
+
+  return (double)count / loops;
+}
+
+#endif
+
+int
+main (int argc, char ** argv)
+{
+#ifdef _GAMS_JAVA_
+  int loops = 100000;
+
+  if (argc > 1)
+  {
+    std::stringstream buffer (argv[1]);
+    buffer >> loops;
+  }
+
+  const std::string gams_root = get_env ("GAMS_ROOT");
+  const std::string madara_root = get_env ("MADARA_ROOT");
+
+  std::string classpath = argc > 2 ? argv[2] :
+    gams_root + "/lib/gams.jar:" + madara_root + "/lib/madara.jar";
+
+  std::string classpath_option = "-Djava.class.path=" + classpath;
+  std::string library_option = "-Djava.library.path=" +
+    gams_root + "/lib:" + madara_root + "/lib";
+
+  JavaVMOption options[2];
+  options[0].optionString = (char *)classpath_option.c_str ();
+  options[1].optionString = (char *)library_option.c_str ();
+
+  JavaVMInitArgs vm_args;
+  vm_args.version = JNI_VERSION_1_6;
+  vm_args.nOptions = 2;
+  vm_args.options = options;
+  vm_args.ignoreUnrecognized = JNI_FALSE;
+
+  JavaVM * vm = 0;
+  JNIEnv * env = 0;
+
+  if (JNI_CreateJavaVM (&vm, (void **)&env, &vm_args) != JNI_OK)
+  {
+    std::cerr << "Unable to create a JVM with " << classpath_option << "\n";
+    return 1;
+  }
+
+  // the controller, platform and algorithm are set up in Java, as a Java
+  // application would, which also loads the GAMS library into the JVM
+  jclass test_class = env->FindClass ("ai/gams/tests/TestJniOverhead");
+
+  jfieldID calls = 0;
+  jobject java_controller = 0;
+
+  if (test_class)
+  {
+    calls = env->GetStaticFieldID (test_class, "calls", "J");
+
+    jmethodID create = env->GetStaticMethodID (test_class,
+      "createController", "()Lai/gams/controllers/BaseController;");
+
+    if (calls && create)
+      java_controller = env->CallStaticObjectMethod (test_class, create);
+  }
+
+  controllers::BaseController * controller = 0;
+
+  if (java_controller && !env->ExceptionCheck ())
+  {
+    jclass controller_class = env->GetObjectClass (java_controller);
+    controller = (controllers::BaseController *) env->CallLongMethod (
+      java_controller, env->GetMethodID (controller_class, "getCPtr", "()J"));
+    env->DeleteLocalRef (controller_class);
+  }
+
+  if (!controller)
+  {
+    if (env->ExceptionCheck ())
+      env->ExceptionDescribe ();
+
+    std::cerr << "Unable to create a controller with " <<
+      "ai.gams.tests.TestJniOverhead from " << classpath << "\n";
+    vm->DestroyJavaVM ();
+    return 1;
+  }
+
+  // in case the JVM loaded the library before it existed
+  if (!gams_jni_jvm ())
+  {
+    JNI_OnLoad (vm, 0);
+  }
+
+  std::cout << "Warming up for " << loops / 10 << " loops...\n";
+  run_loops (*controller, loops / 10);
+
+  std::cout << "Running " << loops << " loops...\n";
+
+  double attached = measure (env, test_class, calls, *controller, loops,
+    false, "From the thread that created the JVM");
+  double native = measure (env, test_class, calls, *controller, loops,
+    true, "From a new native thread");
+
+  // both threads should make the same calls
+  if (attached == 0 || attached != native)
+  {
+    std::cout << "  " << attached << " and " << native <<
+      " calls per loop: FAIL\n";
+    ++gams_fails;
+  }
+
+  jmethodID release = env->GetStaticMethodID (test_class, "free", "()V");
+  if (release)
+    env->CallStaticVoidMethod (test_class, release);
+
+  env->DeleteLocalRef (java_controller);
+
+  vm->DestroyJavaVM ();
+#else
+  (void)argc;
+  (void)argv;
+
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "Java support (_GAMS_JAVA_) is not enabled: SKIPPED\n");
+#endif
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
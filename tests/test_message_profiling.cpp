@@ -0,0 +1,288 @@
+/**
+ * Tests the message window of the MessageProfiling filter: ids sliding
+ * out of the 1024-id window, ids that wrap onto the same bit, duplicates
+ * and ids that arrive after falling out of the window.
+ **/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "gams/algorithms/MessageProfiling.h"
+#include "madara/knowledge/KnowledgeBase.h"
+
+namespace algorithms = gams::algorithms;
+namespace engine = madara::knowledge;
+
+typedef algorithms::MessageProfiling::MessageFilter Filter;
+
+int gams_fails = 0;
+
+#define TEST(expr, expect) \
+  do {\
+    long long v = (long long)(expr);\
+    long long e = (long long)(expect);\
+    std::cout << "  " << #expr << " ?= " << e;\
+    if (v == e)\
+    {\
+      std::cout << " SUCCESS\n";\
+    }\
+    else\
+    {\
+      std::cout << " FAIL (got " << v << ")\n";\
+      ++gams_fails;\
+    }\
+  } while(0)
+
+#define TEST_STRING(expr, expect) \
+  do {\
+    std::string v = (expr);\
+    std::string e = (expect);\
+    std::cout << "  " << #expr << " ?= \"" << e << "\"";\
+    if (v == e)\
+    {\
+      std::cout << " SUCCESS\n";\
+    }\
+    else\
+    {\
+      std::cout << " FAIL (got \"" << v << "\")\n";\
+      ++gams_fails;\
+    }\
+  } while(0)
+
+/**
+ * Lists the ids missing from an originator's window, as
+ * missing_messages_string does
+ **/
+std::string
+missing (const Filter & filter, const std::string & origin)
+{
+  std::string lines = filter.missing_messages_string ();
+  std::string prefix = origin + ": ";
+
+  std::istringstream stream (lines);
+  std::string line;
+  while (std::getline (stream, line))
+  {
+    if (line.compare (0, prefix.size (), prefix) == 0)
+      return line.substr (prefix.size ());
+  }
+  return "?";
+}
+
+void
+test_in_order (void)
+{
+  std::cout << "Testing ids received in order...\n";
+
+  Filter filter;
+  for (int i = 0; i < 10; ++i)
+    filter.add ("agent.0", i, -1);
+
+  const Filter::MessageData & data = filter.msg_map["agent.0"];
+  TEST (data.first, 0);
+  TEST (data.last, 9);
+  TEST (data.received, 10);
+  TEST (data.duplicates, 0);
+  TEST (data.late, 0);
+  TEST_STRING (missing (filter, "agent.0"), "");
+}
+
+void
+test_duplicates (void)
+{
+  std::cout << "Testing duplicate ids...\n";
+
+  Filter filter;
+  for (int i = 0; i < 10; ++i)
+    filter.add ("agent.0", i, -1);
+
+  filter.add ("agent.0", 9, -1);
+  filter.add ("agent.0", 3, -1);
+  filter.add ("agent.0", 3, -1);
+
+  const Filter::MessageData & data = filter.msg_map["agent.0"];
+  TEST (data.received, 10);
+  TEST (data.duplicates, 3);
+  TEST (data.late, 0);
+
+  // duplicates of the other originator are counted separately
+  filter.add ("agent.1", 3, -1);
+  TEST (filter.msg_map["agent.1"].received, 1);
+  TEST (filter.msg_map["agent.1"].duplicates, 0);
+}
+
+void
+test_gaps (void)
+{
+  std::cout << "Testing gaps filled by reordered ids...\n";
+
+  Filter filter;
+  for (int i = 0; i < 10; ++i)
+    filter.add ("agent.0", i, -1);
+
+  filter.add ("agent.0", 13, -1);
+  TEST_STRING (missing (filter, "agent.0"), "10,11,12,");
+
+  filter.add ("agent.0", 11, -1);
+  TEST_STRING (missing (filter, "agent.0"), "10,12,");
+
+  const Filter::MessageData & data = filter.msg_map["agent.0"];
+  TEST (data.last, 13);
+  TEST (data.received, 12);
+  TEST (data.duplicates, 0);
+
+  // an id below the first one is still in the window
+  Filter late_start;
+  late_start.add ("agent.0", 5, -1);
+  late_start.add ("agent.0", 3, -1);
+  TEST (late_start.msg_map["agent.0"].first, 3);
+  TEST (late_start.msg_map["agent.0"].received, 2);
+  TEST_STRING (missing (late_start, "agent.0"), "4,");
+}
+
+void
+test_window_slide (void)
+{
+  std::cout << "Testing the window sliding past a gap...\n";
+
+  Filter filter;
+  for (int i = 0; i < 2048; ++i)
+  {
+    if (i != 100)
+      filter.add ("agent.0", i, -1);
+  }
+
+  // the gap at 100 has left the window (1023, 2047]
+  const Filter::MessageData & data = filter.msg_map["agent.0"];
+  TEST (data.first, 0);
+  TEST (data.last, 2047);
+  TEST (data.received, 2047);
+  TEST_STRING (missing (filter, "agent.0"), "");
+
+  // so a late arrival can't be told apart from a duplicate
+  filter.add ("agent.0", 100, -1);
+  filter.add ("agent.0", 1023, -1);
+  TEST (data.received, 2047);
+  TEST (data.duplicates, 0);
+  TEST (data.late, 2);
+
+  // the oldest id still in the window is a duplicate
+  filter.add ("agent.0", 1024, -1);
+  TEST (data.duplicates, 1);
+  TEST (data.late, 2);
+}
+
+void
+test_wraparound (void)
+{
+  std::cout << "Testing ids that wrap onto the same bit...\n";
+
+  Filter filter;
+  for (int i = 0; i < 1024; ++i)
+    filter.add ("agent.0", i, -1);
+
+  // 1030 uses the bit of 6, and 1024-1029 the bits of 0-5
+  filter.add ("agent.0", 1030, -1);
+  TEST_STRING (missing (filter, "agent.0"),
+    "1024,1025,1026,1027,1028,1029,");
+
+  const Filter::MessageData & data = filter.msg_map["agent.0"];
+  TEST (data.received, 1025);
+
+  // 1030 is not mistaken for the 6 that shared its bit, and vice versa
+  filter.add ("agent.0", 1030, -1);
+  TEST (data.duplicates, 1);
+  filter.add ("agent.0", 6, -1);
+  TEST (data.late, 1);
+  TEST (data.received, 1025);
+
+  // nor are the cleared bits of 0-5 taken as 1024-1029
+  filter.add ("agent.0", 1025, -1);
+  TEST (data.received, 1026);
+  TEST (data.duplicates, 1);
+  TEST_STRING (missing (filter, "agent.0"),
+    "1024,1026,1027,1028,1029,");
+}
+
+void
+test_jump (void)
+{
+  std::cout << "Testing a jump of more than the window...\n";
+
+  Filter filter;
+  for (int i = 0; i < 10; ++i)
+    filter.add ("agent.0", i, -1);
+
+  filter.add ("agent.0", 5000, -1);
+
+  const Filter::MessageData & data = filter.msg_map["agent.0"];
+  TEST (data.last, 5000);
+  TEST (data.received, 11);
+
+  // every id before 5000 in the window is missing
+  std::string gaps = missing (filter, "agent.0");
+  size_t count = 0;
+  for (size_t i = 0; i < gaps.size (); ++i)
+  {
+    if (gaps[i] == ',')
+      ++count;
+  }
+  TEST (count, Filter::WINDOW - 1);
+  TEST (gaps.compare (0, 5, "3977,"), 0);
+
+  // an old id whose bit was set before the jump is not a duplicate
+  filter.add ("agent.0", 4005, -1);
+  TEST (data.received, 12);
+  TEST (data.duplicates, 0);
+}
+
+void
+test_to_knowledge (void)
+{
+  std::cout << "Testing statistics saved to the knowledge base...\n";
+
+  Filter filter;
+  for (int i = 0; i < 2048; ++i)
+  {
+    if (i != 100 && i != 2000)
+      filter.add ("agent.0", i, 3);
+  }
+  filter.add ("agent.0", 2047, 3);
+  filter.add ("agent.0", 100, 3);
+
+  engine::KnowledgeBase knowledge;
+  filter.to_knowledge (knowledge, "message_profiling");
+
+  const std::string key = "message_profiling.agent.0.";
+  TEST (knowledge.get (key + "count").to_integer (), 2048);
+  TEST (knowledge.get (key + "received").to_integer (), 2046);
+  // 100 arrived late, so only 2000 is lost
+  TEST (knowledge.get (key + "lost").to_integer (), 1);
+  TEST (knowledge.get (key + "duplicates").to_integer (), 1);
+  TEST (knowledge.get (key + "late").to_integer (), 1);
+  TEST (knowledge.get (key + "latency.max").to_integer (), 3);
+}
+
+int
+main (int /*argc*/, char ** /*argv*/)
+{
+  test_in_order ();
+  test_duplicates ();
+  test_gaps ();
+  test_window_slide ();
+  test_wraparound ();
+  test_jump ();
+  test_to_knowledge ();
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
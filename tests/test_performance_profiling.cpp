@@ -0,0 +1,205 @@
+/**
+ * Tests the PerformanceProfiling algorithm: each execute runs one bounded
+ * slice of the current benchmark, a benchmark only reports once it has run
+ * for its full duration, and a copy of the algorithm keeps its results.
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "madara/knowledge/KnowledgeBase.h"
+
+#include "gams/algorithms/PerformanceProfiling.h"
+#include "gams/variables/Self.h"
+
+namespace algorithms = gams::algorithms;
+namespace knowledge = madara::knowledge;
+namespace variables = gams::variables;
+
+typedef algorithms::PerformanceProfiling Profiling;
+
+int gams_fails = 0;
+
+/**
+ * Prints and counts the result of a check
+ **/
+void
+check (const std::string & label, bool passed)
+{
+  std::cout << "  Testing " << label << ": ";
+  if (passed)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+}
+
+/**
+ * Executes an algorithm until it finishes
+ * @return the number of executes, or 0 if it did not finish
+ **/
+int
+run_to_end (Profiling & profiling)
+{
+  for (int executes = 1; executes <= 1000; ++executes)
+  {
+    if (profiling.execute () & algorithms::FINISHED)
+      return executes;
+  }
+  return 0;
+}
+
+void
+test_slices (void)
+{
+  std::cout << "Testing PerformanceProfiling runs in slices...\n";
+
+  knowledge::KnowledgeBase knowledge;
+  variables::Self self;
+  self.init_vars (knowledge, 0);
+
+  // 0.2 s per benchmark in 0.05 s slices, without a platform
+  const double duration = 0.2, slice = 0.05;
+  Profiling profiling (&knowledge, 0, 0, &self, duration, 10, false, slice);
+
+  const std::string local = ".performance_profiling.";
+  const std::string global = self.agent.prefix + ".performance_profiling.";
+
+  bool bounded = true, in_order = true, reported = true, sliced = true;
+  bool skipped = true;
+  double slowest = 0;
+  int slices = 0;
+  knowledge::KnowledgeRecord::Integer completed = 0;
+
+  int result = 0;
+  for (int executes = 0; executes < 1000 &&
+    !(result & algorithms::FINISHED); ++executes)
+  {
+    auto before = std::chrono::steady_clock::now ();
+    result = profiling.execute ();
+    double seconds = std::chrono::duration<double> (
+      std::chrono::steady_clock::now () - before).count ();
+
+    slowest = std::max (slowest, seconds);
+    if (seconds > slice + 0.1)
+      bounded = false;
+
+    ++slices;
+
+    knowledge::KnowledgeRecord::Integer now =
+      knowledge.get (local + "completed").to_integer ();
+
+    // a benchmark reports only in the execute that completes it
+    if (now < completed || now > completed + 1)
+      in_order = false;
+
+    for (knowledge::KnowledgeRecord::Integer i = now;
+      i < Profiling::NUM_BENCHMARKS; ++i)
+    {
+      if (knowledge.exists (local + Profiling::get_name (
+        (Profiling::Benchmarks)i) + ".iterations"))
+        reported = false;
+    }
+
+    if (now == completed + 1)
+    {
+      const Profiling::Benchmarks benchmark =
+        (Profiling::Benchmarks)completed;
+      const std::string key = local + Profiling::get_name (benchmark) + ".";
+      const std::string global_key =
+        global + Profiling::get_name (benchmark) + ".";
+
+      knowledge::KnowledgeRecord::Integer iterations =
+        knowledge.get (key + "iterations").to_integer ();
+      double mean = knowledge.get (key + "mean_ns").to_double ();
+
+      if (benchmark == Profiling::PLATFORM_SENSE ||
+        benchmark == Profiling::PLATFORM_MOVE)
+      {
+        // without a platform, these report nothing in a single slice
+        if (iterations != 0 || slices != 1)
+          skipped = false;
+      }
+      else
+      {
+        if (iterations <= 0 || mean <= 0 ||
+          knowledge.get (key + "min_ns").to_double () > mean ||
+          knowledge.get (key + "max_ns").to_double () < mean ||
+          knowledge.get (global_key + "iterations").to_integer () !=
+            iterations)
+          reported = false;
+
+        // the duration is spread over about duration / slice executes
+        if (slices < 3)
+          sliced = false;
+      }
+
+      slices = 0;
+      completed = now;
+    }
+  }
+
+  check ("every benchmark completes",
+    (result & algorithms::FINISHED) &&
+    completed == Profiling::NUM_BENCHMARKS &&
+    knowledge.get (global + "completed").to_integer () == completed);
+  check ("benchmarks complete one at a time, in order", in_order);
+  check ("results are saved only when a benchmark completes", reported);
+  check ("a benchmark takes several executes", sliced);
+  check ("platform benchmarks are skipped without a platform", skipped);
+
+  std::cout << "  Slowest execute: " << slowest * 1000 << " ms\n";
+  check ("an execute lasts about a slice", bounded);
+}
+
+void
+test_assignment (void)
+{
+  std::cout << "Testing PerformanceProfiling assignment...\n";
+
+  knowledge::KnowledgeBase knowledge;
+  variables::Self self;
+  self.init_vars (knowledge, 0);
+
+  Profiling profiling (&knowledge, 0, 0, &self, 0.01, 10, false, 0.01);
+  check ("the original finishes", run_to_end (profiling) > 0);
+
+  const double sink =
+    knowledge.get (".performance_profiling.sink").to_double ();
+
+  // a finished copy reports the same accumulated results
+  knowledge::KnowledgeBase copy_knowledge;
+  variables::Self copy_self;
+  copy_self.init_vars (copy_knowledge, 1);
+
+  Profiling copy (&copy_knowledge, 0, 0, &copy_self, 1.0, 10, false, 0.01);
+  copy = profiling;
+
+  check ("the copy is finished", run_to_end (copy) == 1);
+  check ("the copy keeps the results", sink != 0 &&
+    copy_knowledge.get (".performance_profiling.sink").to_double () == sink);
+}
+
+int
+main (int /*argc*/, char ** /*argv*/)
+{
+  test_slices ();
+  test_assignment ();
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
@@ -0,0 +1,395 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names Carnegie Mellon University, "SEI and/or Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN AS-IS BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file test_simulated_platform.cpp
+ *
+ * Tests the functionality of gams::platforms::SimulatedWorld and
+ * gams::platforms::SimulatedPlatform
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "madara/knowledge/KnowledgeBase.h"
+
+#include "gams/platforms/SimulatedPlatform.h"
+#include "gams/pose/GPSFrame.h"
+#include "gams/loggers/GlobalLogger.h"
+
+namespace loggers = gams::loggers;
+namespace platforms = gams::platforms;
+namespace variables = gams::variables;
+namespace pose = gams::pose;
+namespace knowledge = madara::knowledge;
+
+using platforms::SimulatedWorld;
+
+int gams_fails = 0;
+
+/**
+ * Adds agents of both kinds with random starts and destinations
+ **/
+void add_agents (SimulatedWorld & world, size_t count)
+{
+  std::mt19937 generator (1);
+  std::uniform_real_distribution<double> coordinate (-500.0, 500.0);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    size_t index = world.add (
+      i % 2 ? SimulatedWorld::GROUND : SimulatedWorld::QUADROTOR,
+      coordinate (generator), coordinate (generator), 5.0, 2.0 + i % 5);
+
+    world.set_destination (index,
+      coordinate (generator), coordinate (generator), 20.0);
+  }
+}
+
+void test_kinematics (void)
+{
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing SimulatedWorld kinematics\n");
+
+  SimulatedWorld world;
+  world.set_threads (1);
+
+  double x, y, z, yaw;
+
+  // a quadrotor flies straight at its speed
+  size_t quad = world.add (SimulatedWorld::QUADROTOR, 0, 0, 0, 2.0);
+  world.set_destination (quad, 10, 0, 0);
+
+  for (size_t i = 0; i < 4; ++i)
+    world.step (0.5);
+
+  bool moving = world.get_state (quad, x, y, z, yaw);
+
+  if (moving && std::fabs (x - 4.0) < 1e-9)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Quadrotor speed: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Quadrotor speed: FAIL. x == %f\n", x);
+    ++gams_fails;
+  }
+
+  for (size_t i = 0; i < 6; ++i)
+    world.step (0.5);
+
+  moving = world.get_state (quad, x, y, z, yaw);
+
+  if (!moving && x == 10 && std::fabs (world.get_time () - 5.0) < 1e-9)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Quadrotor arrival: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Quadrotor arrival: FAIL\n");
+    ++gams_fails;
+  }
+
+  // a ground robot turns around before driving and keeps its altitude
+  size_t ground = world.add (SimulatedWorld::GROUND, 0, 0, 1, 1.0);
+  world.set_destination (ground, -5, 0, 9);
+
+  size_t steps = 0;
+  while (world.get_state (ground, x, y, z, yaw) && steps < 1000)
+  {
+    world.step (0.1);
+    ++steps;
+  }
+
+  // 2 seconds to turn around, then 5 seconds to drive
+  if (x == -5 && y == 0 && z == 1 && steps > 55 && steps < 75)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Ground robot turn and drive: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Ground robot turn and drive: FAIL."
+      " [%f, %f, %f] after %d steps\n", x, y, z, (int)steps);
+    ++gams_fails;
+  }
+}
+
+void test_threads (void)
+{
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing SimulatedWorld threaded steps\n");
+
+  const size_t count = 20000;
+
+  SimulatedWorld single, threaded;
+  single.set_threads (1);
+  threaded.set_threads (4);
+  add_agents (single, count);
+  add_agents (threaded, count);
+
+  for (size_t i = 0; i < 100; ++i)
+  {
+    single.step (0.05);
+    threaded.step (0.05);
+  }
+
+  bool same = true;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    double x1, y1, z1, yaw1, x2, y2, z2, yaw2;
+    bool moving1 = single.get_state (i, x1, y1, z1, yaw1);
+    bool moving2 = threaded.get_state (i, x2, y2, z2, yaw2);
+
+    if (x1 != x2 || y1 != y2 || z1 != z2 || yaw1 != yaw2 ||
+      moving1 != moving2)
+    {
+      same = false;
+    }
+  }
+
+  if (same)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Threaded step matches one thread: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Threaded step matches one thread: FAIL\n");
+    ++gams_fails;
+  }
+}
+
+void test_benchmark (void)
+{
+  typedef std::chrono::steady_clock Clock;
+
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing SimulatedWorld with 10000 agents\n");
+
+  const size_t count = 10000;
+  const size_t steps = 200;
+  const double dt = 0.05;
+
+  SimulatedWorld world;
+  add_agents (world, count);
+
+  Clock::time_point start = Clock::now ();
+
+  for (size_t i = 0; i < steps; ++i)
+    world.step (dt);
+
+  double elapsed = std::chrono::duration<double> (
+    Clock::now () - start).count ();
+
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "  %d threads: %f ms per step, %fx real time\n",
+    (int)world.get_threads (), elapsed * 1000 / steps, steps * dt / elapsed);
+
+  if (steps * dt > elapsed)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Faster than real time: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Faster than real time: FAIL\n");
+    ++gams_fails;
+  }
+
+  // the stepper thread runs at 50 Hz, 10 times faster than real time
+  SimulatedWorld stepped;
+  add_agents (stepped, 1000);
+  stepped.run (50, 10);
+
+  std::this_thread::sleep_for (std::chrono::milliseconds (500));
+  stepped.terminate ();
+
+  if (stepped.get_time () > 3.0 && !stepped.is_running ())
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Stepper simulated %f s in 0.5 s: SUCCESS\n",
+      stepped.get_time ());
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  Stepper simulated %f s in 0.5 s: FAIL\n",
+      stepped.get_time ());
+    ++gams_fails;
+  }
+}
+
+void test_platform (void)
+{
+  loggers::global_logger->log (
+    loggers::LOG_ALWAYS, "Testing SimulatedPlatform\n");
+
+  const size_t count = 100;
+
+  knowledge::KnowledgeBase knowledge;
+
+  // step the shared world manually
+  knowledge.set (".sim_hertz", 0.0);
+  knowledge.set (".sim_move_speed", 5.0);
+  knowledge.set (".sim_accuracy", 0.5);
+  knowledge.set (".vrep_sw_position",
+    knowledge::KnowledgeRecord (std::vector<double> {40.443077, -79.940570}));
+
+  variables::Sensors sensors;
+  variables::Platforms statuses;
+  std::vector<std::unique_ptr<variables::Self>> selves;
+  std::vector<std::unique_ptr<platforms::BasePlatform>> agents;
+
+  platforms::SimulatedPlatformFactory quads (SimulatedWorld::QUADROTOR);
+  platforms::SimulatedPlatformFactory grounds (SimulatedWorld::GROUND);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    selves.emplace_back (new variables::Self ());
+    selves.back ()->init_vars (knowledge, i);
+
+    knowledge.set (".initial_x", (double)i);
+    knowledge.set (".initial_y", 0.0);
+
+    agents.emplace_back ((i % 2 ? grounds : quads).create (
+      knowledge::KnowledgeMap (), &knowledge, &sensors, &statuses,
+      selves.back ().get ()));
+  }
+
+  // every agent goes 30 meters north of the origin, spread by its index
+  SimulatedWorld & world = SimulatedWorld::instance ();
+  std::vector<pose::Position> targets;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    platforms::SimulatedPlatform * platform =
+      dynamic_cast<platforms::SimulatedPlatform *> (agents[i].get ());
+
+    targets.push_back (pose::Position (pose::gps_frame (), pose::Position (
+      platform->get_world_frame (), (double)i, 30.0, 0.0)));
+  }
+
+  size_t arrived = 0;
+
+  for (size_t step = 0; step < 200 && arrived < count; ++step)
+  {
+    world.step (0.1);
+    arrived = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      agents[i]->sense ();
+
+      if (agents[i]->move (targets[i], agents[i]->get_accuracy ()) == 2)
+        ++arrived;
+    }
+  }
+
+  // compare in the world frame, where positions are in meters
+  double worst = 0;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    platforms::SimulatedPlatform * platform =
+      dynamic_cast<platforms::SimulatedPlatform *> (agents[i].get ());
+
+    double x, y, z, yaw;
+    world.get_state (platform->get_world_index (), x, y, z, yaw);
+
+    worst = std::max (worst,
+      std::sqrt ((x - (double)i) * (x - (double)i) + (y - 30) * (y - 30)));
+  }
+
+  if (arrived == count && worst <= 0.5)
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS, "  All %d platforms arrived within %f m: SUCCESS\n",
+      (int)count, worst);
+  }
+  else
+  {
+    loggers::global_logger->log (
+      loggers::LOG_ALWAYS,
+      "  %d of %d platforms arrived, farthest %f m away: FAIL\n",
+      (int)arrived, (int)count, worst);
+    ++gams_fails;
+  }
+}
+
+int
+main (int, char **)
+{
+  test_kinematics ();
+  test_threads ();
+  test_benchmark ();
+  test_platform ();
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
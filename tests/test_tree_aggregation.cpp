@@ -0,0 +1,562 @@
+/**
+ * Copyright (c) 2026 Carnegie Mellon University. All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following acknowledgments and disclaimers.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. The names Carnegie Mellon University, "SEI and/or Software
+ *    Engineering Institute" shall not be used to endorse or promote products
+ *    derived from this software without prior written permission. For written
+ *    permission, please contact permission@sei.cmu.edu.
+ * 
+ * 4. Products derived from this software may not be called "SEI" nor may "SEI"
+ *    appear in their names without prior written permission of
+ *    permission@sei.cmu.edu.
+ * 
+ * 5. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ * 
+ *      This material is based upon work funded and supported by the Department
+ *      of Defense under Contract No. FA8721-05-C-0003 with Carnegie Mellon
+ *      University for the operation of the Software Engineering Institute, a
+ *      federally funded research and development center. Any opinions,
+ *      findings and conclusions or recommendations expressed in this material
+ *      are those of the author(s) and do not necessarily reflect the views of
+ *      the United States Department of Defense.
+ * 
+ *      NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *      INSTITUTE MATERIAL IS FURNISHED ON AN AS-IS BASIS. CARNEGIE MELLON
+ *      UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR
+ *      IMPLIED, AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF
+ *      FITNESS FOR PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS
+ *      OBTAINED FROM USE OF THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES
+ *      NOT MAKE ANY WARRANTY OF ANY KIND WITH RESPECT TO FREEDOM FROM PATENT,
+ *      TRADEMARK, OR COPYRIGHT INFRINGEMENT.
+ * 
+ *      This material has been approved for public release and unlimited
+ *      distribution.
+ **/
+
+/**
+ * @file test_tree_aggregation.cpp
+ *
+ * Tests tree aggregation of auctions and elections with many agent
+ * processes on one host, and the records each agent has to receive with
+ * and without the tree
+ **/
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "madara/knowledge/KnowledgeBase.h"
+#include "madara/utility/Utility.h"
+
+#include "gams/auctions/AuctionMaximumBid.h"
+#include "gams/elections/ElectionPlurality.h"
+#include "gams/groups/GroupFixedList.h"
+#include "gams/groups/GroupTree.h"
+#include "gams/loggers/GlobalLogger.h"
+
+namespace loggers = gams::loggers;
+namespace auctions = gams::auctions;
+namespace elections = gams::elections;
+namespace groups = gams::groups;
+namespace knowledge = madara::knowledge;
+namespace transport = madara::transport;
+
+int gams_fails = 0;
+
+const size_t num_agents = 200;
+const size_t fanout = 4;
+
+std::string agent_name (size_t id)
+{
+  std::stringstream buffer;
+  buffer << "agent." << id;
+  return buffer.str ();
+}
+
+double bid_amount (size_t id)
+{
+  return (double)((id * 7919) % 1000) + (id % 3) * 0.5;
+}
+
+std::string vote_candidate (size_t id)
+{
+  return id % 5 < 3 ? "agent.0" : agent_name (1 + id % 2);
+}
+
+/**
+ * Returns the highest bidder, with ties going to the lowest name
+ **/
+std::string expected_auction_leader (void)
+{
+  std::string leader;
+  double best = 0;
+
+  for (size_t i = 0; i < num_agents; ++i)
+  {
+    const std::string name = agent_name (i);
+
+    if (leader == "" || bid_amount (i) > best ||
+      (bid_amount (i) == best && name < leader))
+    {
+      leader = name;
+      best = bid_amount (i);
+    }
+  }
+
+  return leader;
+}
+
+/**
+ * A record that an agent reads and the agent that writes it
+ **/
+struct Source
+{
+  std::string key;
+  size_t writer;
+};
+
+/**
+ * Runs an auction over in-process agents, delivering to each agent only
+ * the records it reads, as a transport that routes records to their
+ * readers would. On a shared multicast group every agent still receives
+ * everything; this measures what each agent depends on.
+ * @param  tree      true to aggregate bids over a tree
+ * @param  messages  records delivered to each agent
+ * @param  bytes     key and value bytes delivered to each agent
+ * @return the number of agents that agreed on the leader
+ **/
+size_t run_traffic (bool tree, const std::string & auction_leader,
+  std::vector<size_t> & messages, std::vector<size_t> & bytes)
+{
+  groups::GroupFixedList group;
+  groups::AgentVector members;
+  for (size_t i = 0; i < num_agents; ++i)
+    members.push_back (agent_name (i));
+  group.add_members (members);
+
+  groups::GroupTree layout (fanout);
+  layout.set_members (members);
+
+  // the tree sorts its members, so map them back to agent ids
+  std::map<std::string, size_t> ids;
+  for (size_t i = 0; i < num_agents; ++i)
+    ids[members[i]] = i;
+
+  std::vector<knowledge::KnowledgeBase *> kbs;
+  std::vector<auctions::AuctionMaximumBid *> auctions;
+  std::vector<std::vector<Source> > sources (num_agents);
+
+  for (size_t i = 0; i < num_agents; ++i)
+  {
+    const std::string name = agent_name (i);
+    kbs.push_back (new knowledge::KnowledgeBase ());
+
+    auctions::AuctionMaximumBid * auction =
+      new auctions::AuctionMaximumBid ("auction.traffic", name, kbs[i]);
+    auction->add_group (&group);
+    auction->set_tree (tree ? fanout : 0);
+    auction->bid (knowledge::KnowledgeRecord (bid_amount (i)));
+    auctions.push_back (auction);
+
+    Source source;
+
+    if (tree)
+    {
+      // the partials of this agent's children, and the root's result
+      const std::string prefix = auction->get_tree_prefix () + ".";
+      const int index = layout.get_index (name);
+
+      std::vector<size_t> children;
+      layout.get_children ((size_t)index, children);
+
+      for (size_t j = 0; j < children.size (); ++j)
+      {
+        const std::string & child = layout.get_members ()[children[j]];
+        source.key = prefix + child;
+        source.writer = ids[child];
+        sources[i].push_back (source);
+      }
+
+      if (index != 0)
+      {
+        const std::string & root = layout.get_members ()[0];
+        source.key = prefix + root;
+        source.writer = ids[root];
+        sources[i].push_back (source);
+      }
+    }
+    else
+    {
+      // every other agent's bid
+      const std::string prefix = auction->get_auction_round_prefix () + ".";
+
+      for (size_t j = 0; j < num_agents; ++j)
+      {
+        if (j != i)
+        {
+          source.key = prefix + members[j];
+          source.writer = j;
+          sources[i].push_back (source);
+        }
+      }
+    }
+  }
+
+  messages.assign (num_agents, 0);
+  bytes.assign (num_agents, 0);
+
+  bool delivered = true;
+
+  for (size_t round = 0; round < 100 && delivered; ++round)
+  {
+    // each agent publishes its partial result, if it changed
+    for (size_t i = 0; i < num_agents; ++i)
+      auctions[i]->get_leader ();
+
+    delivered = false;
+
+    for (size_t i = 0; i < num_agents; ++i)
+    {
+      for (size_t j = 0; j < sources[i].size (); ++j)
+      {
+        const Source & source = sources[i][j];
+        knowledge::KnowledgeRecord value =
+          kbs[source.writer]->get (source.key);
+
+        if (value.is_valid () && value != kbs[i]->get (source.key))
+        {
+          kbs[i]->set (source.key, value);
+          ++messages[i];
+          bytes[i] += source.key.size () + value.to_string ().size ();
+          delivered = true;
+        }
+      }
+    }
+  }
+
+  size_t agreed = 0;
+
+  for (size_t i = 0; i < num_agents; ++i)
+  {
+    if (auctions[i]->get_leader () == auction_leader &&
+      auctions[i]->get_participation () == 1.0)
+    {
+      ++agreed;
+    }
+
+    delete auctions[i];
+    delete kbs[i];
+  }
+
+  return agreed;
+}
+
+#ifndef _WIN32
+
+/**
+ * Runs one agent until it agrees with the expected auction and election
+ * results, and keeps sending for a while so that slower agents converge
+ * @return 0 if the agent agreed
+ **/
+int run_agent (size_t id, const std::string & auction_leader,
+  const std::string & election_leader)
+{
+  transport::QoSTransportSettings settings;
+  settings.hosts.push_back ("239.255.0.1:4160");
+  settings.type = transport::MULTICAST;
+
+  const std::string name = agent_name (id);
+  knowledge::KnowledgeBase kb (name, settings);
+
+  groups::GroupFixedList group;
+  groups::AgentVector members;
+  for (size_t i = 0; i < num_agents; ++i)
+    members.push_back (agent_name (i));
+  group.add_members (members);
+
+  auctions::AuctionMaximumBid auction ("auction.tree", name, &kb);
+  auction.add_group (&group);
+  auction.set_tree (fanout);
+  auction.bid (knowledge::KnowledgeRecord (bid_amount (id)));
+
+  elections::ElectionPlurality election ("election.tree", name, &kb);
+  election.set_tree (&group, fanout);
+  election.vote (vote_candidate (id));
+
+  // republish partial results, since multicast may drop them
+  knowledge::VariableReference auction_partial =
+    kb.get_ref (auction.get_tree_prefix () + "." + name);
+  knowledge::VariableReference election_partial =
+    kb.get_ref (election.get_tree_prefix () + "." + name);
+
+  bool agreed = false;
+  size_t remaining = 50;
+
+  for (size_t i = 0; i < 600 && remaining > 0; ++i)
+  {
+    elections::CandidateList leaders = election.get_leaders (1);
+
+    agreed = auction.get_leader () == auction_leader &&
+      auction.get_participation () == 1.0 &&
+      leaders.size () == 1 && leaders[0] == election_leader;
+
+    if (agreed)
+      --remaining;
+
+    if (i % 10 == 0)
+    {
+      kb.mark_modified (auction_partial);
+      kb.mark_modified (election_partial);
+    }
+
+    kb.send_modifieds ();
+    madara::utility::sleep (0.1);
+  }
+
+  return agreed ? 0 : 1;
+}
+
+#endif
+
+void test_tree_traffic (void)
+{
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "Testing records received per agent with and without the tree\n");
+
+  const std::string leader = expected_auction_leader ();
+
+  std::vector<size_t> flat_messages, flat_bytes;
+  std::vector<size_t> tree_messages, tree_bytes;
+
+  size_t flat_agreed = run_traffic (false, leader, flat_messages, flat_bytes);
+  size_t tree_agreed = run_traffic (true, leader, tree_messages, tree_bytes);
+
+  size_t flat_max = 0, tree_max = 0;
+  size_t flat_total = 0, tree_total = 0;
+
+  for (size_t i = 0; i < num_agents; ++i)
+  {
+    flat_max = std::max (flat_max, flat_messages[i]);
+    tree_max = std::max (tree_max, tree_messages[i]);
+    flat_total += flat_bytes[i];
+    tree_total += tree_bytes[i];
+  }
+
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "  Flat: %d agreed, at most %d records, %d bytes per agent\n",
+    (int)flat_agreed, (int)flat_max, (int)(flat_total / num_agents));
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "  Tree: %d agreed, at most %d records, %d bytes per agent\n",
+    (int)tree_agreed, (int)tree_max, (int)(tree_total / num_agents));
+
+  if (flat_agreed == num_agents && tree_agreed == num_agents)
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  All agents agreed on %s: SUCCESS\n", leader.c_str ());
+  }
+  else
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Not all agents agreed on %s: FAIL\n", leader.c_str ());
+    ++gams_fails;
+  }
+
+  // every flat agent needs every other bid
+  if (flat_max == num_agents - 1)
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Flat agents received %d records: SUCCESS\n", (int)flat_max);
+  }
+  else
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Flat agents received %d records, expected %d: FAIL\n",
+      (int)flat_max, (int)(num_agents - 1));
+    ++gams_fails;
+  }
+
+  // a tree agent needs its children and the root, once per change
+  if (tree_max * 4 <= flat_max && tree_total * 4 <= flat_total)
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Tree agents received under a quarter of flat: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Tree agents received over a quarter of flat: FAIL\n");
+    ++gams_fails;
+  }
+}
+
+void test_tree_publish (void)
+{
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "Testing bids and votes publish tree partials without polling\n");
+
+  groups::GroupFixedList group;
+  groups::AgentVector members;
+  for (size_t i = 0; i < 10; ++i)
+    members.push_back (agent_name (i));
+  group.add_members (members);
+
+  knowledge::KnowledgeBase kb;
+  const std::string name = agent_name (3);
+
+  auctions::AuctionMaximumBid auction ("auction.publish", name, &kb);
+  auction.add_group (&group);
+  auction.set_tree (fanout);
+  auction.bid (knowledge::KnowledgeRecord (5.0));
+
+  const std::string auction_partial =
+    kb.get (auction.get_tree_prefix () + "." + name).to_string ();
+
+  // a bid for another agent would not be counted in this agent's subtree
+  auction.bid (agent_name (4), knowledge::KnowledgeRecord (9.0));
+
+  elections::ElectionPlurality election ("election.publish", name, &kb);
+  election.set_tree (&group, fanout);
+  election.vote (agent_name (1));
+
+  const std::string election_partial =
+    kb.get (election.get_tree_prefix () + "." + name).to_string ();
+
+  election.vote (agent_name (4), agent_name (2));
+
+  if (auction_partial.find (name) != std::string::npos &&
+    election_partial.find (agent_name (1)) != std::string::npos)
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Partials published by bid and vote: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Partials published by bid and vote: FAIL\n");
+    ++gams_fails;
+  }
+
+  if (!auction.get_bid (agent_name (4)).is_valid () &&
+    kb.get (auction.get_tree_prefix () + "." + name).to_string () ==
+      auction_partial &&
+    !election.has_voted (agent_name (4)) &&
+    kb.get (election.get_tree_prefix () + "." + name).to_string () ==
+      election_partial)
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Bids and votes for other agents rejected: SUCCESS\n");
+  }
+  else
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Bids and votes for other agents rejected: FAIL\n");
+    ++gams_fails;
+  }
+}
+
+void test_tree_agreement (void)
+{
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "Testing tree aggregation with %d agent processes\n", (int)num_agents);
+
+#ifndef _WIN32
+  const std::string auction_leader = expected_auction_leader ();
+  std::map<std::string, size_t> votes;
+
+  for (size_t i = 0; i < num_agents; ++i)
+    ++votes[vote_candidate (i)];
+
+  std::string election_leader;
+  for (std::map<std::string, size_t>::iterator i = votes.begin ();
+    i != votes.end (); ++i)
+  {
+    if (election_leader == "" || i->second > votes[election_leader])
+      election_leader = i->first;
+  }
+
+  std::vector<pid_t> children;
+
+  for (size_t i = 0; i < num_agents; ++i)
+  {
+    pid_t child = fork ();
+
+    if (child == 0)
+    {
+      _exit (run_agent (i, auction_leader, election_leader));
+    }
+    else if (child > 0)
+    {
+      children.push_back (child);
+    }
+  }
+
+  size_t disagreed = num_agents - children.size ();
+
+  for (size_t i = 0; i < children.size (); ++i)
+  {
+    int status = 0;
+
+    if (waitpid (children[i], &status, 0) != children[i] ||
+      !WIFEXITED (status) || WEXITSTATUS (status) != 0)
+    {
+      ++disagreed;
+    }
+  }
+
+  if (disagreed == 0)
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Leaders %s and %s agreed by all agents: SUCCESS\n",
+      auction_leader.c_str (), election_leader.c_str ());
+  }
+  else
+  {
+    loggers::global_logger->log (loggers::LOG_ALWAYS,
+      "  Leaders %s and %s, %d agents disagreed: FAIL\n",
+      auction_leader.c_str (), election_leader.c_str (), (int)disagreed);
+    ++gams_fails;
+  }
+#else
+  loggers::global_logger->log (loggers::LOG_ALWAYS,
+    "  Agent processes are not supported on this platform: SKIPPED\n");
+#endif
+}
+
+int
+main (int, char **)
+{
+  test_tree_traffic ();
+  test_tree_publish ();
+  test_tree_agreement ();
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
@@ -57,17 +57,35 @@
 #include <assert.h>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <queue>
+#include <functional>
+#include <thread>
+#include <sstream>
+#include <cstdlib>
 
 #include "gams/utility/Position.h"
 #include "gams/utility/GPSPosition.h"
+#include "gams/utility/SlotAssignment.h"
+#include "gams/utility/GridPlanner.h"
+#include "gams/utility/PheromoneField.h"
+#include "gams/utility/Perimeter.h"
+#include "gams/utility/AreaPartition.h"
+#include "gams/utility/EventBarrier.h"
+#include "gams/pose/ReferenceFrame.h"
+#include "gams/pose/GPSFrame.h"
 #include "gams/pose/Region.h"
 #include "gams/pose/PrioritizedRegion.h"
 #include "gams/pose/SearchArea.h"
 
 #include "gams/loggers/GlobalLogger.h"
+#include "madara/knowledge/containers/Barrier.h"
 
 using gams::utility::GPSPosition;
 using gams::utility::Position;
+using gams::utility::SlotAssignment;
 using gams::pose::PrioritizedRegion;
 using gams::pose::Region;
 using gams::pose::SearchArea;
@@ -220,6 +238,771 @@ test_GPSPosition ()
   assert (phi == M_PI);
 }
 
+// checks that every agent has its own slot and as many as can be are filled
+bool
+is_complete (const SlotAssignment & assignment)
+{
+  vector<int> filled (assignment.slots (), 0);
+  size_t assigned = 0;
+
+  for (size_t i = 0; i < assignment.agents (); ++i)
+  {
+    int slot = assignment.get_slot (i);
+    if (slot >= 0)
+    {
+      if (filled[slot]++ > 0 || assignment.get_agent (slot) != (int)i)
+        return false;
+      ++assigned;
+    }
+  }
+
+  return assigned == std::min (assignment.agents (), assignment.slots ());
+}
+
+// least total (or, for makespan, largest then total) cost by enumeration
+double
+brute_force (const SlotAssignment::Costs & costs, size_t slots,
+  bool makespan)
+{
+  vector<int> order (std::max (costs.size (), slots));
+  for (size_t i = 0; i < order.size (); ++i)
+    order[i] = (int)i;
+
+  double best = DBL_MAX;
+  do
+  {
+    double total = 0, largest = 0;
+    for (size_t i = 0; i < costs.size (); ++i)
+    {
+      if ((size_t)order[i] < slots)
+      {
+        total += costs[i][order[i]];
+        largest = std::max (largest, costs[i][order[i]]);
+      }
+    }
+    best = std::min (best, makespan ? largest * 1e6 + total : total);
+  } while (std::next_permutation (order.begin (), order.end ()));
+
+  return best;
+}
+
+void
+test_SlotAssignment ()
+{
+  testing_output ("gams::utility::SlotAssignment");
+
+  std::mt19937 generator (7);
+  std::uniform_int_distribution<int> cost (0, 99);
+
+  // small problems, agents and slots differing in number
+  testing_output ("optimal against enumeration", 1);
+  for (int trial = 0; trial < 500; ++trial)
+  {
+    SlotAssignment::Costs costs (1 + trial % 6,
+      vector<double> (1 + (trial / 6) % 6));
+    for (size_t i = 0; i < costs.size (); ++i)
+      for (size_t j = 0; j < costs[i].size (); ++j)
+        costs[i][j] = cost (generator);
+
+    SlotAssignment total;
+    total.set_costs (costs);
+    total.solve ();
+    assert (is_complete (total));
+    assert (total.get_total () ==
+      brute_force (costs, costs[0].size (), false));
+
+    SlotAssignment makespan (SlotAssignment::MAKESPAN);
+    makespan.set_costs (costs);
+    makespan.solve ();
+    assert (is_complete (makespan));
+    assert (makespan.get_makespan () * 1e6 + makespan.get_total () ==
+      brute_force (costs, costs[0].size (), true));
+  }
+
+  // agents and slots joining and leaving between solves
+  testing_output ("incremental changes", 1);
+  SlotAssignment::Costs costs (3, vector<double> (3));
+  SlotAssignment incremental;
+  incremental.set_costs (costs);
+  for (int change = 0; change < 2000; ++change)
+  {
+    size_t slots = costs[0].size ();
+    int kind = change % 4;
+
+    if (kind == 0 && costs.size () < 6)
+    {
+      vector<double> row (slots);
+      for (size_t j = 0; j < slots; ++j)
+        row[j] = cost (generator);
+
+      size_t agent = generator () % (costs.size () + 1);
+      if (agent == costs.size ())
+        costs.push_back (row);
+      else
+        costs[agent] = row;
+      incremental.set_agent (agent, row);
+    }
+    else if (kind == 1 && costs.size () > 1)
+    {
+      size_t agent = generator () % costs.size ();
+      costs.erase (costs.begin () + agent);
+      incremental.remove_agent (agent);
+    }
+    else if (kind == 2 && slots < 6)
+    {
+      vector<double> column (costs.size ());
+      for (size_t i = 0; i < costs.size (); ++i)
+        column[i] = cost (generator);
+
+      size_t slot = generator () % (slots + 1);
+      for (size_t i = 0; i < costs.size (); ++i)
+      {
+        if (slot == slots)
+          costs[i].push_back (column[i]);
+        else
+          costs[i][slot] = column[i];
+      }
+      incremental.set_slot (slot, column);
+    }
+    else if (kind == 3 && slots > 1)
+    {
+      size_t slot = generator () % slots;
+      for (size_t i = 0; i < costs.size (); ++i)
+        costs[i].erase (costs[i].begin () + slot);
+      incremental.remove_slot (slot);
+    }
+
+    incremental.solve ();
+    assert (incremental.agents () == costs.size ());
+    assert (incremental.slots () == costs[0].size ());
+    assert (is_complete (incremental));
+    assert (incremental.get_total () ==
+      brute_force (costs, costs[0].size (), false));
+  }
+
+  // agents scattered over a square km, moving into a line of slots
+  testing_output ("performance", 1);
+  gams::pose::ReferenceFrame frame (gams::pose::default_frame ());
+  std::uniform_real_distribution<double> coordinate (0, 1000);
+
+  size_t sizes[] = {10, 50, 100, 250, 500};
+  for (size_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); ++s)
+  {
+    size_t num = sizes[s];
+    vector<gams::pose::Position> agents, slots;
+    for (size_t i = 0; i < num; ++i)
+    {
+      agents.push_back (gams::pose::Position (frame,
+        coordinate (generator), coordinate (generator)));
+      slots.push_back (gams::pose::Position (frame, 500.0 + i * 2.0, 500.0));
+    }
+
+    double by_index = 0;
+    for (size_t i = 0; i < num; ++i)
+      by_index += agents[i].distance_to (slots[i]);
+
+    SlotAssignment assignment;
+
+    auto start = std::chrono::steady_clock::now ();
+    assignment.solve (agents, slots);
+    auto solved = std::chrono::steady_clock::now ();
+    assert (is_complete (assignment));
+    double optimal = assignment.get_total ();
+    assert (optimal <= by_index);
+
+    // one agent leaves and another joins
+    vector<double> joined (num);
+    for (size_t j = 0; j < num; ++j)
+      joined[j] = agents[0].distance_to (slots[j]);
+    assignment.remove_agent (num / 2);
+    assignment.set_agent (num - 1, joined);
+    assignment.solve ();
+    auto repaired = std::chrono::steady_clock::now ();
+    assert (is_complete (assignment));
+
+    // everyone moves a little, and the last prices are reused
+    for (size_t i = 0; i < num; ++i)
+      agents[i].x (agents[i].x () + 1.0);
+    auto moved = std::chrono::steady_clock::now ();
+    assignment.solve (agents, slots);
+    auto resolved = std::chrono::steady_clock::now ();
+    assert (is_complete (assignment));
+
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    cout << "\t\t" << num << " agents: solve " <<
+      duration_cast<microseconds> (solved - start).count () <<
+      " us, join/leave " <<
+      duration_cast<microseconds> (repaired - solved).count () <<
+      " us, re-solve " <<
+      duration_cast<microseconds> (resolved - moved).count () <<
+      " us. Travel " << (int)optimal << " m vs " <<
+      (int)by_index << " m by index" << endl;
+  }
+}
+
+/**
+ * Finds the shortest path length with Dijkstra's algorithm, moving as
+ * GridPlanner does: 8 ways, without cutting blocked corners
+ **/
+double
+grid_distance (const gams::utility::GridPlanner & grid,
+  size_t start_col, size_t start_row, size_t goal_col, size_t goal_row)
+{
+  typedef std::pair<double, size_t> Entry;
+  long cols = (long)grid.cols (), rows = (long)grid.rows ();
+
+  vector<double> distances (cols * rows, INFINITY);
+  std::priority_queue<Entry, vector<Entry>, std::greater<Entry> > queue;
+
+  if (grid.is_blocked (goal_col, goal_row))
+    return INFINITY;
+
+  distances[goal_row * cols + goal_col] = 0;
+  queue.push (Entry (0, goal_row * cols + goal_col));
+
+  while (!queue.empty ())
+  {
+    Entry top = queue.top ();
+    queue.pop ();
+
+    if (top.first > distances[top.second])
+      continue;
+
+    long col = (long)top.second % cols, row = (long)top.second / cols;
+    for (long dy = -1; dy <= 1; ++dy)
+    {
+      for (long dx = -1; dx <= 1; ++dx)
+      {
+        long next_col = col + dx, next_row = row + dy;
+        if ((dx == 0 && dy == 0) || next_col < 0 || next_row < 0 ||
+          next_col >= cols || next_row >= rows ||
+          grid.is_blocked (next_col, next_row))
+          continue;
+
+        double step = 1;
+        if (dx != 0 && dy != 0)
+        {
+          if (grid.is_blocked (col + dx, row) ||
+            grid.is_blocked (col, row + dy))
+            continue;
+          step = std::sqrt (2.0);
+        }
+
+        size_t next = next_row * cols + next_col;
+        if (top.first + step < distances[next] - 1e-12)
+        {
+          distances[next] = top.first + step;
+          queue.push (Entry (distances[next], next));
+        }
+      }
+    }
+  }
+
+  return distances[start_row * cols + start_col];
+}
+
+/**
+ * Checks that a path moves from cell to adjacent open cell, without
+ * cutting blocked corners, and that its length is the expected cost
+ **/
+bool
+is_grid_path (const gams::utility::GridPlanner & grid,
+  const gams::utility::GridPlanner::Cells & path,
+  size_t start_col, size_t start_row, size_t goal_col, size_t goal_row,
+  double cost)
+{
+  if (path.empty () ||
+    path.front ().col != start_col || path.front ().row != start_row ||
+    path.back ().col != goal_col || path.back ().row != goal_row)
+    return false;
+
+  double length = 0;
+  for (size_t i = 1; i < path.size (); ++i)
+  {
+    long dx = (long)path[i].col - (long)path[i - 1].col;
+    long dy = (long)path[i].row - (long)path[i - 1].row;
+
+    if (std::labs (dx) > 1 || std::labs (dy) > 1 || (dx == 0 && dy == 0) ||
+      grid.is_blocked (path[i].col, path[i].row))
+      return false;
+
+    if (dx != 0 && dy != 0)
+    {
+      if (grid.is_blocked (path[i - 1].col + dx, path[i - 1].row) ||
+        grid.is_blocked (path[i - 1].col, path[i - 1].row + dy))
+        return false;
+      length += std::sqrt (2.0);
+    }
+    else
+    {
+      length += 1;
+    }
+  }
+
+  return std::fabs (length - cost) < 1e-6;
+}
+
+void
+test_GridPlanner (size_t size)
+{
+  using gams::utility::GridPlanner;
+
+  testing_output ("gams::utility::GridPlanner");
+
+  std::mt19937 generator (3);
+
+  // the agent moves along its path, or jumps, while cells are blocked and
+  // freed, and every repair must match a search from scratch
+  testing_output ("repairs match a full search", 1);
+  for (int trial = 0; trial < 500; ++trial)
+  {
+    size_t cols = 3 + generator () % 30, rows = 3 + generator () % 30;
+    GridPlanner grid (cols, rows);
+    size_t walls = cols * rows * (generator () % 50) / 100;
+    for (size_t i = 0; i < walls; ++i)
+      grid.set_blocked (generator () % cols, generator () % rows, true);
+
+    size_t goal_col = generator () % cols, goal_row = generator () % rows;
+    grid.set_blocked (goal_col, goal_row, false);
+    grid.set_goal (goal_col, goal_row);
+
+    size_t col = generator () % cols, row = generator () % rows;
+    for (int step = 0; step < 40; ++step)
+    {
+      bool reachable = grid.plan (col, row);
+      double expected = grid_distance (grid, col, row, goal_col, goal_row);
+
+      assert (reachable == !std::isinf (expected));
+      if (reachable)
+      {
+        assert (std::fabs (grid.get_cost () - expected) < 1e-9);
+
+        GridPlanner::Cells path = grid.get_path ();
+        assert (is_grid_path (grid, path, col, row, goal_col, goal_row,
+          expected));
+
+        GridPlanner::Cells waypoints = grid.get_waypoints ();
+        for (size_t i = 1; i < waypoints.size (); ++i)
+          assert (grid.line_of_sight (waypoints[i - 1], waypoints[i]));
+
+        if (path.size () > 1 && generator () % 2)
+        {
+          col = path[1].col;
+          row = path[1].row;
+        }
+      }
+      else
+      {
+        assert (grid.get_path ().empty ());
+      }
+
+      for (int toggle = 0; toggle < 10; ++toggle)
+      {
+        size_t c = generator () % cols, r = generator () % rows;
+        if (c != goal_col || r != goal_row)
+          grid.set_blocked (c, r, !grid.is_blocked (c, r));
+      }
+
+      if (generator () % 10 == 0)
+      {
+        col = generator () % cols;
+        row = generator () % rows;
+      }
+    }
+  }
+
+  testing_output ("rasterize", 1);
+  GridPlanner small (100, 100);
+  vector<GridPlanner::Point> triangle = {{{10, 10}}, {{90, 20}}, {{40, 80}}};
+  size_t covered = small.rasterize (triangle).size ();
+  assert (covered > 2600 && covered < 2800);
+
+  // an agent crossing a grid of walls finds its path blocked
+  testing_output ("benchmark", 1);
+  GridPlanner grid (size, size);
+  std::uniform_int_distribution<size_t> coordinate (0, size - 1);
+  for (size_t wall = 0; wall < size * 3 / 10; ++wall)
+  {
+    size_t col = coordinate (generator), row = coordinate (generator);
+    bool horizontal = generator () % 2 == 0;
+    for (size_t k = 0; k < size * 6 / 100; ++k)
+    {
+      if (horizontal)
+        grid.set_blocked (std::min (size - 1, col + k), row, true);
+      else
+        grid.set_blocked (col, std::min (size - 1, row + k), true);
+    }
+  }
+  grid.set_blocked (0, 0, false);
+  grid.set_blocked (size - 1, size - 1, false);
+  grid.set_goal (size - 1, size - 1);
+
+  auto start = std::chrono::steady_clock::now ();
+  assert (grid.plan (0, 0));
+  auto planned = std::chrono::steady_clock::now ();
+  size_t initial_expanded = grid.get_expanded ();
+
+  double repair_time = 0;
+  size_t repairs = 0;
+  GridPlanner::Cell current = {0, 0};
+  for (; repairs < 20; ++repairs)
+  {
+    GridPlanner::Cells path = grid.get_path ();
+    if (path.size () < 80)
+      break;
+
+    current = path[40];
+    for (size_t k = 60; k < 70; ++k)
+      grid.set_blocked (path[k].col, path[k].row, true);
+
+    auto before = std::chrono::steady_clock::now ();
+    bool reachable = grid.plan (current.col, current.row);
+    auto after = std::chrono::steady_clock::now ();
+    repair_time += std::chrono::duration<double, std::milli> (
+      after - before).count ();
+
+    if (!reachable)
+      break;
+  }
+
+  // the same cells, searched from scratch
+  GridPlanner full (size, size);
+  for (size_t row = 0; row < size; ++row)
+    for (size_t col = 0; col < size; ++col)
+      full.set_blocked (col, row, grid.is_blocked (col, row));
+  full.set_goal (size - 1, size - 1);
+
+  auto before = std::chrono::steady_clock::now ();
+  full.plan (current.col, current.row);
+  auto after = std::chrono::steady_clock::now ();
+  assert (std::fabs (full.get_cost () - grid.get_cost ()) < 1e-6);
+
+  using std::chrono::duration;
+  using std::milli;
+
+  cout << "\t\t" << size << "x" << size << ": plan " <<
+    duration<double, milli> (planned - start).count () << " ms (" <<
+    initial_expanded << " cells), repair " <<
+    (repairs ? repair_time / repairs : 0) << " ms, full search " <<
+    duration<double, milli> (after - before).count () << " ms" << endl;
+}
+
+void
+test_PheromoneField ()
+{
+  using gams::utility::PheromoneField;
+
+  testing_output ("gams::utility::PheromoneField");
+
+  // diffusion moves pheromone between cells without losing any
+  testing_output ("diffusion", 1);
+  PheromoneField field (20, 10);
+  field.set_diffusion (0.5);
+  field.deposit (0, 0, 100);
+  field.deposit (10, 5, 100);
+  field.step (50);
+  assert (std::fabs (field.get_total () - 200) < 1e-9);
+  assert (field.get (1, 0) > 0 && field.get (0, 0) < 100);
+
+  // a wall of invalid cells stops diffusion
+  testing_output ("invalid cells", 1);
+  PheromoneField walled (10, 10);
+  walled.set_diffusion (1.0);
+  for (size_t row = 0; row < 10; ++row)
+    walled.set_valid (5, row, false);
+  walled.deposit (5, 5, 100);
+  assert (walled.get (5, 5) == 0);
+  walled.deposit (2, 5, 100);
+  walled.step (100);
+  assert (std::fabs (walled.get_total () - 100) < 1e-9);
+  for (size_t row = 0; row < 10; ++row)
+    for (size_t col = 5; col < 10; ++col)
+      assert (walled.get (col, row) == 0);
+
+  // evaporation removes a fixed fraction each step
+  testing_output ("evaporation", 1);
+  field.set_evaporation (0.1);
+  field.step (10);
+  assert (std::fabs (field.get_total () - 200 * std::pow (0.9, 10)) < 1e-9);
+
+  testing_output ("benchmark", 1);
+  const size_t size = 1000;
+  PheromoneField large (size, size);
+  large.set_evaporation (0.01);
+  large.set_diffusion (0.1);
+  large.deposit (size / 2, size / 2, 1000);
+
+  auto start = std::chrono::steady_clock::now ();
+  large.step (10);
+  auto end = std::chrono::steady_clock::now ();
+
+  cout << "\t\t" << size << "x" << size << ": " <<
+    std::chrono::duration<double, std::milli> (end - start).count () / 10 <<
+    " ms per step" << endl;
+}
+
+void
+test_Perimeter ()
+{
+  using gams::utility::Perimeter;
+  using gams::pose::Position;
+  using gams::pose::ReferenceFrame;
+
+  testing_output ("gams::utility::Perimeter");
+
+  // a 100m x 50m rectangle in a cartesian frame, so lengths are exact
+  const ReferenceFrame & frame = gams::pose::default_frame ();
+  std::vector<Position> vertices;
+  vertices.push_back (Position (frame, 0, 0));
+  vertices.push_back (Position (frame, 100, 0));
+  vertices.push_back (Position (frame, 100, 50));
+  vertices.push_back (Position (frame, 0, 50));
+  Perimeter perimeter (vertices);
+
+  testing_output ("length", 1);
+  const double length = perimeter.get_length ();
+  assert (perimeter.size () == 4);
+  assert (std::fabs (length - 300) < 1e-9);
+  assert (std::fabs (perimeter.get_distance (1) - 100) < 1e-9);
+  assert (std::fabs (perimeter.get_distance (2) - 150) < 1e-9);
+  assert (std::fabs (perimeter.get_distance (3) - 250) < 1e-9);
+
+  testing_output ("position_at", 1);
+  for (size_t i = 0; i < vertices.size (); ++i)
+    assert (perimeter.position_at (
+      perimeter.get_distance (i)).distance_to (vertices[i]) < 1e-9);
+  assert (perimeter.position_at (-length).distance_to (vertices[0]) < 1e-9);
+  assert (perimeter.position_at (125).distance_to (
+    Position (frame, 100, 25)) < 1e-9);
+  assert (perimeter.position_at (-10).distance_to (
+    Position (frame, 0, 10)) < 1e-9);
+  assert (perimeter.edge_at (perimeter.get_distance (2) + 1) == 2);
+  assert (perimeter.edge_at (-1) == 3);
+
+  testing_output ("project", 1);
+  for (double distance = 0; distance < length; distance += length / 37)
+    assert (std::fabs (perimeter.project (
+      perimeter.position_at (distance)) - distance) < 1e-9);
+  assert (std::fabs (perimeter.project (Position (frame, 40, -10)) - 40) <
+    1e-9);
+  assert (std::fabs (perimeter.project (Position (frame, 110, 30)) - 130) <
+    1e-9);
+
+  testing_output ("spaced", 1);
+  std::vector<double> spaced = perimeter.spaced (5, length - 1);
+  assert (spaced.size () == 5);
+  assert (std::fabs (spaced[0] - (length - 1)) < 1e-9);
+  assert (std::fabs (spaced[1] - (length / 5 - 1)) < 1e-9);
+  assert (std::fabs (spaced[4] - (length * 4 / 5 - 1)) < 1e-9);
+
+  // gps vertices are measured in a local frame at the first vertex
+  testing_output ("gps", 1);
+  std::vector<Position> gps;
+  gps.push_back (Position (gams::pose::gps_frame (), -80.0, 40.0));
+  gps.push_back (Position (gams::pose::gps_frame (), -79.999, 40.0));
+  gps.push_back (Position (gams::pose::gps_frame (), -79.999, 40.001));
+  gps.push_back (Position (gams::pose::gps_frame (), -80.0, 40.001));
+  Perimeter gps_perimeter (gps);
+
+  ReferenceFrame local (gps[0]);
+  std::vector<Position> corners;
+  double gps_length = 0;
+  for (size_t i = 0; i < gps.size (); ++i)
+    corners.push_back (gps[i].transform_to (local));
+  for (size_t i = 0; i < corners.size (); ++i)
+    gps_length += corners[i].distance_to (corners[(i + 1) % corners.size ()]);
+
+  // 0.001 degrees is about 111m of latitude and 85m of longitude here
+  assert (std::fabs (gps_perimeter.get_length () - gps_length) < 1e-6);
+  assert (std::fabs (gps_length - 392.7) < 0.01 * 392.7);
+
+  for (size_t i = 0; i < gps.size (); ++i)
+  {
+    Position at = gps_perimeter.position_at (
+      gps_perimeter.get_distance (i));
+    assert (at.frame () == gps[0].frame ());
+    assert (at.transform_to (local).distance_to (corners[i]) < 1e-6);
+    assert (std::fabs (gps_perimeter.project (gps[i]) -
+      gps_perimeter.get_distance (i)) < 1e-6);
+  }
+}
+
+void
+test_AreaPartition ()
+{
+  using gams::utility::AreaPartition;
+  using gams::pose::Position;
+  using gams::pose::PrioritizedRegion;
+
+  testing_output ("gams::utility::AreaPartition");
+
+  // two side by side squares, the eastern one twice the priority
+  const gams::pose::ReferenceFrame & gps = gams::pose::gps_frame ();
+  std::vector<Position> west, east;
+  west.push_back (Position (gps, -80.0, 40.0));
+  west.push_back (Position (gps, -79.999, 40.0));
+  west.push_back (Position (gps, -79.999, 40.001));
+  west.push_back (Position (gps, -80.0, 40.001));
+  east.push_back (Position (gps, -79.999, 40.0));
+  east.push_back (Position (gps, -79.998, 40.0));
+  east.push_back (Position (gps, -79.998, 40.001));
+  east.push_back (Position (gps, -79.999, 40.001));
+
+  gams::pose::SearchArea area;
+  area.add_prioritized_region (PrioritizedRegion (west, 1));
+  area.add_prioritized_region (PrioritizedRegion (east, 2));
+
+  testing_output ("weighted", 1);
+  AreaPartition partition;
+  partition.partition (area, 6, true, 4);
+  assert (partition.size () == 6);
+  double total = 0;
+  for (size_t i = 0; i < partition.size (); ++i)
+    total += partition.get_weight (i);
+  for (size_t i = 0; i < partition.size (); ++i)
+  {
+    assert (std::fabs (partition.get_weight (i) - total / 6) < 1e-3 * total);
+    assert (partition.get_cell (i).vertices.size () >= 3);
+  }
+
+  // with twice the weight, the east square gets two thirds of the cells
+  size_t west_cells = 0;
+  for (size_t i = 0; i < partition.size (); ++i)
+    if (partition.get_cell (i).max_lon_ < -79.999 + 1e-7)
+      ++west_cells;
+  assert (west_cells == 2);
+
+  testing_output ("single thread", 1);
+  AreaPartition serial;
+  serial.partition (area, 6, true, 1);
+  for (size_t i = 0; i < serial.size (); ++i)
+    assert (serial.get_cell (i) == partition.get_cell (i));
+
+  testing_output ("by area", 1);
+  AreaPartition even;
+  even.partition (area, 4, false);
+  assert (even.size () == 4);
+  for (size_t i = 0; i < even.size (); ++i)
+    assert (std::fabs (even.get_weight (i) - even.get_weight (0)) <
+      1e-3 * even.get_weight (0));
+
+  testing_output ("knowledge base", 1);
+  madara::knowledge::KnowledgeBase knowledge;
+  partition.to_container (knowledge, AreaPartition::get_prefix ("area", 6));
+  AreaPartition loaded;
+  assert (loaded.from_container (knowledge,
+    AreaPartition::get_prefix ("area", 6)));
+  assert (loaded.size () == 6);
+  assert (!loaded.from_container (knowledge,
+    AreaPartition::get_prefix ("area", 5)));
+}
+
+void
+test_EventBarrier ()
+{
+  using gams::utility::BarrierEvents;
+  using gams::utility::EventBarrier;
+  typedef madara::knowledge::KnowledgeRecord::Integer Integer;
+
+  testing_output ("gams::utility::EventBarrier");
+
+  const int participants = 100;
+  madara::knowledge::KnowledgeBase knowledge;
+  madara::knowledge::Variables vars;
+  madara::transport::TransportContext context;
+  BarrierEvents & events = BarrierEvents::instance ();
+
+  // round changes delivered by the receive filter count arrivals
+  testing_output ("arrivals", 1);
+  EventBarrier barrier;
+  barrier.set_name ("barrier.test", knowledge, 0, participants);
+  barrier.set (0);
+  barrier.next ();
+  assert (barrier.get_round () == 1 && barrier.get_arrived () == 1);
+  assert (!barrier.is_done ());
+
+  madara::knowledge::KnowledgeMap records;
+  for (int i = 1; i < participants; ++i)
+    records["barrier.test." + std::to_string (i)] =
+      madara::knowledge::KnowledgeRecord (Integer (1));
+  records["agent.1.location"] =
+    madara::knowledge::KnowledgeRecord (Integer (1));
+  events.filter (records, context, vars);
+  assert (barrier.is_done ());
+  assert (barrier.get_arrived () == (size_t)participants);
+
+  // a participant already ahead counts toward the next round
+  records.clear ();
+  records["barrier.test.7"] =
+    madara::knowledge::KnowledgeRecord (Integer (3));
+  events.filter (records, context, vars);
+  barrier.next ();
+  assert (barrier.get_arrived () == 2 && !barrier.is_done ());
+
+  // changes made directly to the knowledge base are read by update
+  testing_output ("update", 1);
+  for (int i = 1; i < participants; ++i)
+    knowledge.set ("barrier.test." + std::to_string (i), Integer (2));
+  assert (barrier.update () == (size_t)participants - 2);
+  assert (barrier.is_done () && barrier.update () == 0);
+
+  // a waiting controller wakes when the last participant arrives
+  testing_output ("wake", 1);
+  barrier.next ();
+  uint64_t generation = events.get_generation ();
+  auto start = std::chrono::steady_clock::now ();
+  std::thread transport ([&] {
+    std::this_thread::sleep_for (std::chrono::milliseconds (20));
+    madara::knowledge::KnowledgeMap arrivals;
+    madara::knowledge::Variables transport_vars;
+    madara::transport::TransportContext transport_context;
+    for (int i = 1; i < participants; ++i)
+      arrivals["barrier.test." + std::to_string (i)] =
+        madara::knowledge::KnowledgeRecord (Integer (3));
+    events.filter (arrivals, transport_context, transport_vars);
+  });
+  bool woken = events.wait_until (start + std::chrono::seconds (2),
+    generation);
+  auto end = std::chrono::steady_clock::now ();
+  transport.join ();
+  assert (woken && barrier.is_done ());
+  assert (end - start < std::chrono::seconds (1));
+  assert (barrier.get_latency () > 0);
+
+  // every waiting controller wakes, not only the first to wait
+  uint64_t first = events.get_generation (), second = first;
+  events.notify ();
+  auto now = std::chrono::steady_clock::now ();
+  assert (events.wait_until (now, first) && events.wait_until (now, second));
+  assert (!events.wait_until (now, first));
+
+  // the cost of a completion check, against the MADARA barrier
+  testing_output ("benchmark", 1);
+  madara::knowledge::containers::Barrier scanned;
+  scanned.set_name ("barrier.test", knowledge, 0, participants);
+
+  const int checks = 10000;
+  bool done = true;
+  auto scan_start = std::chrono::steady_clock::now ();
+  for (int i = 0; i < checks; ++i)
+    done = scanned.is_done () && done;
+  auto scan_end = std::chrono::steady_clock::now ();
+  for (int i = 0; i < checks; ++i)
+    done = barrier.is_done () && done;
+  auto count_end = std::chrono::steady_clock::now ();
+
+  using std::chrono::duration;
+  using std::nano;
+
+  cout << "\t\t" << participants << " participants: Barrier::is_done " <<
+    duration<double, nano> (scan_end - scan_start).count () / checks <<
+    " ns, EventBarrier::is_done " <<
+    duration<double, nano> (count_end - scan_end).count () / checks <<
+    " ns, round latency " << barrier.get_latency () * 1000 << " ms" << endl;
+}
+
 // TODO: fill out remaining Region function tests
 /*
 void
@@ -347,11 +1130,25 @@ test_SearchArea ()
 */
 
 int
-main (int /*argc*/, char ** /*argv*/)
+main (int argc, char ** argv)
 {
+  // the GridPlanner benchmark's grid is 200x200 unless a size is given
+  size_t grid_size = 200;
+  if (argc > 1)
+  {
+    std::stringstream buffer (argv[1]);
+    buffer >> grid_size;
+  }
+
   gams::loggers::global_logger->set_level (-1);
   test_Position ();
   test_GPSPosition ();
+  test_SlotAssignment ();
+  test_GridPlanner (grid_size);
+  test_PheromoneField ();
+  test_Perimeter ();
+  test_AreaPartition ();
+  test_EventBarrier ();
   //test_Region ();
   //test_SearchArea ();
   return 0;
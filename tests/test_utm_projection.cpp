@@ -0,0 +1,192 @@
+/**
+ * Tests the fixed-zone UTMProjection, which does not need GeographicLib,
+ * and compares converting points one at a time against the batch methods.
+ *
+ * Usage: test_utm_projection [points]
+ * The benchmark converts 10,000 points unless a count is given.
+ **/
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "gams/pose/UTMProjection.h"
+
+int gams_fails = 0;
+
+#define TEST_NEAR(expr, expect, tolerance) \
+  do {\
+    double v = (expr); \
+    double e = (expect); \
+    if(fabs(v - e) <= (tolerance)) \
+    { \
+      std::cout << #expr << " ?= " << e << "  SUCCESS! got " << v << std::endl; \
+    } \
+    else \
+    { \
+      std::cout << #expr << " ?= " << e << "  FAIL! got " << v << " instead" << std::endl; \
+      gams_fails++; \
+    } \
+  } while(0)
+
+using gams::pose::UTMProjection;
+
+void test_utm_projection (void)
+{
+  std::cout << "Testing UTMProjection:" << std::endl;
+
+  TEST_NEAR (UTMProjection::standard_zone (42, -79), 17, 0);
+  TEST_NEAR (UTMProjection::standard_zone (60, 5), 32, 0);
+  TEST_NEAR (UTMProjection::standard_zone (78, 15), 33, 0);
+  TEST_NEAR (UTMProjection::nato_band (42), 'T', 0);
+  TEST_NEAR (UTMProjection::nato_band (-33.9), 'H', 0);
+  TEST_NEAR (UTMProjection::nato_band (83), 'X', 0);
+
+  // on the central meridian at the equator
+  {
+    double easting, northing;
+    UTMProjection (31, true).forward (0, 3, easting, northing);
+    TEST_NEAR (easting, 500000, 1e-6);
+    TEST_NEAR (northing, 0, 1e-6);
+  }
+
+  // off the central meridian in the southern hemisphere, which exercises
+  // zone selection and the false northing: the Sydney Opera House,
+  // published as 56H 334873.199 6252266.092
+  {
+    UTMProjection utm (UTMProjection::for_point (-33.857, 151.215));
+    TEST_NEAR (utm.zone (), 56, 0);
+    TEST_NEAR (utm.north (), 0, 0);
+
+    double easting, northing, lat, lng;
+    utm.forward (-33.857, 151.215, easting, northing);
+    TEST_NEAR (easting, 334873.199, 1e-3);
+    TEST_NEAR (northing, 6252266.092, 1e-3);
+
+    utm.reverse (334873.199, 6252266.092, lat, lng);
+    TEST_NEAR (lat, -33.857, 1e-7);
+    TEST_NEAR (lng, 151.215, 1e-7);
+  }
+
+  // round trips through forward and reverse
+  {
+    const double points[][2] = {
+      {42, -79}, {-33.9, 18.4}, {0.5, -0.1}, {60, 5}, {83, 10}, {-79, 170}
+    };
+
+    for (const auto & point : points)
+    {
+      UTMProjection utm (UTMProjection::for_point (point[0], point[1]));
+      double easting, northing, lat, lng;
+      utm.forward (point[0], point[1], easting, northing);
+      utm.reverse (easting, northing, lat, lng);
+      TEST_NEAR (lat, point[0], 1e-9);
+      TEST_NEAR (lng, point[1], 1e-9);
+    }
+  }
+
+}
+
+/**
+ * Returns nanoseconds per point of a conversion
+ **/
+double ns_per_point (std::chrono::steady_clock::duration elapsed,
+  size_t count)
+{
+  return std::chrono::duration<double, std::nano> (elapsed).count () / count;
+}
+
+void test_batch (size_t count)
+{
+  std::cout << "Testing " << count << " points one at a time and in a batch:"
+    << std::endl;
+
+  std::vector<double> lats (count), lngs (count);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    lats[i] = 40 + i * (1.0 / count);
+    lngs[i] = -80 + i * (2.0 / count);
+  }
+
+  UTMProjection utm (UTMProjection::for_point (lats[0], lngs[0]));
+
+  std::vector<double> eastings (count), northings (count);
+  std::vector<double> batch_eastings (count), batch_northings (count);
+
+  typedef std::chrono::steady_clock Clock;
+
+  Clock::time_point start = Clock::now ();
+  for (size_t i = 0; i < count; ++i)
+    utm.forward (lats[i], lngs[i], eastings[i], northings[i]);
+  Clock::duration single_forward = Clock::now () - start;
+
+  start = Clock::now ();
+  utm.forward (count, lats.data (), lngs.data (),
+    batch_eastings.data (), batch_northings.data ());
+  Clock::duration batch_forward = Clock::now () - start;
+
+  std::vector<double> back_lats (count), back_lngs (count);
+  std::vector<double> batch_lats (count), batch_lngs (count);
+
+  start = Clock::now ();
+  for (size_t i = 0; i < count; ++i)
+    utm.reverse (eastings[i], northings[i], back_lats[i], back_lngs[i]);
+  Clock::duration single_reverse = Clock::now () - start;
+
+  start = Clock::now ();
+  utm.reverse (count, batch_eastings.data (), batch_northings.data (),
+    batch_lats.data (), batch_lngs.data ());
+  Clock::duration batch_reverse = Clock::now () - start;
+
+  // the batch methods give the same results as single points
+  double worst_forward = 0, worst_reverse = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    worst_forward = std::max (worst_forward,
+      std::max (fabs (eastings[i] - batch_eastings[i]),
+        fabs (northings[i] - batch_northings[i])));
+    worst_reverse = std::max (worst_reverse,
+      std::max (fabs (back_lats[i] - batch_lats[i]),
+        fabs (back_lngs[i] - batch_lngs[i])));
+  }
+
+  TEST_NEAR (worst_forward, 0, 1e-9);
+  TEST_NEAR (worst_reverse, 0, 1e-12);
+  TEST_NEAR (batch_lats[count - 1], lats[count - 1], 1e-9);
+  TEST_NEAR (batch_lngs[count - 1], lngs[count - 1], 1e-9);
+
+  std::cout << "  forward: " << ns_per_point (single_forward, count) <<
+    " ns/point single, " << ns_per_point (batch_forward, count) <<
+    " ns/point batch" << std::endl;
+  std::cout << "  reverse: " << ns_per_point (single_reverse, count) <<
+    " ns/point single, " << ns_per_point (batch_reverse, count) <<
+    " ns/point batch" << std::endl;
+}
+
+int main (int argc, char ** argv)
+{
+  size_t count = 10000;
+
+  if (argc > 1)
+  {
+    std::stringstream buffer (argv[1]);
+    buffer >> count;
+  }
+
+  test_utm_projection ();
+  test_batch (count > 0 ? count : 1);
+
+  if (gams_fails > 0)
+  {
+    std::cerr << "OVERALL: FAIL. " << gams_fails << " tests failed.\n";
+  }
+  else
+  {
+    std::cerr << "OVERALL: SUCCESS.\n";
+  }
+
+  return gams_fails;
+}
@@ -52,17 +52,36 @@
  * Tests the functionality of gams::variables classes
  **/
 
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "gams/pose/Position.h"
 #include "gams/platforms/BasePlatform.h"
 #include "gams/pose/GPSFrame.h"
+#include "gams/pose/Region.h"
+#include "gams/pose/SearchArea.h"
 #include "gams/variables/Agent.h"
+#include "gams/variables/NeighborIndex.h"
 #include "gams/variables/Sensor.h"
 #include "gams/variables/Swarm.h"
+#include "gams/variables/SwarmView.h"
+#include "gams/variables/Telemetry.h"
 
 #include "gams/variables/AccentStatus.h"
 
+#include "madara/filters/AggregateFilter.h"
+#include "madara/transport/QoSTransportSettings.h"
+
 namespace transport = madara::transport;
 namespace pose = gams::pose;
 namespace knowledge = madara::knowledge;
@@ -431,10 +450,845 @@ test_agent (void)
   }
 }
 
+/**
+ * Discretizes a region the way Sensor::discretize did before rasterize,
+ * by testing every cell in the sweep against the whole polygon
+ **/
+std::set <pose::Position>
+discretize_per_cell (variables::Sensor & sensor, const pose::Region & region)
+{
+  std::set <pose::Position> ret_val;
+
+  // find northern most point
+  pose::Position northern = region.vertices[0];
+  for (size_t i = 1; i < region.vertices.size (); ++i)
+    if (northern.latitude () < region.vertices[i].latitude ())
+      northern = region.vertices[i];
+  const int max_x = (int)sensor.get_index_from_gps (northern).x ();
+
+  // find southern most point
+  pose::Position southern = region.vertices[0];
+  for (size_t i = 1; i < region.vertices.size (); ++i)
+    if (southern.latitude () > region.vertices[i].latitude ())
+      southern = region.vertices[i];
+  const int min_x = (int)sensor.get_index_from_gps (southern).x ();
+
+  // find west most point
+  pose::Position start;
+  start.longitude (DBL_MAX);
+  for (size_t i = 0; i < region.vertices.size (); ++i)
+    if (start.longitude () > region.vertices[i].longitude ())
+      start = region.vertices[i];
+
+  // find valid corresponding position
+  pose::Position start_index = sensor.get_index_from_gps (start);
+  if (!region.contains (sensor.get_gps_from_index (start_index)))
+  {
+    start_index.y (start_index.y () + 1);
+    pose::Position check = start_index;
+    while (!region.contains (sensor.get_gps_from_index (check)) &&
+      check.x () <= max_x)
+    {
+      check.x (check.x () + 1);
+    }
+
+    if (!region.contains (sensor.get_gps_from_index (check)))
+    {
+      check = start_index;
+      while (!region.contains (sensor.get_gps_from_index (check)) &&
+        check.x () >= min_x)
+      {
+        check.x (check.x () - 1);
+      }
+    }
+
+    start_index = check;
+  }
+
+  // find east most point
+  pose::Position eastern = region.vertices[0];
+  for (size_t i = 1; i < region.vertices.size (); ++i)
+    if (eastern.longitude () < region.vertices[i].longitude ())
+      eastern = region.vertices[i];
+  const int max_y = (int)sensor.get_index_from_gps (eastern).y ();
+
+  // move east each iteration, checking north and south of the start row
+  while (start_index.y () < max_y)
+  {
+    for (pose::Position pos = start_index; pos.x () <= max_x;
+      pos.x (pos.x () + 1))
+      if (region.contains (sensor.get_gps_from_index (pos)))
+        ret_val.insert (pos);
+
+    for (pose::Position pos = start_index; pos.x () >= min_x;
+      pos.x (pos.x () - 1))
+      if (region.contains (sensor.get_gps_from_index (pos)))
+        ret_val.insert (pos);
+
+    start_index.y (start_index.y () + 1);
+  }
+
+  return ret_val;
+}
+
+/**
+ * Checks that a cell set equals the per-cell discretization
+ **/
+void
+check_cells (const std::string & label,
+  const std::set <pose::Position> & cells,
+  const std::set <pose::Position> & expected)
+{
+  std::cout << "  Testing " << label << " (" << expected.size () <<
+    " cells): ";
+  if (!expected.empty () && cells == expected)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL (" << cells.size () << " cells)\n";
+    ++gams_fails;
+  }
+}
+
+/**
+ * Builds a GPS region from latitude, longitude pairs
+ **/
+pose::Region
+make_region (const std::vector <std::pair <double, double>> & lat_lngs)
+{
+  std::vector <pose::Position> vertices;
+  for (const std::pair <double, double> & lat_lng : lat_lngs)
+  {
+    vertices.push_back (pose::Position (pose::gps_frame (),
+      lat_lng.second, lat_lng.first, 0.0));
+  }
+  return pose::Region (vertices);
+}
+
 void
 test_sensor (void)
 {
+  std::cout << "Testing Sensor...\n";
+
+  knowledge::KnowledgeBase context;
+
+  pose::Position origin (pose::gps_frame (), -79.9, 40.4, 0.0);
+  variables::Sensor sensor ("coverage", &context, 2.5, origin);
+
+  // concave L-shaped region, roughly 250m on a side, north east of origin
+  pose::Region region = make_region ({
+    {40.4005, -79.8995}, {40.4005, -79.8970}, {40.4015, -79.8970},
+    {40.4015, -79.8980}, {40.4030, -79.8980}, {40.4030, -79.8995}});
+
+  auto start = std::chrono::steady_clock::now ();
+  variables::Sensor::IndexRuns runs = sensor.rasterize (region);
+  auto end = std::chrono::steady_clock::now ();
+
+  std::set <pose::Position> expected = discretize_per_cell (sensor, region);
+
+  auto per_cell_start = std::chrono::steady_clock::now ();
+  discretize_per_cell (sensor, region);
+  auto per_cell_elapsed = std::chrono::steady_clock::now () - per_cell_start;
+
+  std::set <pose::Position> run_cells;
+  size_t run_count = 0;
+  for (const variables::Sensor::IndexRun & run : runs)
+  {
+    for (int y = run.y_begin; y < run.y_end; ++y)
+    {
+      pose::Position index (pose::gps_frame (), run.x, y, 0.0);
+      run_cells.insert (index);
+      ++run_count;
+    }
+  }
+
+  std::cout << "  Rasterized " << run_count << " cells in " << runs.size () <<
+    " runs in " << std::chrono::duration_cast<std::chrono::microseconds> (
+      end - start).count () << " us, per cell in " <<
+    std::chrono::duration_cast<std::chrono::microseconds> (
+      per_cell_elapsed).count () << " us\n";
+
+  std::cout << "  Testing Sensor.rasterize runs do not overlap: ";
+  if (run_count == run_cells.size ())
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  check_cells ("Sensor.rasterize on an L", run_cells, expected);
+  check_cells ("Sensor.discretize on an L",
+    sensor.discretize (region), expected);
+
+  // the regions of test_utility's Region and SearchArea tests
+  pose::Region quad = make_region ({
+    {40.443273, -79.939951}, {40.443116, -79.939973},
+    {40.443085, -79.940313}, {40.443285, -79.940242}});
+  check_cells ("Sensor.discretize on a quadrilateral",
+    sensor.discretize (quad), discretize_per_cell (sensor, quad));
+
+  pose::PrioritizedRegion hull (make_region ({
+    {40.443237, -79.94057}, {40.443387, -79.94027},
+    {40.443187, -79.940098}, {40.443077, -79.940398}}), 1);
+  pose::PrioritizedRegion triangle (make_region ({
+    {40.443237, -79.94047}, {40.443377, -79.94027},
+    {40.443337, -79.940298}}), 5);
+
+  pose::SearchArea search (hull);
+  search.add_prioritized_region (triangle);
+
+  std::set <pose::Position> search_cells = discretize_per_cell (sensor, hull);
+  std::set <pose::Position> triangle_cells =
+    discretize_per_cell (sensor, triangle);
+  search_cells.insert (triangle_cells.begin (), triangle_cells.end ());
+  check_cells ("Sensor.discretize on a search area",
+    sensor.discretize (search), search_cells);
+
+  // and test_utility's AreaPartition squares, which share an edge
+  pose::SearchArea squares;
+  squares.add_prioritized_region (pose::PrioritizedRegion (make_region ({
+    {40.0, -80.0}, {40.0, -79.999}, {40.001, -79.999}, {40.001, -80.0}}), 1));
+  squares.add_prioritized_region (pose::PrioritizedRegion (make_region ({
+    {40.0, -79.999}, {40.0, -79.998}, {40.001, -79.998}, {40.001, -79.999}}),
+    2));
+
+  std::set <pose::Position> square_cells;
+  for (const pose::PrioritizedRegion & square : squares.get_regions ())
+  {
+    std::set <pose::Position> cells = discretize_per_cell (sensor, square);
+    square_cells.insert (cells.begin (), cells.end ());
+  }
+  check_cells ("Sensor.discretize on adjacent squares",
+    sensor.discretize (squares), square_cells);
+}
+
+/**
+ * Counts the messages a knowledge base receives and their size on the
+ * wire, dropping the records
+ **/
+class MessageCounter : public madara::filters::AggregateFilter
+{
+public:
+  MessageCounter () : messages (0), bytes (0) {}
+
+  virtual void filter (knowledge::KnowledgeMap & records,
+    const transport::TransportContext & transport_context,
+    knowledge::Variables &)
+  {
+    bytes += (size_t)transport_context.get_message_size ();
+    ++messages;
+    records.clear ();
+  }
+
+  /**
+   * Waits up to a second for a number of messages to arrive
+   * @return true if they arrived
+   **/
+  bool wait_for (size_t expected) const
+  {
+    for (int i = 0; i < 100 && messages < expected; ++i)
+      std::this_thread::sleep_for (std::chrono::milliseconds (10));
+    return messages >= expected;
+  }
+
+  /// messages received
+  std::atomic<size_t> messages;
+
+  /// bytes received
+  std::atomic<size_t> bytes;
+};
+
+/**
+ * Gets UDP settings for a knowledge base bound to a local port that sends
+ * to another local port, or only receives if to is 0
+ **/
+transport::QoSTransportSettings
+local_udp (int from, int to = 0)
+{
+  transport::QoSTransportSettings settings;
+  settings.type = transport::UDP;
+  settings.hosts.push_back ("127.0.0.1:" + std::to_string (from));
+  if (to)
+    settings.hosts.push_back ("127.0.0.1:" + std::to_string (to));
+  return settings;
+}
+
+void
+test_sensor_sync (void)
+{
+  std::cout << "Testing Sensor sync...\n";
+
+  pose::Position origin (pose::gps_frame (), -79.9, 40.4, 0.0);
+
+  // sent bytes are measured by observers that count what arrives
+  const int base_port = 40100;
+  const int num_agents = 10;
+  MessageCounter unbatched_counter, batched_counter;
+  knowledge::KnowledgeBase unbatched_observer, batched_observer;
+  transport::QoSTransportSettings settings = local_udp (base_port);
+  settings.add_receive_filter (&unbatched_counter);
+  unbatched_observer.attach_transport ("unbatched", settings);
+  settings = local_udp (base_port + 1);
+  settings.add_receive_filter (&batched_counter);
+  batched_observer.attach_transport ("batched", settings);
+
+  /**
+   * each agent has its own knowledge base, and records are copied between
+   * them as a transport would. A second set of agents marks the same
+   * cells without sync, sending one record per cell.
+   **/
+  std::vector <knowledge::KnowledgeBase> contexts (num_agents);
+  std::vector <knowledge::KnowledgeBase> unbatched_contexts (num_agents);
+  std::vector <variables::Sensor> sensors, unbatched_sensors;
+  for (int i = 0; i < num_agents; ++i)
+  {
+    contexts[i].attach_transport ("agent" + std::to_string (i),
+      local_udp (base_port + 10 + i, base_port + 1));
+    sensors.push_back (
+      variables::Sensor ("coverage", &contexts[i], 2.5, origin));
+    sensors[i].enable_sync (std::to_string (i), 1.0);
+
+    unbatched_contexts[i].attach_transport ("agent" + std::to_string (i),
+      local_udp (base_port + 30 + i, base_port));
+    unbatched_sensors.push_back (
+      variables::Sensor ("coverage", &unbatched_contexts[i], 2.5, origin));
+  }
+
+  // copies of records between agents are not sent again
+  const knowledge::KnowledgeUpdateSettings local (true);
+
+  /**
+   * a min-time scenario: for 100 s at 10 Hz, each agent marks its cell
+   * with the time, and every 5 s marks a swath of cells toward its next
+   * destination. Without sync, each agent sends its marks every loop.
+   **/
+  size_t unbatched_sent = 0, batched_sent = 0;
+  bool delivered = true;
+
+  std::mt19937 generator (11);
+  std::vector <double> x (num_agents), y (num_agents);
+  std::vector <double> dx (num_agents, 0), dy (num_agents, 0);
+  for (int i = 0; i < num_agents; ++i)
+  {
+    x[i] = generator () % 200;
+    y[i] = generator () % 200;
+  }
 
+  auto mark = [&] (int agent, int cell_x, int cell_y, double value)
+  {
+    pose::Position index (pose::gps_frame (), cell_x, cell_y, 0.0);
+    pose::Position gps = sensors[agent].get_gps_from_index (index);
+    sensors[agent].set_value (gps, value);
+    unbatched_sensors[agent].set_value (gps, value);
+  };
+
+  for (int tick = 0; tick < 1000; ++tick)
+  {
+    for (int i = 0; i < num_agents; ++i)
+    {
+      if (tick % 50 == 0)
+      {
+        double angle = (generator () % 628) / 100.0;
+        dx[i] = 0.2 * std::cos (angle);
+        dy[i] = 0.2 * std::sin (angle);
+
+        for (int step = 0; step < 12; ++step)
+          for (int side = -1; side <= 1; ++side)
+            mark (i, (int)(x[i] + step * dx[i] * 5) + side,
+              (int)(y[i] + step * dy[i] * 5), tick);
+      }
+
+      x[i] += dx[i];
+      y[i] += dy[i];
+      mark (i, (int)x[i], (int)y[i], tick);
+
+      unbatched_contexts[i].send_modifieds ();
+      ++unbatched_sent;
+
+      // once a second, publish and deliver to the others
+      if (tick % 10 == 9)
+      {
+        std::string key = "sensor.coverage.delta." + std::to_string (i);
+        if (sensors[i].publish () > 0)
+        {
+          contexts[i].send_modifieds ();
+          ++batched_sent;
+
+          knowledge::KnowledgeRecord record = contexts[i].get (key);
+          for (int j = 0; j < num_agents; ++j)
+            if (j != i)
+              contexts[j].set (key, record, local);
+        }
+      }
+    }
+
+    if (tick % 10 == 9)
+    {
+      for (int i = 0; i < num_agents; ++i)
+        sensors[i].merge ();
+
+      // pace the sends so the observers' sockets do not overflow
+      delivered = unbatched_counter.wait_for (unbatched_sent) &&
+        batched_counter.wait_for (batched_sent) && delivered;
+    }
+  }
+
+  std::cout << "  " << num_agents << " agents, min-time marks over UDP: " <<
+    unbatched_counter.bytes / 100 << " B/s in " <<
+    unbatched_counter.messages / 100 << " messages/s unbatched, " <<
+    batched_counter.bytes / 100 << " B/s in " <<
+    batched_counter.messages / 100 << " messages/s batched\n";
+
+  // after the last delivery, every agent has the same map
+  const std::string cells = "sensor.coverage.covered.";
+  knowledge::KnowledgeMap expected = contexts[0].to_map (cells);
+  bool consistent = expected.size () > 1000;
+  for (int i = 1; i < num_agents && consistent; ++i)
+  {
+    knowledge::KnowledgeMap map = contexts[i].to_map (cells);
+    consistent = map.size () == expected.size ();
+
+    for (knowledge::KnowledgeMap::const_iterator cell = map.begin (),
+      match = expected.begin (); consistent && cell != map.end ();
+      ++cell, ++match)
+    {
+      consistent = cell->first == match->first &&
+        cell->second.to_double () == match->second.to_double ();
+    }
+  }
+
+  std::cout << "  Testing Sensor.sync maps agree: ";
+  if (consistent)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  std::cout << "  Testing Sensor.sync sends fewer bytes: ";
+  if (delivered && batched_sent > 0 &&
+    batched_counter.bytes < unbatched_counter.bytes / 2)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  // a received value only replaces a smaller one
+  std::cout << "  Testing Sensor.merge keeps the maximum: ";
+  pose::Position cell = sensors[0].get_gps_from_index (
+    pose::Position (pose::gps_frame (), 500, 500, 0.0));
+  sensors[0].set_value (cell, 5);
+  sensors[1].set_value (cell, 9);
+  sensors[0].publish ();
+  contexts[1].set ("sensor.coverage.delta.0",
+    contexts[0].get ("sensor.coverage.delta.0"));
+  sensors[1].merge ();
+  if (sensors[1].get_value (cell) == 9 && sensors[1].get_pending () == 1)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+}
+
+void
+test_neighbor_index (void)
+{
+  std::cout << "Testing NeighborIndex...\n";
+
+  std::mt19937 rng (7);
+
+  for (int num : {10, 100, 1000})
+  {
+    knowledge::KnowledgeBase context;
+    variables::Agents agents;
+    variables::init_vars (agents, context, num);
+
+    // spread agents over a square with about 10m between neighbors
+    const double side = std::sqrt ((double)num) * 10.0;
+    std::uniform_real_distribution<double> offset (0.0, side);
+    pose::Position origin (pose::gps_frame (), -79.9, 40.4, 0.0);
+    pose::ReferenceFrame local (pose::Cartesian, origin);
+
+    std::vector <pose::Position> positions;
+    for (int i = 0; i < num; ++i)
+    {
+      pose::Position meters (local, offset (rng), offset (rng), 0.0);
+      pose::Position gps = meters.transform_to (pose::gps_frame ());
+      gps.to_container (agents[i].location);
+      positions.push_back (gps);
+    }
+
+    variables::NeighborIndex index (&agents);
+    index.set_frame (pose::gps_frame ());
+
+    // one simulated tick: rebuild, then every agent asks for 8 neighbors
+    auto start = std::chrono::steady_clock::now ();
+    index.invalidate ();
+    index.update ();
+    auto built = std::chrono::steady_clock::now ();
+    size_t found = 0;
+    for (int i = 0; i < num; ++i)
+    {
+      found += index.nearest ((size_t)i, 8).size ();
+    }
+    auto end = std::chrono::steady_clock::now ();
+
+    std::cout << "  " << num << " agents: build " <<
+      std::chrono::duration_cast<std::chrono::microseconds> (
+        built - start).count () << " us, 8-nearest " <<
+      std::chrono::duration_cast<std::chrono::nanoseconds> (
+        end - built).count () / num << " ns/agent\n";
+
+    // compare a sample of queries against a linear scan
+    size_t mismatches = found == (size_t)num * std::min (8, num - 1) ? 0 : 1;
+    const double radius = 25.0;
+    for (int i = 0; i < num; i += std::max (num / 20, 1))
+    {
+      std::vector <std::pair <double, size_t>> all;
+      for (int j = 0; j < num; ++j)
+      {
+        if (j != i)
+        {
+          all.push_back (std::make_pair (
+            positions[i].distance_to (positions[j]), (size_t)j));
+        }
+      }
+      std::sort (all.begin (), all.end ());
+
+      variables::NeighborIndex::Neighbors nearest =
+        index.nearest ((size_t)i, 8);
+      for (size_t n = 0; n < nearest.size (); ++n)
+      {
+        if (std::abs (nearest[n].distance - all[n].first) > 0.01)
+        {
+          ++mismatches;
+        }
+      }
+
+      size_t in_radius = 0;
+      while (in_radius < all.size () &&
+        all[in_radius].first < radius - 0.01)
+      {
+        ++in_radius;
+      }
+      if (index.within ((size_t)i, radius).size () < in_radius)
+      {
+        ++mismatches;
+      }
+    }
+
+    std::cout << "  Testing NeighborIndex matches linear scan (" << num <<
+      " agents): ";
+    if (mismatches == 0)
+    {
+      std::cout << "SUCCESS\n";
+    }
+    else
+    {
+      std::cout << "FAIL\n";
+      ++gams_fails;
+    }
+
+    // the same index built from a view, which binds no agent containers
+    variables::SwarmView view;
+    view.set_agents (context, (size_t)num);
+    variables::NeighborIndex viewed;
+    viewed.set_swarm_view (&view);
+    viewed.set_frame (pose::gps_frame ());
+    viewed.update ();
+
+    size_t differences = viewed.size () == index.size () ? 0 : 1;
+    for (int i = 0; i < num; ++i)
+    {
+      variables::NeighborIndex::Neighbors expected =
+        index.nearest ((size_t)i, 8);
+      variables::NeighborIndex::Neighbors actual =
+        viewed.nearest ((size_t)i, 8);
+
+      if (actual.size () != expected.size () || view.is_bound ((size_t)i))
+      {
+        ++differences;
+        continue;
+      }
+
+      for (size_t n = 0; n < actual.size (); ++n)
+      {
+        if (actual[n].agent != expected[n].agent)
+        {
+          ++differences;
+        }
+      }
+    }
+
+    std::cout << "  Testing NeighborIndex from a SwarmView (" << num <<
+      " agents): ";
+    if (differences == 0)
+    {
+      std::cout << "SUCCESS\n";
+    }
+    else
+    {
+      std::cout << "FAIL\n";
+      ++gams_fails;
+    }
+  }
+}
+
+void
+test_swarm_view (void)
+{
+  std::cout << "Testing SwarmView...\n";
+
+  const size_t num = 500;
+
+  knowledge::KnowledgeBase context;
+
+  for (size_t i = 0; i < num; ++i)
+  {
+    std::string prefix = "agent." + std::to_string (i);
+    context.set (prefix + ".location",
+      std::vector<double> {(double)i, 2.0 * i, 3.0});
+    context.set (prefix + ".battery", knowledge::KnowledgeRecord::Integer (i));
+    context.set (prefix + ".mobile", knowledge::KnowledgeRecord::Integer (1));
+  }
+
+  // binding every agent's containers up front, as Agents does
+  auto start = std::chrono::steady_clock::now ();
+  variables::Agents agents;
+  variables::init_vars (agents, context, (int)num);
+  auto eager = std::chrono::steady_clock::now ();
+
+  // binding only the hot fields
+  variables::SwarmView view;
+  view.set_agents (context, num);
+  view.update ();
+  auto lazy = std::chrono::steady_clock::now ();
+
+  std::cout << "  " << num << " agents: Agents init " <<
+    std::chrono::duration_cast<std::chrono::microseconds> (
+      eager - start).count () << " us, SwarmView bind and refresh " <<
+    std::chrono::duration_cast<std::chrono::microseconds> (
+      lazy - eager).count () << " us\n";
+
+  const variables::SwarmView::Snapshot & snapshot = view.get_snapshot ();
+  size_t mismatches = 0;
+  for (size_t i = 0; i < num; ++i)
+  {
+    if (!snapshot.has_location[i] || snapshot.location_x[i] != (double)i ||
+      snapshot.location_y[i] != 2.0 * i || snapshot.location_z[i] != 3.0 ||
+      snapshot.battery[i] != (knowledge::KnowledgeRecord::Integer)i ||
+      !snapshot.mobile[i] || view.is_bound (i))
+    {
+      ++mismatches;
+    }
+  }
+
+  std::cout << "  Testing SwarmView snapshot: ";
+  if (mismatches == 0)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  // changes are only read after the view is marked stale
+  context.set ("agent.7.battery", knowledge::KnowledgeRecord::Integer (99));
+  view.update ();
+  bool kept = snapshot.battery[7] == 7;
+  view.invalidate ();
+  view.update ();
+
+  std::cout << "  Testing SwarmView refresh once per loop: ";
+  if (kept && snapshot.battery[7] == 99 &&
+    view.get_agent (7).battery_remaining == 99 && view.is_bound (7))
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+}
+
+void
+test_telemetry (void)
+{
+  std::cout << "Testing Telemetry...\n";
+
+  typedef knowledge::KnowledgeRecord::Integer Integer;
+
+  const size_t num = 500;
+
+  // the publishing side: agent.1
+  knowledge::KnowledgeBase sender;
+  variables::Agent agent;
+  agent.init_vars (sender, Integer (1));
+
+  agent.battery_remaining = 42;
+  agent.location.set (0, 1.5);
+  agent.location.set (1, -2.5);
+  agent.location.set (2, 3.0);
+  agent.velocity.set (0, 0.25);
+  agent.dest.set (2, 100.0);
+
+  variables::Telemetry publisher;
+  publisher.init_vars (sender, agent);
+  publisher.publish ();
+
+  knowledge::KnowledgeRecord record = sender.get ("agent.1.telemetry");
+
+  // bytes per agent per second at a send hertz of 1, as the separate
+  // variables that the record replaces and as one packed record
+  const char * fields[] = {
+    ".battery", ".location", ".orientation", ".velocity",
+    ".acceleration", ".dest", ".source" };
+  int64_t separate = 0;
+  for (size_t i = 0; i < sizeof (fields) / sizeof (fields[0]); ++i)
+  {
+    std::string key = agent.prefix + fields[i];
+    separate += sender.get (key).get_encoded_size (key);
+  }
+  int64_t packed = record.get_encoded_size (agent.prefix + ".telemetry");
+
+  std::cout << "  bytes per agent per second: separate " << separate <<
+    ", packed " << packed << "\n";
+
+  std::cout << "  Testing Telemetry record size: ";
+  if (record.size () == variables::Telemetry::RECORD_SIZE &&
+    packed < separate)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  // the receiving side: agent.0 with num agents, agent.1 publishing
+  knowledge::KnowledgeBase receiver;
+  variables::Agents agents;
+  variables::init_vars (agents, receiver, (int)num);
+
+  size_t size = 0;
+  unsigned char * buffer = record.to_unmanaged_buffer (size);
+  for (size_t i = 1; i < num; ++i)
+  {
+    receiver.set_file (agents[i].prefix + ".telemetry", buffer, size);
+  }
+  delete [] buffer;
+
+  variables::Telemetry subscriber;
+  subscriber.init_vars (receiver, agents[0]);
+
+  auto start = std::chrono::steady_clock::now ();
+  size_t received = subscriber.receive (agents);
+  auto end = std::chrono::steady_clock::now ();
+
+  std::cout << "  " << num << " agents: receive " <<
+    std::chrono::duration_cast<std::chrono::nanoseconds> (
+      end - start).count () / (num - 1) << " ns per agent\n";
+
+  variables::Telemetry::Record decoded;
+  knowledge::KnowledgeRecord copy = receiver.get ("agent.7.telemetry");
+  buffer = copy.to_unmanaged_buffer (size);
+  bool valid = variables::Telemetry::decode (buffer, size, decoded);
+  delete [] buffer;
+
+  std::cout << "  Testing Telemetry receive: ";
+  if (received == num - 1 && valid &&
+    *agents[7].battery_remaining == 42 &&
+    agents[7].location[0] == 1.5 && agents[7].location[1] == -2.5 &&
+    agents[7].location[2] == 3.0 && agents[7].velocity[0] == 0.25 &&
+    agents[7].dest[2] == 100.0 && agents[7].orientation.size () == 0 &&
+    decoded.battery == 42 && decoded.location[0] == 1.5)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  // records already unpacked are skipped until the sequence changes
+  received = subscriber.receive (agents);
+
+  std::cout << "  Testing Telemetry skips old records: ";
+  if (received == 0)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
+
+  // through a view, only the agents that sent a record are bound. Here
+  // every agent but agent.0 (self) and the last has sent one.
+  knowledge::KnowledgeBase viewer;
+  variables::Agent self;
+  self.init_vars (viewer, Integer (0));
+
+  buffer = record.to_unmanaged_buffer (size);
+  for (size_t i = 1; i + 1 < num; ++i)
+  {
+    viewer.set_file ("agent." + std::to_string (i) + ".telemetry",
+      buffer, size);
+  }
+  delete [] buffer;
+
+  variables::SwarmView view;
+  view.set_agents (viewer, num);
+
+  variables::Telemetry view_subscriber;
+  view_subscriber.init_vars (viewer, self);
+  received = view_subscriber.receive (view);
+
+  size_t bound = 0;
+  for (size_t i = 0; i < num; ++i)
+  {
+    if (view.is_bound (i))
+    {
+      ++bound;
+    }
+  }
+
+  std::cout << "  Testing Telemetry receive through a SwarmView: ";
+  if (received == num - 2 && bound == num - 2 &&
+    !view.is_bound (0) && !view.is_bound (num - 1) &&
+    *view.get_agent (7).battery_remaining == 42 &&
+    view.get_agent (7).location[1] == -2.5 &&
+    view_subscriber.receive (view) == 0)
+  {
+    std::cout << "SUCCESS\n";
+  }
+  else
+  {
+    std::cout << "FAIL\n";
+    ++gams_fails;
+  }
 }
 
 void
@@ -471,6 +1325,10 @@ main (int /*argc*/, char ** /*argv*/)
   test_accent ();
   test_agent ();
   test_sensor ();
+  test_sensor_sync ();
+  test_neighbor_index ();
+  test_swarm_view ();
+  test_telemetry ();
   test_swarm ();
 
   if (gams_fails > 0)